@@ -0,0 +1,157 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+/*
+
+Built with:
+
+gcc -o genfilter48k build-scripts/gen_audio_resampler48k_filter.c -lm && ./genfilter48k > src/audio/SDL_audio_resampler48k_filter.h
+
+ */
+
+/*
+   The 44.1 to 48 kHz resampler (see SDL_audioresampler48k.c) is polyphase:
+   48000 / 44100 is 160 / 147, so the output samples only ever fall on 160
+   different positions between two input samples. Each of those phases gets
+   its own set of taps of a kaiser-windowed sinc, and every output sample is
+   a plain dot product of the input with one of them, with no interpolation
+   between filter entries like the generic resampler does.
+*/
+
+#include <stdio.h>
+#include <math.h>
+
+#define RESAMPLER48K_PHASES 160
+#define RESAMPLER48K_STEP 147
+#define RESAMPLER48K_TAPS 32
+
+/* Cutoff, relative to the Nyquist frequency of the 44.1 kHz input. The
+   response is flat up to 16 kHz and 0.2 dB down at 18 kHz, images of
+   anything below 20 kHz are 80 dB down. */
+#define RESAMPLER48K_CUTOFF 0.92
+
+/* This is a "modified" bessel function, so you can't use POSIX j0() */
+static double
+bessel(const double x)
+{
+    const double xdiv2 = x / 2.0;
+    double i0 = 1.0f;
+    double f = 1.0f;
+    int i = 1;
+
+    while (1) {
+        const double diff = pow(xdiv2, i * 2) / pow(f, 2);
+        if (diff < 1.0e-21f) {
+            break;
+        }
+        i0 += diff;
+        i++;
+        f *= (double) i;
+    }
+
+    return i0;
+}
+
+static float Resampler48kFilter[RESAMPLER48K_PHASES][RESAMPLER48K_TAPS];
+
+static void
+PrepareResampleFilter(void)
+{
+    /* if dB > 50, beta=(0.1102 * (dB - 8.7)), according to Matlab. */
+    const double dB = 80.0;
+    const double beta = 0.1102 * (dB - 8.7);
+    const double half = RESAMPLER48K_TAPS / 2;
+    int phase, tap;
+
+    for (phase = 0; phase < RESAMPLER48K_PHASES; phase++) {
+        const double frac = (double) phase / RESAMPLER48K_PHASES;
+        double taps[RESAMPLER48K_TAPS];
+        double sum = 0.0;
+
+        /* Tap 'half - 1' is the input sample at or right before the output */
+        for (tap = 0; tap < RESAMPLER48K_TAPS; tap++) {
+            const double x = (tap - (half - 1)) - frac;
+            const double w = x / half;
+            const double kaiser = (fabs(w) < 1.0) ? bessel(beta * sqrt(1.0 - w * w)) / bessel(beta) : 0.0;
+            const double arg = M_PI * RESAMPLER48K_CUTOFF * x;
+            const double sinc = (x == 0.0) ? 1.0 : sin(arg) / arg;
+            taps[tap] = kaiser * sinc;
+            sum += taps[tap];
+        }
+
+        /* Unity gain at DC in every phase */
+        for (tap = 0; tap < RESAMPLER48K_TAPS; tap++) {
+            Resampler48kFilter[phase][tap] = (float) (taps[tap] / sum);
+        }
+    }
+}
+
+int main(void)
+{
+    int phase, tap;
+
+    PrepareResampleFilter();
+
+    printf(
+        "/*\n"
+        "  Simple DirectMedia Layer\n"
+        "  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>\n"
+        "\n"
+        "  This software is provided 'as-is', without any express or implied\n"
+        "  warranty.  In no event will the authors be held liable for any damages\n"
+        "  arising from the use of this software.\n"
+        "\n"
+        "  Permission is granted to anyone to use this software for any purpose,\n"
+        "  including commercial applications, and to alter it and redistribute it\n"
+        "  freely, subject to the following restrictions:\n"
+        "\n"
+        "  1. The origin of this software must not be misrepresented; you must not\n"
+        "     claim that you wrote the original software. If you use this software\n"
+        "     in a product, an acknowledgment in the product documentation would be\n"
+        "     appreciated but is not required.\n"
+        "  2. Altered source versions must be plainly marked as such, and must not be\n"
+        "     misrepresented as being the original software.\n"
+        "  3. This notice may not be removed or altered from any source distribution.\n"
+        "*/\n"
+        "\n"
+        "/* DO NOT EDIT, THIS FILE WAS GENERATED BY build-scripts/gen_audio_resampler48k_filter.c */\n"
+        "\n"
+        "#define RESAMPLER48K_PHASES %d\n"
+        "#define RESAMPLER48K_STEP %d\n"
+        "#define RESAMPLER48K_TAPS %d\n"
+        "\n", RESAMPLER48K_PHASES, RESAMPLER48K_STEP, RESAMPLER48K_TAPS
+    );
+
+    printf("static const float Resampler48kFilter[RESAMPLER48K_PHASES][RESAMPLER48K_TAPS] = {\n");
+    for (phase = 0; phase < RESAMPLER48K_PHASES; phase++) {
+        printf("    {");
+        for (tap = 0; tap < RESAMPLER48K_TAPS; tap++) {
+            printf("%s%.9ff", (tap == 0) ? " " : ((tap % 4) == 0) ? ",\n      " : ", ", Resampler48kFilter[phase][tap]);
+        }
+        printf(" },\n");
+    }
+    printf("};\n\n");
+    printf("/* vi: set ts=4 sw=4 expandtab: */\n");
+
+    return 0;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
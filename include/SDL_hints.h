@@ -1748,6 +1748,107 @@ extern "C" {
  */
 #define SDL_HINT_PS2_DYNAMIC_VSYNC    "SDL_PS2_DYNAMIC_VSYNC"
 
+/**
+ *  \brief  A variable controlling whether the PS5 audio driver trades safety margin for latency
+ *
+ *  This variable can be set to the following values:
+ *    "0"       - The buffer size follows the samples of the requested spec. Default
+ *    "1"       - Buffers of 256 sample frames (about 5ms) are used whatever the app asked for,
+ *                and the audio thread runs with real-time priority. Mixing has to keep up
+ *                with the shorter deadline, or the output will skip.
+ *
+ *  Use SDL_PS5GetAudioDeviceLatency() to see the effect. This hint must be set before the
+ *  audio device is opened.
+ */
+#define SDL_HINT_PS5_AUDIO_LOW_LATENCY "SDL_PS5_AUDIO_LOW_LATENCY"
+
+/**
+ *  \brief  A variable controlling how many scan-out buffers the PS5 video driver cycles through
+ *
+ *  This variable can be set to the following values:
+ *    "2"       - Double buffering. Default
+ *    "3"       - Triple buffering, the app can draw two frames ahead of the screen at the cost of
+ *                one more frame of latency.
+ *
+ *  Frames are queued without waiting for the flip, SDL only waits when the next buffer to draw
+ *  into is still on screen. This hint must be set before the video subsystem is initialized.
+ */
+#define SDL_HINT_PS5_FRAMEBUFFER_COUNT "SDL_PS5_FRAMEBUFFER_COUNT"
+
+/**
+ *  \brief  A variable controlling whether PS5 pads are sampled on a thread of their own
+ *
+ *  This variable can be set to the following values:
+ *    "0"       - Pads are read once per SDL_JoystickUpdate(), so input is sampled at the frame
+ *                rate of the app, and presses shorter than a frame can be missed. Default
+ *    "1"       - A background thread samples the pads every 2ms, and SDL_JoystickUpdate() sends
+ *                every change it saw since the previous update, in order.
+ *
+ *  This hint must be set before the joystick subsystem is initialized.
+ */
+#define SDL_HINT_PS5_JOYSTICK_THREAD "SDL_PS5_JOYSTICK_THREAD"
+
+/**
+ *  \brief  A variable controlling whether the PS5 keyboard is read through its buffer
+ *
+ *  This variable can be set to the following values:
+ *    "0"       - The state of the keyboard is read once per SDL_PumpEvents(), so keys pressed
+ *                and released between two pumps are missed. Default
+ *    "1"       - Every state the keyboard buffered since the previous pump is read, and the keys
+ *                that went up and down between them are sent in order.
+ *
+ *  This hint must be set before the video subsystem is initialized.
+ */
+#define SDL_HINT_PS5_KEYBOARD_BUFFERED "SDL_PS5_KEYBOARD_BUFFERED"
+
+/**
+ *  \brief  A variable controlling whether the PS5 window surface is the scan-out buffer itself
+ *
+ *  This variable can be set to the following values:
+ *    "0"       - The window surface is swizzled into tiled scan-out buffers on each update. Default
+ *    "1"       - A single scan-out buffer with the linear layout is used as the window surface,
+ *                so updates don't copy any pixels. Drawing may tear, and SDL falls back to the
+ *                tiled buffers if the linear layout isn't accepted.
+ *
+ *  This hint must be set before the video subsystem is initialized.
+ */
+#define SDL_HINT_PS5_LINEAR_FRAMEBUFFER "SDL_PS5_LINEAR_FRAMEBUFFER"
+
+/**
+ *  \brief  A variable controlling when the PS5 video driver shows a new frame
+ *
+ *  This variable can be set to the following values, with the meaning of SDL_GL_SetSwapInterval():
+ *    "0"       - Flip immediately, frames may tear
+ *    "1"       - Flip on vblank, at up to 60 frames per second
+ *    "2"       - Flip on vblank, at up to 30 frames per second
+ *    "3"       - Flip on vblank, at up to 20 frames per second
+ *    "-1"      - Flip on vblank, or immediately when the frame is late (adaptive vsync)
+ *
+ *  By default, frames are flipped on vblank unless the renderer was created without
+ *  SDL_RENDERER_PRESENTVSYNC, or SDL_HINT_RENDER_VSYNC is "0".
+ *
+ *  The value of this hint is used at runtime, so it can be changed at any time.
+ */
+#define SDL_HINT_PS5_SWAP_INTERVAL "SDL_PS5_SWAP_INTERVAL"
+
+/**
+ *  \brief  A variable controlling whether PS5 windows are scaled to the display
+ *
+ *  This variable can be set to the following values:
+ *    "0"       - Windows are made fullscreen at the display resolution. Default
+ *    "nearest" - Windows keep their size, and their surface is scaled to fit the display with
+ *                nearest pixel sampling, keeping its aspect ratio
+ *    "integer" - Like "nearest", by the largest whole factor that fits
+ *    "linear"  - Like "nearest", with bilinear filtering
+ *
+ *  Scaling is done in the same pass that copies the window surface to the screen, so a
+ *  640x480 surface costs about as much to present as a display sized one. It doesn't
+ *  apply with SDL_HINT_PS5_LINEAR_FRAMEBUFFER.
+ *
+ *  This hint must be set before the video subsystem is initialized.
+ */
+#define SDL_HINT_PS5_WINDOW_SCALING "SDL_PS5_WINDOW_SCALING"
+
 /**
  * \brief A variable to control whether the return key on the soft keyboard
  *        should hide the soft keyboard on Android and iOS.
@@ -1768,6 +1869,22 @@ extern "C" {
  */
 #define SDL_HINT_RPI_VIDEO_LAYER           "SDL_RPI_VIDEO_LAYER"
 
+/**
+ *  \brief  A variable controlling whether SDL_RWFromFile() maps large files opened for reading
+ *
+ *  This variable can be set to the following values:
+ *    "0"       - Files are always read through stdio
+ *    "1"       - Regular files of 64 KiB or more, opened for reading only, are read from a
+ *                mapping of them where the platform supports it (default)
+ *
+ *  A mapped file must not be truncated while it is open: reading past its new
+ *  end raises SIGBUS instead of returning a short read. Mapped files are opened
+ *  as SDL_RWOPS_MEMORY_RO streams rather than SDL_RWOPS_STDFILE ones.
+ *
+ *  The value of this hint is checked each time a file is opened.
+ */
+#define SDL_HINT_RWOPS_FILE_MAPPING "SDL_RWOPS_FILE_MAPPING"
+
 /**
  *  \brief Specify an "activity name" for screensaver inhibition.
  *
@@ -1877,6 +1994,18 @@ extern "C" {
  */
 #define SDL_HINT_VITA_TOUCH_MOUSE_DEVICE    "SDL_HINT_VITA_TOUCH_MOUSE_DEVICE"
 
+/**
+ *  \brief  A variable naming the file SDL writes its timing trace to
+ *
+ *  The trace holds the most recent calls to SDL_PumpEvents(), the audio
+ *  thread, render command flushes, blits and window surface updates of each
+ *  thread, in the Chrome trace event format. It is written by SDL_Quit(),
+ *  and each time this hint is changed while SDL is initialized.
+ *
+ *  This hint only has an effect when SDL is built with the SDL_TRACING option.
+ */
+#define SDL_HINT_TRACE_FILE "SDL_TRACE_FILE"
+
 /**
  *  \brief  A variable controlling whether the Android / tvOS remotes
  *  should be listed as joystick devices, instead of sending keyboard events.
@@ -45,6 +45,7 @@ extern "C" {
 #define SDL_RWOPS_JNIFILE   3U  /**< Android asset */
 #define SDL_RWOPS_MEMORY    4U  /**< Memory stream */
 #define SDL_RWOPS_MEMORY_RO 5U  /**< Read-Only memory stream */
+#define SDL_RWOPS_BUFFERED  6U  /**< Read-ahead buffer over another stream */
 
 /**
  * This is the read/write operation structure -- very basic.
@@ -184,6 +185,16 @@ typedef struct SDL_RWops
  * As a fallback, SDL_RWFromFile() will transparently open a matching filename
  * in an Android app's `assets`.
  *
+ * On platforms that can map files into memory, a regular file of 64 KiB or
+ * more that is opened for reading only ("r" or "rb") is read from a mapping
+ * of it rather than through stdio. The stream's type is then
+ * SDL_RWOPS_MEMORY_RO instead of SDL_RWOPS_STDFILE, so code that looks at
+ * `type` or at `hidden.stdio` must not expect a FILE pointer. While such a
+ * stream is open, the file must not be truncated by this or another process:
+ * reading the pages past its new end raises SIGBUS rather than returning a
+ * short read. Set SDL_HINT_RWOPS_FILE_MAPPING to "0" before opening files
+ * that may change this way, to read them through stdio as before.
+ *
  * Closing the SDL_RWops will close the file handle SDL is holding internally.
  *
  * \param file a UTF-8 string representing the filename to open
@@ -314,6 +325,53 @@ extern DECLSPEC SDL_RWops *SDLCALL SDL_RWFromMem(void *mem, int size);
 extern DECLSPEC SDL_RWops *SDLCALL SDL_RWFromConstMem(const void *mem,
                                                       int size);
 
+/**
+ * Use this function to map a whole file into memory, read-only, for use with
+ * RWops.
+ *
+ * Reads from the stream are copies out of the mapping, and the file isn't
+ * read until its pages are touched. The stream's type is SDL_RWOPS_MEMORY_RO,
+ * and writing to it reports an error.
+ *
+ * The file must not be truncated while the stream is open.
+ *
+ * \param file a UTF-8 string representing the filename to map
+ * \returns a pointer to a new SDL_RWops structure, or NULL if the file can't
+ *          be mapped; call SDL_GetError() for more information.
+ *
+ * \sa SDL_RWclose
+ * \sa SDL_RWFromConstMem
+ * \sa SDL_RWFromFile
+ * \sa SDL_RWread
+ * \sa SDL_RWseek
+ */
+extern DECLSPEC SDL_RWops *SDLCALL SDL_RWFromMappedFile(const char *file);
+
+/**
+ * Use this function to read ahead of another SDL_RWops, in blocks.
+ *
+ * Small reads, such as the ones SDL_ReadLE16() and friends make, are served
+ * from the buffer, and seeks within what was read ahead don't reach the
+ * other stream. Reads at least as large as the buffer go straight to the
+ * other stream. Writes aren't buffered; they go to the other stream where
+ * the reader is.
+ *
+ * The new stream owns `inner`: closing it closes `inner` too, which must not
+ * be used directly in the meantime.
+ *
+ * \param inner the SDL_RWops to read ahead of
+ * \param bufsize the size of the buffer in bytes, or 0 for a default
+ * \returns a pointer to a new SDL_RWops structure, or NULL on failure (in
+ *          which case `inner` is left open); call SDL_GetError() for more
+ *          information.
+ *
+ * \sa SDL_RWclose
+ * \sa SDL_RWread
+ * \sa SDL_RWseek
+ * \sa SDL_ReadLE32
+ */
+extern DECLSPEC SDL_RWops *SDLCALL SDL_RWFromBuffered(SDL_RWops *inner, size_t bufsize);
+
 /* @} *//* RWFrom functions */
 
 
@@ -29,6 +29,7 @@
 #define SDL_system_h_
 
 #include "SDL_stdinc.h"
+#include "SDL_audio.h"
 #include "SDL_keyboard.h"
 #include "SDL_render.h"
 #include "SDL_video.h"
@@ -627,6 +628,67 @@ extern DECLSPEC int SDLCALL SDL_GDKGetDefaultUser(XUserHandle * outUserHandle);
 
 #endif
 
+/* Functions used only by PS5 */
+#if defined(__PROSPERO__) || defined(SDL_PS5_HOST_EMULATION)
+
+/**
+ * Presentation statistics of the PS5 video driver.
+ *
+ * \sa SDL_PS5GetFlipStats
+ */
+typedef struct SDL_PS5FlipStats
+{
+    Uint64 frames_submitted; /**< frames queued for display */
+    Uint64 frames_flipped;   /**< frames that reached the screen */
+    Uint64 missed_vblanks;   /**< vblanks that showed the same frame again */
+    Uint32 last_latency_us;  /**< submit-to-flip time of the last frame shown */
+    Uint32 avg_latency_us;   /**< average submit-to-flip time */
+    Uint32 max_latency_us;   /**< longest submit-to-flip time */
+    int num_buffers;         /**< scan-out buffers in use */
+} SDL_PS5FlipStats;
+
+/**
+ * Get presentation statistics of the PS5 video driver.
+ *
+ * The counters cover all flips since the display mode was last set, or
+ * since they were last reset.
+ *
+ * \param stats a pointer filled in with the statistics.
+ * \param reset SDL_TRUE to reset the counters after reading them.
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ */
+extern DECLSPEC int SDLCALL SDL_PS5GetFlipStats(SDL_PS5FlipStats *stats, SDL_bool reset);
+
+/**
+ * Get the amount of direct memory the PS5 video driver holds.
+ *
+ * The scan-out buffers are sized for the current display mode and
+ * framebuffer count, and are reallocated when the display mode changes.
+ *
+ * \returns the number of bytes in use, or 0 if the PS5 video driver is not
+ *          initialized.
+ */
+extern DECLSPEC size_t SDLCALL SDL_PS5GetVideoMemoryUsage(void);
+
+/**
+ * Get the output latency of an audio device, in sample frames.
+ *
+ * This counts the audio queued with SDL_QueueAudio(), the audio waiting
+ * to be converted to the device's format, and the audio handed to the
+ * hardware that hasn't been played yet. Divide it by the frequency of the
+ * obtained spec to get the latency in seconds.
+ *
+ * \param dev the ID of the audio device.
+ * \returns the number of sample frames, or -1 if the device isn't open;
+ *          call SDL_GetError() for more information.
+ *
+ * \sa SDL_HINT_PS5_AUDIO_LOW_LATENCY
+ */
+extern DECLSPEC int SDLCALL SDL_PS5GetAudioDeviceLatency(SDL_AudioDeviceID dev);
+
+#endif
+
 /* Ends C function definitions when using C++ */
 #ifdef __cplusplus
 }
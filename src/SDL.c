@@ -45,6 +45,7 @@
 #include "SDL_revision.h"
 #include "SDL_assert_c.h"
 #include "SDL_log_c.h"
+#include "SDL_trace_c.h"
 #include "events/SDL_events_c.h"
 #include "haptic/SDL_haptic_c.h"
 #include "joystick/SDL_joystick_c.h"
@@ -191,6 +192,9 @@ void SDL_InitMainThread(void)
     SDL_TicksInit();
 #endif
     SDL_LogInit();
+#ifdef SDL_TRACING
+    SDL_TraceInit();
+#endif
 
     SDL_main_thread_initialized = SDL_TRUE;
 }
@@ -524,6 +528,9 @@ void SDL_Quit(void)
     SDL_DBus_Quit();
 #endif
 
+#ifdef SDL_TRACING
+    SDL_TraceQuit();
+#endif
     SDL_ClearHints();
     SDL_AssertionsQuit();
 
@@ -157,6 +157,9 @@
 #ifndef SDL_VIDEO_RENDER_PSP
 #define SDL_VIDEO_RENDER_PSP 0
 #endif
+#ifndef SDL_VIDEO_RENDER_PS5
+#define SDL_VIDEO_RENDER_PS5 0
+#endif
 #ifndef SDL_VIDEO_RENDER_VITA_GXM
 #define SDL_VIDEO_RENDER_VITA_GXM 0
 #endif
@@ -183,6 +186,8 @@
 #define SDL_VIDEO_RENDER_PS2 0
 #undef SDL_VIDEO_RENDER_PSP
 #define SDL_VIDEO_RENDER_PSP 0
+#undef SDL_VIDEO_RENDER_PS5
+#define SDL_VIDEO_RENDER_PS5 0
 #undef SDL_VIDEO_RENDER_VITA_GXM
 #define SDL_VIDEO_RENDER_VITA_GXM 0
 #endif /* SDL_RENDER_DISABLED */
@@ -199,6 +204,7 @@
         SDL_VIDEO_RENDER_DIRECTFB | \
         SDL_VIDEO_RENDER_PS2      | \
         SDL_VIDEO_RENDER_PSP      | \
+        SDL_VIDEO_RENDER_PS5      | \
         SDL_VIDEO_RENDER_VITA_GXM)
 
 #if !defined(SDL_RENDER_DISABLED) && !SDL_HAS_RENDER_DRIVER
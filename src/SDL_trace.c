@@ -0,0 +1,258 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "./SDL_internal.h"
+
+#ifdef SDL_TRACING
+
+/* Timing trace of SDL internals
+
+   Each thread writes its events to a ring buffer of its own, without
+   locking, and only the last SDL_TRACE_EVENTS of them are kept. A dump
+   reads the rings while they are written, and leaves out the events that
+   were overwritten while it copied them.
+*/
+
+#include "SDL_atomic.h"
+#include "SDL_hints.h"
+#include "SDL_rwops.h"
+#include "SDL_thread.h"
+#include "SDL_timer.h"
+#include "SDL_trace_c.h"
+
+/* Per thread, must be a power of two */
+#define SDL_TRACE_EVENTS 16384
+
+typedef struct SDL_TraceEvent
+{
+    const char *name;
+    Uint64 ticks;
+    char phase;
+} SDL_TraceEvent;
+
+typedef struct SDL_TraceBuffer
+{
+    SDL_threadID thread;
+    volatile Uint32 written; /* only changed by the thread */
+    volatile SDL_bool full;  /* set once the ring has wrapped */
+    struct SDL_TraceBuffer *next;
+    SDL_TraceEvent events[SDL_TRACE_EVENTS];
+} SDL_TraceBuffer;
+
+/* The buffers outlive SDL_Quit(), as threads that are still running may
+   write to them, and are reused by their thread on the next run */
+static SDL_TraceBuffer *SDL_trace_buffers;
+static SDL_SpinLock SDL_trace_tls_lock;
+static SDL_TLSID SDL_trace_tls;
+static SDL_bool SDL_trace_initialized;
+
+static SDL_TraceBuffer *SDL_GetTraceBuffer(void)
+{
+    const SDL_threadID thread = SDL_ThreadID();
+    SDL_TraceBuffer *buffer;
+
+    if (!SDL_trace_tls) {
+        SDL_AtomicLock(&SDL_trace_tls_lock);
+        if (!SDL_trace_tls) {
+            SDL_TLSID slot = SDL_TLSCreate();
+            SDL_MemoryBarrierRelease();
+            SDL_trace_tls = slot;
+        }
+        SDL_AtomicUnlock(&SDL_trace_tls_lock);
+    }
+    SDL_MemoryBarrierAcquire();
+
+    buffer = (SDL_TraceBuffer *)SDL_TLSGet(SDL_trace_tls);
+    if (buffer) {
+        return buffer;
+    }
+
+    /* The thread local storage goes away with SDL_Quit() */
+    for (buffer = (SDL_TraceBuffer *)SDL_AtomicGetPtr((void **)&SDL_trace_buffers);
+         buffer; buffer = buffer->next) {
+        if (buffer->thread == thread) {
+            break;
+        }
+    }
+    if (!buffer) {
+        buffer = (SDL_TraceBuffer *)SDL_calloc(1, sizeof(*buffer));
+        if (!buffer) {
+            return NULL;
+        }
+        buffer->thread = thread;
+        do {
+            buffer->next = (SDL_TraceBuffer *)SDL_AtomicGetPtr((void **)&SDL_trace_buffers);
+        } while (!SDL_AtomicCASPtr((void **)&SDL_trace_buffers, buffer->next, buffer));
+    }
+
+    SDL_TLSSet(SDL_trace_tls, buffer, NULL);
+    return buffer;
+}
+
+static void SDL_TraceAdd(const char *name, char phase)
+{
+    SDL_TraceBuffer *buffer = SDL_GetTraceBuffer();
+    SDL_TraceEvent *event;
+
+    if (!buffer) {
+        return;
+    }
+
+    event = &buffer->events[buffer->written & (SDL_TRACE_EVENTS - 1)];
+    event->name = name;
+    event->ticks = SDL_GetPerformanceCounter();
+    event->phase = phase;
+
+    /* The event must be complete before a dump can see it */
+    SDL_MemoryBarrierRelease();
+    if (buffer->written == SDL_TRACE_EVENTS - 1) {
+        buffer->full = SDL_TRUE;
+    }
+    buffer->written++;
+}
+
+void SDL_TraceBegin(const char *name)
+{
+    SDL_TraceAdd(name, 'B');
+}
+
+void SDL_TraceEnd(const char *name)
+{
+    SDL_TraceAdd(name, 'E');
+}
+
+/* Copy the events a ring holds, oldest first, returns how many */
+static int SDL_CopyTraceEvents(SDL_TraceBuffer *buffer, SDL_TraceEvent *events)
+{
+    Uint32 end, overwritten;
+    int count, skip, i;
+
+    end = buffer->written;
+    count = buffer->full ? SDL_TRACE_EVENTS : (int)end;
+    SDL_MemoryBarrierAcquire();
+
+    for (i = 0; i < count; i++) {
+        events[i] = buffer->events[(end - count + i) & (SDL_TRACE_EVENTS - 1)];
+    }
+
+    /* The thread went on writing over the oldest ones */
+    SDL_MemoryBarrierAcquire();
+    overwritten = buffer->written - end;
+    skip = (int)SDL_min(overwritten, (Uint32)count);
+    SDL_memmove(events, events + skip, (count - skip) * sizeof(*events));
+
+    return count - skip;
+}
+
+int SDL_TraceDump(const char *file)
+{
+    const double scale = 1000000.0 / SDL_GetPerformanceFrequency();
+    SDL_TraceBuffer *buffer;
+    SDL_TraceEvent *events;
+    SDL_RWops *rw;
+    const char *separator = "";
+    char line[256];
+    int result = 0;
+
+    events = (SDL_TraceEvent *)SDL_malloc(SDL_TRACE_EVENTS * sizeof(*events));
+    if (!events) {
+        return SDL_OutOfMemory();
+    }
+    rw = SDL_RWFromFile(file, "wb");
+    if (!rw) {
+        SDL_free(events);
+        return -1;
+    }
+
+    SDL_RWwrite(rw, "{\"traceEvents\":[", 16, 1);
+    for (buffer = (SDL_TraceBuffer *)SDL_AtomicGetPtr((void **)&SDL_trace_buffers);
+         buffer; buffer = buffer->next) {
+        const int count = SDL_CopyTraceEvents(buffer, events);
+        int depth = 0;
+
+        for (int i = 0; i < count; i++) {
+            const SDL_TraceEvent *event = &events[i];
+            size_t len;
+
+            /* The ring may start in the middle of a span */
+            if (event->phase == 'E') {
+                if (depth == 0) {
+                    continue;
+                }
+                depth--;
+            } else {
+                depth++;
+            }
+
+            len = SDL_snprintf(line, sizeof(line),
+                               "%s\n{\"name\":\"%s\",\"ph\":\"%c\",\"ts\":%.3f,\"pid\":1,\"tid\":%lu}",
+                               separator, event->name, event->phase,
+                               event->ticks * scale, buffer->thread);
+            if (SDL_RWwrite(rw, line, SDL_min(len, sizeof(line) - 1), 1) != 1) {
+                result = -1;
+            }
+            separator = ",";
+        }
+    }
+    if (SDL_RWwrite(rw, "\n]}\n", 4, 1) != 1) {
+        result = -1;
+    }
+
+    if (SDL_RWclose(rw) < 0) {
+        result = -1;
+    }
+    SDL_free(events);
+    return result;
+}
+
+/* Setting the hint while SDL runs dumps the trace right away */
+static void SDLCALL SDL_TraceFileChanged(void *userdata, const char *name,
+                                         const char *oldValue, const char *hint)
+{
+    if (SDL_trace_initialized && hint && *hint) {
+        SDL_TraceDump(hint);
+    }
+}
+
+void SDL_TraceInit(void)
+{
+    SDL_AddHintCallback(SDL_HINT_TRACE_FILE, SDL_TraceFileChanged, NULL);
+    SDL_trace_initialized = SDL_TRUE;
+}
+
+void SDL_TraceQuit(void)
+{
+    const char *hint;
+
+    if (SDL_trace_initialized) {
+        SDL_trace_initialized = SDL_FALSE;
+        SDL_DelHintCallback(SDL_HINT_TRACE_FILE, SDL_TraceFileChanged, NULL);
+    }
+
+    /* Anything traced gets written out, whether SDL_Init() was called */
+    hint = SDL_GetHint(SDL_HINT_TRACE_FILE);
+    if (hint && *hint && SDL_AtomicGetPtr((void **)&SDL_trace_buffers)) {
+        SDL_TraceDump(hint);
+    }
+}
+
+#endif /* SDL_TRACING */
+
+/* vi: set ts=4 sw=4 expandtab: */
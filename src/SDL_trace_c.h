@@ -0,0 +1,53 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "./SDL_internal.h"
+
+/* This file defines the timing trace of SDL internals. It is only built
+   with the SDL_TRACING option, the macros do nothing otherwise. */
+
+#ifndef SDL_trace_c_h_
+#define SDL_trace_c_h_
+
+#ifdef SDL_TRACING
+
+extern void SDL_TraceInit(void);
+extern void SDL_TraceQuit(void);
+
+/* Names must be string literals, only the pointer is kept */
+extern void SDL_TraceBegin(const char *name);
+extern void SDL_TraceEnd(const char *name);
+
+/* Write the events of every thread as a Chrome trace (JSON) */
+extern int SDL_TraceDump(const char *file);
+
+#define SDL_TRACE_BEGIN(name) SDL_TraceBegin(name)
+#define SDL_TRACE_END(name)   SDL_TraceEnd(name)
+
+#else
+
+#define SDL_TRACE_BEGIN(name)
+#define SDL_TRACE_END(name)
+
+#endif /* SDL_TRACING */
+
+#endif /* SDL_trace_c_h_ */
+
+/* vi: set ts=4 sw=4 expandtab: */
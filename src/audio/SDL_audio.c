@@ -28,6 +28,7 @@
 #include "SDL_sysaudio.h"
 #include "../thread/SDL_systhread.h"
 #include "../SDL_utils_c.h"
+#include "../SDL_trace_c.h"
 
 #define _THIS SDL_AudioDevice *_this
 
@@ -299,6 +300,11 @@ static int SDL_AudioOpenDevice_Default(_THIS, const char *devname)
     return SDL_Unsupported();
 }
 
+static int SDL_AudioGetPendingFrames_Default(_THIS)
+{
+    return 0; /* assume the device plays what it gets right away. */
+}
+
 static SDL_INLINE SDL_bool is_in_audio_device_thread(SDL_AudioDevice *device)
 {
     /* The device thread locks the same mutex, but not through the public API.
@@ -351,6 +357,7 @@ static void finish_audio_entry_points_init(void)
     FILL_STUB(UnlockDevice);
     FILL_STUB(FreeDeviceHandle);
     FILL_STUB(Deinitialize);
+    FILL_STUB(GetPendingFrames);
 #undef FILL_STUB
 }
 
@@ -667,6 +674,46 @@ void SDL_ClearQueuedAudio(SDL_AudioDeviceID devid)
     current_audio.impl.UnlockDevice(device);
 }
 
+int SDL_GetAudioDeviceQueuedFrames(SDL_AudioDeviceID devid)
+{
+    SDL_AudioDevice *device = get_audio_device(devid);
+    Sint64 frames = 0;
+
+    if (!device) {
+        return -1;
+    }
+
+    current_audio.impl.LockDevice(device);
+    if (device->callbackspec.callback == SDL_BufferQueueDrainCallback ||
+        device->callbackspec.callback == SDL_BufferQueueFillCallback) {
+        const int frame_size = (SDL_AUDIO_BITSIZE(device->callbackspec.format) / 8) * device->callbackspec.channels;
+        /* Queued in the app's format and rate, count them at the device's rate */
+        frames = (Sint64)(SDL_CountDataQueue(device->buffer_queue) / frame_size) * device->spec.freq / device->callbackspec.freq;
+    }
+    if (device->stream) {
+        /* Converted to the device's spec when playing, to the app's when capturing */
+        const SDL_AudioSpec *spec = device->iscapture ? &device->callbackspec : &device->spec;
+        const int frame_size = (SDL_AUDIO_BITSIZE(spec->format) / 8) * spec->channels;
+        frames += (Sint64)(SDL_AudioStreamAvailable(device->stream) / frame_size) * device->spec.freq / spec->freq;
+    }
+    current_audio.impl.UnlockDevice(device);
+
+    if (!device->iscapture && SDL_AtomicGet(&device->enabled)) {
+        frames += current_audio.impl.GetPendingFrames(device);
+    }
+
+    /* Report them at the rate the app sees */
+    frames = frames * device->callbackspec.freq / device->spec.freq;
+    return (int)SDL_min(frames, SDL_MAX_SINT32);
+}
+
+#if defined(__PROSPERO__) || defined(SDL_PS5_HOST_EMULATION)
+int SDL_PS5GetAudioDeviceLatency(SDL_AudioDeviceID dev)
+{
+    return SDL_GetAudioDeviceQueuedFrames(dev);
+}
+#endif
+
 #ifdef SDL_AUDIO_DRIVER_ANDROID
 extern void Android_JNI_AudioSetThreadPriority(int, int);
 #endif
@@ -703,6 +750,7 @@ static int SDLCALL SDL_RunAudio(void *userdata)
 
     /* Loop, filling the audio buffers */
     while (!SDL_AtomicGet(&device->shutdown)) {
+        SDL_TRACE_BEGIN("SDL_RunAudio");
         data_len = device->callbackspec.size;
 
         /* Fill the current buffer with sound */
@@ -736,7 +784,9 @@ static int SDLCALL SDL_RunAudio(void *userdata)
         if (SDL_AtomicGet(&device->paused)) {
             SDL_memset(data, device->callbackspec.silence, data_len);
         } else {
+            SDL_TRACE_BEGIN("audio callback");
             callback(udata, data, data_len);
+            SDL_TRACE_END("audio callback");
         }
         SDL_UnlockMutex(device->mixer_lock);
 
@@ -791,6 +841,7 @@ static int SDLCALL SDL_RunAudio(void *userdata)
             current_audio.impl.PlayDevice(device);
             current_audio.impl.WaitDevice(device);
         }
+        SDL_TRACE_END("SDL_RunAudio");
     }
 
     /* Wait for the audio to drain. */
@@ -56,6 +56,25 @@ extern SDL_AudioFormat SDL_NextAudioFormat(void);
 extern Uint8 SDL_SilenceValueForFormat(const SDL_AudioFormat format);
 extern void SDL_CalculateAudioSpec(SDL_AudioSpec *spec);
 
+/* Sample frames between the app and the speakers (or the app and the
+   device, when capturing), at the rate of the app, -1 if 'devid' is not
+   an open device */
+extern int SDL_GetAudioDeviceQueuedFrames(SDL_AudioDeviceID devid);
+
+/* Fixed ratio 44.1 to 48 kHz resampler of interleaved float frames, see
+   SDL_audioresampler48k.c. Input is consumed in full, output is held back
+   until there is room for it in 'dst', and never exceeds
+   SDL_RESAMPLE48K_MAX_FRAMES of the input plus what was held back.
+   Passing at most 'max_frames' at a time, with room for the output,
+   doesn't allocate after SDL_CreateResampler48k(). */
+typedef struct SDL_Resampler48k SDL_Resampler48k;
+#define SDL_RESAMPLE48K_MAX_FRAMES(frames) ((((frames) + 1) * 160) / 147 + 1)
+extern SDL_Resampler48k *SDL_CreateResampler48k(int channels, int max_frames);
+extern int SDL_Resample48k(SDL_Resampler48k *resampler, const float *src, int src_frames,
+                           float *dst, int dst_frames);
+extern void SDL_ResetResampler48k(SDL_Resampler48k *resampler);
+extern void SDL_DestroyResampler48k(SDL_Resampler48k *resampler);
+
 /* Choose the audio filter functions below */
 extern void SDL_ChooseAudioConverters(void);
 
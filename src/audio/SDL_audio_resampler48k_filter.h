@@ -0,0 +1,1311 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+/* DO NOT EDIT, THIS FILE WAS GENERATED BY build-scripts/gen_audio_resampler48k_filter.c */
+
+#define RESAMPLER48K_PHASES 160
+#define RESAMPLER48K_STEP 147
+#define RESAMPLER48K_TAPS 32
+
+static const float Resampler48kFilter[RESAMPLER48K_PHASES][RESAMPLER48K_TAPS] = {
+    { -0.000131569f, 0.000213611f, -0.000153930f, -0.000288782f,
+      0.001464718f, -0.003798536f, 0.007716316f, -0.013542108f,
+      0.021384491f, -0.031041933f, 0.041956991f, -0.053241462f,
+      0.063778982f, -0.072391644f, 0.078038968f, 0.920071781f,
+      0.078038968f, -0.072391644f, 0.063778982f, -0.053241462f,
+      0.041956991f, -0.031041933f, 0.021384491f, -0.013542108f,
+      0.007716316f, -0.003798536f, 0.001464718f, -0.000288782f,
+      -0.000153930f, 0.000213611f, -0.000131569f, 0.000000000f },
+    { -0.000127384f, 0.000202766f, -0.000131329f, -0.000328811f,
+      0.001526336f, -0.003881026f, 0.007809584f, -0.013621456f,
+      0.021405002f, -0.030932324f, 0.041610945f, -0.052499339f,
+      0.062374979f, -0.069755040f, 0.072069541f, 0.919982493f,
+      0.084053151f, -0.075016618f, 0.065163895f, -0.053964887f,
+      0.042287108f, -0.031139094f, 0.021354960f, -0.013456711f,
+      0.007619319f, -0.003713970f, 0.001402081f, -0.000248336f,
+      -0.000176657f, 0.000224474f, -0.000135750f, 0.000042094f },
+    { -0.000123212f, 0.000191969f, -0.000108881f, -0.000368449f,
+      0.001587105f, -0.003961895f, 0.007900075f, -0.013696444f,
+      0.021419197f, -0.030814232f, 0.041254383f, -0.051745489f,
+      0.060960405f, -0.067116737f, 0.066155493f, 0.919829845f,
+      0.090120971f, -0.077638149f, 0.066537179f, -0.054675967f,
+      0.042606376f, -0.031227618f, 0.021319067f, -0.013366962f,
+      0.007519577f, -0.003627821f, 0.001338626f, -0.000207521f,
+      -0.000199523f, 0.000235378f, -0.000139942f, 0.000043224f },
+    { -0.000119051f, 0.000181215f, -0.000086586f, -0.000407672f,
+      0.001646947f, -0.004040971f, 0.007987455f, -0.013766518f,
+      0.021426231f, -0.030686468f, 0.040885765f, -0.050978038f,
+      0.059533168f, -0.064474612f, 0.060294468f, 0.919576108f,
+      0.096238337f, -0.080252416f, 0.067895703f, -0.055372227f,
+      0.042912919f, -0.031306159f, 0.021275911f, -0.013272315f,
+      0.007416790f, -0.003539952f, 0.001274308f, -0.000166337f,
+      -0.000222514f, 0.000246310f, -0.000144136f, 0.000044357f },
+    { -0.000114900f, 0.000170507f, -0.000064450f, -0.000446470f,
+      0.001705850f, -0.004118238f, 0.008071715f, -0.013831677f,
+      0.021426128f, -0.030549116f, 0.040505257f, -0.050197307f,
+      0.058093797f, -0.061829530f, 0.054487299f, 0.919221342f,
+      0.102404371f, -0.082858540f, 0.069238953f, -0.056053367f,
+      0.043206584f, -0.031374648f, 0.021225477f, -0.013172777f,
+      0.007310978f, -0.003450385f, 0.001209145f, -0.000124795f,
+      -0.000245622f, 0.000257266f, -0.000148333f, 0.000045493f },
+    { -0.000110763f, 0.000159850f, -0.000042480f, -0.000484832f,
+      0.001763799f, -0.004193679f, 0.008152840f, -0.013891922f,
+      0.021418925f, -0.030402264f, 0.040113043f, -0.049403604f,
+      0.056642815f, -0.059182324f, 0.048734788f, 0.918765664f,
+      0.108618148f, -0.085455649f, 0.070566393f, -0.056719091f,
+      0.043487210f, -0.031433016f, 0.021167746f, -0.013068358f,
+      0.007202161f, -0.003359139f, 0.001143152f, -0.000082908f,
+      -0.000268842f, 0.000268242f, -0.000152529f, 0.000046632f },
+    { -0.000106640f, 0.000149245f, -0.000020682f, -0.000522749f,
+      0.001820780f, -0.004267280f, 0.008230819f, -0.013947259f,
+      0.021404656f, -0.030245999f, 0.039709300f, -0.048597254f,
+      0.055180762f, -0.056533840f, 0.043037731f, 0.918209136f,
+      0.114878751f, -0.088042863f, 0.071877532f, -0.057369109f,
+      0.043754652f, -0.031481203f, 0.021102704f, -0.012959071f,
+      0.007090359f, -0.003266237f, 0.001076349f, -0.000040686f,
+      -0.000292164f, 0.000279235f, -0.000156723f, 0.000047774f },
+    { -0.000102533f, 0.000138698f, 0.000000936f, -0.000560211f,
+      0.001876780f, -0.004339026f, 0.008305644f, -0.013997690f,
+      0.021383354f, -0.030080417f, 0.039294209f, -0.047778577f,
+      0.053708155f, -0.053884912f, 0.037396908f, 0.917551875f,
+      0.121185243f, -0.090619311f, 0.073171847f, -0.058003142f,
+      0.044008762f, -0.031519145f, 0.021030342f, -0.012844928f,
+      0.006975596f, -0.003171700f, 0.001008752f, 0.000001856f,
+      -0.000315582f, 0.000290241f, -0.000160914f, 0.000048917f },
+    { -0.000098444f, 0.000128211f, 0.000022370f, -0.000597207f,
+      0.001931786f, -0.004408903f, 0.008377304f, -0.014043224f,
+      0.021355065f, -0.029905615f, 0.038867962f, -0.046947896f,
+      0.052225538f, -0.051236372f, 0.031813085f, 0.916794002f,
+      0.127536669f, -0.093184106f, 0.074448824f, -0.058620900f,
+      0.044249397f, -0.031546786f, 0.020950649f, -0.012725943f,
+      0.006857895f, -0.003075551f, 0.000940380f, 0.000044707f,
+      -0.000339089f, 0.000301256f, -0.000165100f, 0.000050061f },
+    { -0.000094374f, 0.000117787f, 0.000043612f, -0.000633728f,
+      0.001985785f, -0.004476898f, 0.008445794f, -0.014083869f,
+      0.021319823f, -0.029721687f, 0.038430743f, -0.046105541f,
+      0.050733428f, -0.048589043f, 0.026287008f, 0.915935636f,
+      0.133932069f, -0.095736362f, 0.075707965f, -0.059222106f,
+      0.044476420f, -0.031564075f, 0.020863619f, -0.012602135f,
+      0.006737279f, -0.002977815f, 0.000871251f, 0.000087854f,
+      -0.000362675f, 0.000312275f, -0.000169278f, 0.000051205f },
+    { -0.000090324f, 0.000107430f, 0.000064657f, -0.000669765f,
+      0.002038765f, -0.004543000f, 0.008511105f, -0.014119634f,
+      0.021277675f, -0.029528737f, 0.037982747f, -0.045251835f,
+      0.049232367f, -0.045943744f, 0.020819413f, 0.914977074f,
+      0.140370473f, -0.098275192f, 0.076948762f, -0.059806492f,
+      0.044689693f, -0.031570952f, 0.020769250f, -0.012473521f,
+      0.006613776f, -0.002878515f, 0.000801385f, 0.000131284f,
+      -0.000386335f, 0.000323295f, -0.000173447f, 0.000052350f },
+    { -0.000086295f, 0.000097144f, 0.000085500f, -0.000705309f,
+      0.002090714f, -0.004607196f, 0.008573232f, -0.014150532f,
+      0.021228667f, -0.029326867f, 0.037524167f, -0.044387117f,
+      0.047722887f, -0.043301288f, 0.015411017f, 0.913918376f,
+      0.146850869f, -0.100799710f, 0.078170724f, -0.060373783f,
+      0.044889089f, -0.031567380f, 0.020667536f, -0.012340121f,
+      0.006487411f, -0.002777676f, 0.000730800f, 0.000174984f,
+      -0.000410059f, 0.000334311f, -0.000177606f, 0.000053493f },
+    { -0.000082290f, 0.000086930f, 0.000106134f, -0.000740352f,
+      0.002141623f, -0.004669475f, 0.008632173f, -0.014176575f,
+      0.021172844f, -0.029116184f, 0.037055202f, -0.043511715f,
+      0.046205513f, -0.040662486f, 0.010062520f, 0.912759840f,
+      0.153372273f, -0.103309020f, 0.079373345f, -0.060923714f,
+      0.045074478f, -0.031553306f, 0.020558480f, -0.012201957f,
+      0.006358213f, -0.002675324f, 0.000659518f, 0.000218940f,
+      -0.000433841f, 0.000345319f, -0.000181752f, 0.000054634f },
+    { -0.000078310f, 0.000076792f, 0.000126553f, -0.000774883f,
+      0.002191478f, -0.004729828f, 0.008687922f, -0.014197778f,
+      0.021110257f, -0.028896796f, 0.036576048f, -0.042625964f,
+      0.044680778f, -0.038028136f, 0.004774611f, 0.911501646f,
+      0.159933671f, -0.105802231f, 0.080556132f, -0.061456021f,
+      0.045245741f, -0.031528693f, 0.020442087f, -0.012059054f,
+      0.006226210f, -0.002571485f, 0.000587556f, 0.000263139f,
+      -0.000457671f, 0.000356316f, -0.000185884f, 0.000055774f },
+    { -0.000074355f, 0.000066733f, 0.000146753f, -0.000808896f,
+      0.002240272f, -0.004788246f, 0.008740478f, -0.014214158f,
+      0.021040957f, -0.028668813f, 0.036086913f, -0.041730203f,
+      0.043149218f, -0.035399031f, -0.000452043f, 0.910144091f,
+      0.166534036f, -0.108278446f, 0.081718601f, -0.061970457f,
+      0.045402758f, -0.031493500f, 0.020318359f, -0.011911435f,
+      0.006091432f, -0.002466185f, 0.000514937f, 0.000307568f,
+      -0.000481542f, 0.000367297f, -0.000190000f, 0.000056910f },
+    { -0.000070428f, 0.000056756f, 0.000166728f, -0.000842383f,
+      0.002287992f, -0.004844718f, 0.008789841f, -0.014225732f,
+      0.020964999f, -0.028432349f, 0.035587996f, -0.040824771f,
+      0.041611359f, -0.032775961f, -0.005616787f, 0.908687413f,
+      0.173172325f, -0.110736772f, 0.082860269f, -0.062466759f,
+      0.045545414f, -0.031447697f, 0.020187307f, -0.011759129f,
+      0.005953912f, -0.002359454f, 0.000441681f, 0.000352212f,
+      -0.000505445f, 0.000378257f, -0.000194097f, 0.000058043f },
+    { -0.000066529f, 0.000046865f, 0.000186473f, -0.000875334f,
+      0.002334630f, -0.004899238f, 0.008836010f, -0.014232519f,
+      0.020882437f, -0.028187519f, 0.035079509f, -0.039910011f,
+      0.040067732f, -0.030159706f, -0.010718983f, 0.907131910f,
+      0.179847494f, -0.113176316f, 0.083980642f, -0.062944688f,
+      0.045673598f, -0.031391248f, 0.020048941f, -0.011602163f,
+      0.005813680f, -0.002251318f, 0.000367809f, 0.000397057f,
+      -0.000529373f, 0.000389192f, -0.000198174f, 0.000059172f },
+    { -0.000062659f, 0.000037061f, 0.000205982f, -0.000907744f,
+      0.002380177f, -0.004951798f, 0.008878985f, -0.014234542f,
+      0.020793330f, -0.027934441f, 0.034561660f, -0.038986258f,
+      0.038518865f, -0.027551040f, -0.015758010f, 0.905477881f,
+      0.186558470f, -0.115596183f, 0.085079253f, -0.063404001f,
+      0.045787204f, -0.031324126f, 0.019903274f, -0.011440569f,
+      0.005670771f, -0.002141807f, 0.000293343f, 0.000442089f,
+      -0.000553317f, 0.000400099f, -0.000202229f, 0.000060296f },
+    { -0.000058821f, 0.000027347f, 0.000225251f, -0.000939603f,
+      0.002424625f, -0.005002392f, 0.008918772f, -0.014231821f,
+      0.020697737f, -0.027673237f, 0.034034658f, -0.038053863f,
+      0.036965284f, -0.024950732f, -0.020733263f, 0.903725684f,
+      0.193304196f, -0.117995463f, 0.086155631f, -0.063844457f,
+      0.045886133f, -0.031246312f, 0.019750321f, -0.011274378f,
+      0.005525219f, -0.002030950f, 0.000218305f, 0.000487294f,
+      -0.000577268f, 0.000410973f, -0.000206260f, 0.000061414f },
+    { -0.000055014f, 0.000017727f, 0.000244276f, -0.000970907f,
+      0.002467964f, -0.005051013f, 0.008955370f, -0.014224381f,
+      0.020595716f, -0.027404025f, 0.033498719f, -0.037113164f,
+      0.035407525f, -0.022359539f, -0.025644153f, 0.901875615f,
+      0.200083569f, -0.120373271f, 0.087209299f, -0.064265825f,
+      0.045970287f, -0.031157779f, 0.019590100f, -0.011103624f,
+      0.005377058f, -0.001918777f, 0.000142716f, 0.000532657f,
+      -0.000601218f, 0.000421808f, -0.000210265f, 0.000062526f },
+    { -0.000051241f, 0.000008202f, 0.000263050f, -0.001001647f,
+      0.002510187f, -0.005097657f, 0.008988786f, -0.014212247f,
+      0.020487336f, -0.027126933f, 0.032954060f, -0.036164515f,
+      0.033846103f, -0.019778214f, -0.030490112f, 0.899928153f,
+      0.206895515f, -0.122728713f, 0.088239804f, -0.064667881f,
+      0.046039570f, -0.031058511f, 0.019422634f, -0.010928342f,
+      0.005226328f, -0.001805320f, 0.000066599f, 0.000578163f,
+      -0.000625159f, 0.000432602f, -0.000214243f, 0.000063631f },
+    { -0.000047502f, -0.000001224f, 0.000281570f, -0.001031816f,
+      0.002551288f, -0.005142319f, 0.009019024f, -0.014195446f,
+      0.020372659f, -0.026842084f, 0.032400895f, -0.035208251f,
+      0.032281548f, -0.017207501f, -0.035270583f, 0.897883594f,
+      0.213738918f, -0.125060871f, 0.089246675f, -0.065050393f,
+      0.046093900f, -0.030948495f, 0.019247944f, -0.010748570f,
+      0.005073063f, -0.001690608f, -0.000010022f, 0.000623798f,
+      -0.000649082f, 0.000443349f, -0.000218190f, 0.000064727f },
+    { -0.000043798f, -0.000010549f, 0.000299831f, -0.001061410f,
+      0.002591259f, -0.005184995f, 0.009046092f, -0.014174007f,
+      0.020251751f, -0.026549609f, 0.031839445f, -0.034244731f,
+      0.030714378f, -0.014648138f, -0.039985023f, 0.895742416f,
+      0.220612675f, -0.127368867f, 0.090229467f, -0.065413155f,
+      0.046133187f, -0.030827722f, 0.019066056f, -0.010564347f,
+      0.004917304f, -0.001574675f, -0.000087125f, 0.000669547f,
+      -0.000672977f, 0.000454046f, -0.000222106f, 0.000065816f },
+    { -0.000040131f, -0.000019771f, 0.000317829f, -0.001090421f,
+      0.002630093f, -0.005225683f, 0.009069996f, -0.014147958f,
+      0.020124683f, -0.026249640f, 0.031269930f, -0.033274300f,
+      0.029145116f, -0.012100851f, -0.044632919f, 0.893504977f,
+      0.227515638f, -0.129651800f, 0.091187730f, -0.065755956f,
+      0.046157356f, -0.030696182f, 0.018876998f, -0.010375713f,
+      0.004759090f, -0.001457553f, -0.000164686f, 0.000715394f,
+      -0.000696837f, 0.000464686f, -0.000225988f, 0.000066895f },
+    { -0.000036501f, -0.000028887f, 0.000335559f, -0.001118844f,
+      0.002667786f, -0.005264380f, 0.009090746f, -0.014117331f,
+      0.019991523f, -0.025942305f, 0.030692575f, -0.032297306f,
+      0.027574282f, -0.009566363f, -0.049213763f, 0.891171753f,
+      0.234446689f, -0.131908789f, 0.092121020f, -0.066078588f,
+      0.046166334f, -0.030553874f, 0.018680803f, -0.010182711f,
+      0.004598462f, -0.001339275f, -0.000242681f, 0.000761324f,
+      -0.000720653f, 0.000475267f, -0.000229834f, 0.000067964f },
+    { -0.000032910f, -0.000037895f, 0.000353018f, -0.001146673f,
+      0.002704330f, -0.005301085f, 0.009108352f, -0.014082159f,
+      0.019852344f, -0.025627740f, 0.030107604f, -0.031314097f,
+      0.026002390f, -0.007045383f, -0.053727068f, 0.888743222f,
+      0.241404682f, -0.134138912f, 0.093028896f, -0.066380851f,
+      0.046160046f, -0.030400796f, 0.018477501f, -0.009985385f,
+      0.004435461f, -0.001219875f, -0.000321087f, 0.000807322f,
+      -0.000744415f, 0.000485784f, -0.000233642f, 0.000069022f },
+    { -0.000029358f, -0.000046793f, 0.000370202f, -0.001173902f,
+      0.002739721f, -0.005335796f, 0.009122822f, -0.014042475f,
+      0.019707222f, -0.025306081f, 0.029515244f, -0.030325027f,
+      0.024429956f, -0.004538617f, -0.058172364f, 0.886219859f,
+      0.248388454f, -0.136341289f, 0.093910940f, -0.066662543f,
+      0.046138432f, -0.030236954f, 0.018267132f, -0.009783778f,
+      0.004270131f, -0.001099387f, -0.000399879f, 0.000853372f,
+      -0.000768115f, 0.000496231f, -0.000237411f, 0.000070069f },
+    { -0.000025847f, -0.000055578f, 0.000387107f, -0.001200528f,
+      0.002773955f, -0.005368514f, 0.009134169f, -0.013998315f,
+      0.019556230f, -0.024977466f, 0.028915720f, -0.029330444f,
+      0.022857493f, -0.002046759f, -0.062549196f, 0.883602142f,
+      0.255396843f, -0.138515040f, 0.094766706f, -0.066923492f,
+      0.046101432f, -0.030062353f, 0.018049730f, -0.009577941f,
+      0.004102516f, -0.000977846f, -0.000479032f, 0.000899459f,
+      -0.000791744f, 0.000506605f, -0.000241137f, 0.000071104f },
+    { -0.000022377f, -0.000064249f, 0.000403729f, -0.001226544f,
+      0.002807027f, -0.005399238f, 0.009142406f, -0.013949714f,
+      0.019399446f, -0.024642035f, 0.028309261f, -0.028330700f,
+      0.021285506f, 0.000429505f, -0.066857137f, 0.880890667f,
+      0.262428701f, -0.140659273f, 0.095595792f, -0.067163497f,
+      0.046048984f, -0.029877009f, 0.017825339f, -0.009367920f,
+      0.003932660f, -0.000855287f, -0.000558521f, 0.000945566f,
+      -0.000815293f, 0.000516901f, -0.000244820f, 0.000072125f },
+    { -0.000018949f, -0.000072803f, 0.000420065f, -0.001251947f,
+      0.002838933f, -0.005427970f, 0.009147547f, -0.013896711f,
+      0.019236946f, -0.024299927f, 0.027696101f, -0.027326146f,
+      0.019714504f, 0.002889497f, -0.071095750f, 0.878085911f,
+      0.269482821f, -0.142773077f, 0.096397772f, -0.067382395f,
+      0.045981046f, -0.029680930f, 0.017594000f, -0.009153768f,
+      0.003760608f, -0.000731747f, -0.000638321f, 0.000991678f,
+      -0.000838753f, 0.000527114f, -0.000248457f, 0.000073133f },
+    { -0.000015565f, -0.000081238f, 0.000436111f, -0.001276731f,
+      0.002869670f, -0.005454712f, 0.009149605f, -0.013839345f,
+      0.019068815f, -0.023951286f, 0.027076468f, -0.026317133f,
+      0.018144993f, 0.005332550f, -0.075264655f, 0.875188410f,
+      0.276558012f, -0.144855604f, 0.097172245f, -0.067580014f,
+      0.045897566f, -0.029474139f, 0.017355762f, -0.008935536f,
+      0.003586409f, -0.000607261f, -0.000718407f, 0.001037778f,
+      -0.000862114f, 0.000537240f, -0.000252046f, 0.000074126f },
+    { -0.000012224f, -0.000089553f, 0.000451865f, -0.001300894f,
+      0.002899235f, -0.005479465f, 0.009148598f, -0.013777657f,
+      0.018895131f, -0.023596259f, 0.026450593f, -0.025304010f,
+      0.016577471f, 0.007758004f, -0.079363450f, 0.872198820f,
+      0.283653080f, -0.146905959f, 0.097918808f, -0.067756183f,
+      0.045798503f, -0.029256655f, 0.017110672f, -0.008713278f,
+      0.003410110f, -0.000481868f, -0.000798752f, 0.001083851f,
+      -0.000885368f, 0.000547274f, -0.000255585f, 0.000075104f },
+    { -0.000008929f, -0.000097745f, 0.000467322f, -0.001324430f,
+      0.002927625f, -0.005502234f, 0.009144540f, -0.013711688f,
+      0.018715980f, -0.023234986f, 0.025818715f, -0.024287131f,
+      0.015012437f, 0.010165210f, -0.083391778f, 0.869117737f,
+      0.290766865f, -0.148923263f, 0.098637067f, -0.067910746f,
+      0.045683827f, -0.029028507f, 0.016858779f, -0.008487049f,
+      0.003231759f, -0.000355604f, -0.000879332f, 0.001129881f,
+      -0.000908505f, 0.000557212f, -0.000259072f, 0.000076065f },
+    { -0.000005678f, -0.000105814f, 0.000482481f, -0.001347337f,
+      0.002954838f, -0.005523022f, 0.009137450f, -0.013641481f,
+      0.018531444f, -0.022867618f, 0.025181064f, -0.023266843f,
+      0.013450384f, 0.012553528f, -0.087349296f, 0.865945697f,
+      0.297898084f, -0.150906622f, 0.099326633f, -0.068043552f,
+      0.045553505f, -0.028789721f, 0.016600139f, -0.008256906f,
+      0.003051406f, -0.000228507f, -0.000960119f, 0.001175850f,
+      -0.000931517f, 0.000567048f, -0.000262505f, 0.000077010f },
+    { -0.000002475f, -0.000113756f, 0.000497337f, -0.001369611f,
+      0.002980873f, -0.005541834f, 0.009127346f, -0.013567081f,
+      0.018341610f, -0.022494305f, 0.024537876f, -0.022243496f,
+      0.011891804f, 0.014922327f, -0.091235653f, 0.862683356f,
+      0.305045545f, -0.152855203f, 0.099987127f, -0.068154462f,
+      0.045407508f, -0.028540332f, 0.016334808f, -0.008022907f,
+      0.002869102f, -0.000100617f, -0.001041087f, 0.001221742f,
+      -0.000954393f, 0.000576778f, -0.000265881f, 0.000077937f },
+    { 0.000000682f, -0.000121570f, 0.000511889f, -0.001391249f,
+      0.003005728f, -0.005558674f, 0.009114247f, -0.013488532f,
+      0.018146567f, -0.022115191f, 0.023889389f, -0.021217439f,
+      0.010337184f, 0.017270986f, -0.095050551f, 0.859331429f,
+      0.312208027f, -0.154768109f, 0.100618184f, -0.068243325f,
+      0.045245819f, -0.028280374f, 0.016062843f, -0.007785115f,
+      0.002684898f, 0.000028029f, -0.001122210f, 0.001267542f,
+      -0.000977126f, 0.000586399f, -0.000269200f, 0.000078846f },
+    { 0.000003791f, -0.000129256f, 0.000526135f, -0.001412248f,
+      0.003029403f, -0.005573548f, 0.009098173f, -0.013405882f,
+      0.017946402f, -0.021730434f, 0.023235839f, -0.020189025f,
+      0.008787009f, 0.019598896f, -0.098793693f, 0.855890512f,
+      0.319384277f, -0.156644493f, 0.101219423f, -0.068310015f,
+      0.045068420f, -0.028009890f, 0.015784305f, -0.007543589f,
+      0.002498848f, 0.000157389f, -0.001203461f, 0.001313232f,
+      -0.000999704f, 0.000595904f, -0.000272458f, 0.000079735f },
+    { 0.000006852f, -0.000136810f, 0.000540070f, -0.001432606f,
+      0.003051896f, -0.005586464f, 0.009079146f, -0.013319177f,
+      0.017741207f, -0.021340182f, 0.022577465f, -0.019158596f,
+      0.007241758f, 0.021905454f, -0.102464788f, 0.852361262f,
+      0.326573104f, -0.158483475f, 0.101790495f, -0.068354398f,
+      0.044875301f, -0.027728923f, 0.015499259f, -0.007298393f,
+      0.002311003f, 0.000287425f, -0.001284811f, 0.001358796f,
+      -0.001022120f, 0.000605290f, -0.000275654f, 0.000080604f },
+    { 0.000009864f, -0.000144233f, 0.000553694f, -0.001452320f,
+      0.003073208f, -0.005597427f, 0.009057187f, -0.013228467f,
+      0.017531071f, -0.020944590f, 0.021914503f, -0.018126501f,
+      0.005701907f, 0.024190068f, -0.106063582f, 0.848744512f,
+      0.333773196f, -0.160284206f, 0.102331042f, -0.068376370f,
+      0.044666458f, -0.027437519f, 0.015207770f, -0.007049592f,
+      0.002121419f, 0.000418096f, -0.001366235f, 0.001404216f,
+      -0.001044364f, 0.000614551f, -0.000278786f, 0.000081452f },
+    { 0.000012826f, -0.000151522f, 0.000567004f, -0.001471389f,
+      0.003093340f, -0.005606445f, 0.009032321f, -0.013133801f,
+      0.017316088f, -0.020543810f, 0.021247191f, -0.017093087f,
+      0.004167928f, 0.026452160f, -0.109589830f, 0.845040858f,
+      0.340983361f, -0.162045851f, 0.102840729f, -0.068375804f,
+      0.044441890f, -0.027135732f, 0.014909907f, -0.006797253f,
+      0.001930150f, 0.000549361f, -0.001447705f, 0.001449477f,
+      -0.001066426f, 0.000623684f, -0.000281851f, 0.000082279f },
+    { 0.000015738f, -0.000158676f, 0.000579997f, -0.001489809f,
+      0.003112292f, -0.005613527f, 0.009004570f, -0.013035230f,
+      0.017096352f, -0.020138003f, 0.020575771f, -0.016058696f,
+      0.002640289f, 0.028691158f, -0.113043308f, 0.841251016f,
+      0.348202288f, -0.163767561f, 0.103319213f, -0.068352602f,
+      0.044201601f, -0.026823616f, 0.014605740f, -0.006541443f,
+      0.001737253f, 0.000681178f, -0.001529193f, 0.001494561f,
+      -0.001088298f, 0.000632683f, -0.000284848f, 0.000083083f },
+    { 0.000018600f, -0.000165693f, 0.000592673f, -0.001507581f,
+      0.003130065f, -0.005618682f, 0.008973959f, -0.012932808f,
+      0.016871957f, -0.019727321f, 0.019900482f, -0.015023675f,
+      0.001119454f, 0.030906502f, -0.116423801f, 0.837375879f,
+      0.355428755f, -0.165448472f, 0.103766173f, -0.068306662f,
+      0.043945603f, -0.026501229f, 0.014295342f, -0.006282231f,
+      0.001542784f, 0.000813507f, -0.001610670f, 0.001539451f,
+      -0.001109970f, 0.000641543f, -0.000287775f, 0.000083864f },
+    { 0.000021410f, -0.000172574f, 0.000605029f, -0.001524701f,
+      0.003146661f, -0.005621919f, 0.008940513f, -0.012826587f,
+      0.016642999f, -0.019311924f, 0.019221561f, -0.013988364f,
+      -0.000394120f, 0.033097643f, -0.119731113f, 0.833416104f,
+      0.362661451f, -0.167087778f, 0.104181282f, -0.068237893f,
+      0.043673910f, -0.026168631f, 0.013978790f, -0.006019690f,
+      0.001346801f, 0.000946304f, -0.001692110f, 0.001584130f,
+      -0.001131432f, 0.000650262f, -0.000290629f, 0.000084621f },
+    { 0.000024169f, -0.000179315f, 0.000617063f, -0.001541170f,
+      0.003162081f, -0.005623248f, 0.008904259f, -0.012716620f,
+      0.016409578f, -0.018891970f, 0.018539250f, -0.012953103f,
+      -0.001899976f, 0.035264045f, -0.122965083f, 0.829372466f,
+      0.369899154f, -0.168684617f, 0.104564235f, -0.068146206f,
+      0.043386541f, -0.025825894f, 0.013656160f, -0.005753889f,
+      0.001149362f, 0.001079527f, -0.001773484f, 0.001628582f,
+      -0.001152675f, 0.000658832f, -0.000293409f, 0.000085352f },
+    { 0.000026875f, -0.000185918f, 0.000628775f, -0.001556986f,
+      0.003176329f, -0.005622680f, 0.008865224f, -0.012602964f,
+      0.016171789f, -0.018467618f, 0.017853789f, -0.011918232f,
+      -0.003397666f, 0.037405174f, -0.126125544f, 0.825245857f,
+      0.377140552f, -0.170238197f, 0.104914725f, -0.068031527f,
+      0.043083526f, -0.025473082f, 0.013327534f, -0.005484905f,
+      0.000950526f, 0.001213134f, -0.001854763f, 0.001672788f,
+      -0.001173691f, 0.000667251f, -0.000296112f, 0.000086059f },
+    { 0.000029529f, -0.000192379f, 0.000640162f, -0.001572149f,
+      0.003189407f, -0.005620226f, 0.008823436f, -0.012485675f,
+      0.015929732f, -0.018039027f, 0.017165417f, -0.010884088f,
+      -0.004886744f, 0.039520517f, -0.129212350f, 0.821036994f,
+      0.384384364f, -0.171747684f, 0.105232462f, -0.067893781f,
+      0.042764891f, -0.025110271f, 0.012992995f, -0.005212811f,
+      0.000750354f, 0.001347081f, -0.001935919f, 0.001716733f,
+      -0.001194469f, 0.000675514f, -0.000298737f, 0.000086738f },
+    { 0.000032130f, -0.000198699f, 0.000651224f, -0.001586658f,
+      0.003201318f, -0.005615898f, 0.008778923f, -0.012364808f,
+      0.015683509f, -0.017606361f, 0.016474374f, -0.009851009f,
+      -0.006366771f, 0.041609567f, -0.132225394f, 0.816746771f,
+      0.391629279f, -0.173212260f, 0.105517156f, -0.067732908f,
+      0.042430677f, -0.024737535f, 0.012652626f, -0.004937684f,
+      0.000548906f, 0.001481325f, -0.002016924f, 0.001760399f,
+      -0.001215001f, 0.000683616f, -0.000301281f, 0.000087391f },
+    { 0.000034678f, -0.000204877f, 0.000661960f, -0.001600513f,
+      0.003212066f, -0.005609709f, 0.008731716f, -0.012240422f,
+      0.015433219f, -0.017169777f, 0.015780898f, -0.008819327f,
+      -0.007837312f, 0.043671828f, -0.135164574f, 0.812376022f,
+      0.398874074f, -0.174631134f, 0.105768532f, -0.067548856f,
+      0.042080924f, -0.024354959f, 0.012306517f, -0.004659602f,
+      0.000346244f, 0.001615821f, -0.002097748f, 0.001803769f,
+      -0.001235277f, 0.000691552f, -0.000303743f, 0.000088015f },
+    { 0.000037172f, -0.000210911f, 0.000672367f, -0.001613714f,
+      0.003221654f, -0.005601671f, 0.008681844f, -0.012112577f,
+      0.015178965f, -0.016729441f, 0.015085232f, -0.007789374f,
+      -0.009297936f, 0.045706812f, -0.138029784f, 0.807925582f,
+      0.406117409f, -0.176003501f, 0.105986327f, -0.067341566f,
+      0.041715678f, -0.023962623f, 0.011954756f, -0.004378646f,
+      0.000142430f, 0.001750525f, -0.002178364f, 0.001846825f,
+      -0.001255287f, 0.000699318f, -0.000306120f, 0.000088611f },
+    { 0.000039612f, -0.000216802f, 0.000682446f, -0.001626261f,
+      0.003230087f, -0.005591799f, 0.008629338f, -0.011981333f,
+      0.014920850f, -0.016285514f, 0.014387613f, -0.006761481f,
+      -0.010748221f, 0.047714055f, -0.140820965f, 0.803396344f,
+      0.413357973f, -0.177328557f, 0.106170274f, -0.067110993f,
+      0.041334994f, -0.023560617f, 0.011597437f, -0.004094894f,
+      -0.000062473f, 0.001885393f, -0.002258741f, 0.001889552f,
+      -0.001275024f, 0.000706909f, -0.000308411f, 0.000089177f },
+    { 0.000041997f, -0.000222548f, 0.000692196f, -0.001638156f,
+      0.003237371f, -0.005580105f, 0.008574231f, -0.011846748f,
+      0.014658978f, -0.015838159f, 0.013688279f, -0.005735975f,
+      -0.012187744f, 0.049693085f, -0.143538058f, 0.798789263f,
+      0.420594513f, -0.178605542f, 0.106320128f, -0.066857114f,
+      0.040938925f, -0.023149032f, 0.011234652f, -0.003808429f,
+      -0.000268403f, 0.002020379f, -0.002338851f, 0.001931930f,
+      -0.001294476f, 0.000714322f, -0.000310613f, 0.000089713f },
+    { 0.000044329f, -0.000228148f, 0.000701616f, -0.001649397f,
+      0.003243508f, -0.005566605f, 0.008516553f, -0.011708886f,
+      0.014393453f, -0.015387539f, 0.012987470f, -0.004713182f,
+      -0.013616095f, 0.051643457f, -0.146181032f, 0.794105172f,
+      0.427825689f, -0.179833665f, 0.106435642f, -0.066579901f,
+      0.040527537f, -0.022727963f, 0.010866500f, -0.003519334f,
+      -0.000475293f, 0.002155439f, -0.002418665f, 0.001973944f,
+      -0.001313636f, 0.000721551f, -0.000312726f, 0.000090217f },
+    { 0.000046605f, -0.000233603f, 0.000710706f, -0.001659988f,
+      0.003248506f, -0.005551315f, 0.008456340f, -0.011567809f,
+      0.014124381f, -0.014933818f, 0.012285423f, -0.003693426f,
+      -0.015032865f, 0.053564731f, -0.148749858f, 0.789344966f,
+      0.435050219f, -0.181012169f, 0.106516600f, -0.066279322f,
+      0.040100902f, -0.022297507f, 0.010493076f, -0.003227694f,
+      -0.000683080f, 0.002290527f, -0.002498153f, 0.002015575f,
+      -0.001332494f, 0.000728592f, -0.000314746f, 0.000090690f },
+    { 0.000048827f, -0.000238911f, 0.000719465f, -0.001669928f,
+      0.003252370f, -0.005534249f, 0.008393624f, -0.011423579f,
+      0.013851868f, -0.014477161f, 0.011582375f, -0.002677026f,
+      -0.016437650f, 0.055456478f, -0.151244566f, 0.784509659f,
+      0.442266792f, -0.182140276f, 0.106562763f, -0.065955371f,
+      0.039659083f, -0.021857768f, 0.010114485f, -0.002933596f,
+      -0.000891698f, 0.002425597f, -0.002577286f, 0.002056808f,
+      -0.001351041f, 0.000735442f, -0.000316672f, 0.000091130f },
+    { 0.000050994f, -0.000244073f, 0.000727893f, -0.001679220f,
+      0.003255106f, -0.005515425f, 0.008328439f, -0.011276261f,
+      0.013576020f, -0.014017731f, 0.010878562f, -0.001664302f,
+      -0.017830055f, 0.057318285f, -0.153665125f, 0.779600203f,
+      0.449474066f, -0.183217242f, 0.106573932f, -0.065608047f,
+      0.039202169f, -0.021408850f, 0.009730829f, -0.002637124f,
+      -0.001101081f, 0.002560603f, -0.002656036f, 0.002097625f,
+      -0.001369268f, 0.000742094f, -0.000318502f, 0.000091536f },
+    { 0.000053105f, -0.000249088f, 0.000735990f, -0.001687864f,
+      0.003256721f, -0.005494858f, 0.008260822f, -0.011125918f,
+      0.013296943f, -0.013555694f, 0.010174219f, -0.000655570f,
+      -0.019209690f, 0.059149742f, -0.156011611f, 0.774617493f,
+      0.456670791f, -0.184242323f, 0.106549904f, -0.065237351f,
+      0.038730238f, -0.020950863f, 0.009342212f, -0.002338369f,
+      -0.001311162f, 0.002695499f, -0.002734372f, 0.002138008f,
+      -0.001387166f, 0.000748546f, -0.000320234f, 0.000091908f },
+    { 0.000055161f, -0.000253955f, 0.000743756f, -0.001695863f,
+      0.003257221f, -0.005472566f, 0.008190808f, -0.010972616f,
+      0.013014748f, -0.013091214f, 0.009469584f, 0.000348859f,
+      -0.020576168f, 0.060950454f, -0.158284053f, 0.769562542f,
+      0.463855594f, -0.185214773f, 0.106490478f, -0.064843282f,
+      0.038243383f, -0.020483918f, 0.008948743f, -0.002037419f,
+      -0.001521873f, 0.002830239f, -0.002812265f, 0.002177941f,
+      -0.001404726f, 0.000754793f, -0.000321866f, 0.000092245f },
+    { 0.000057161f, -0.000258674f, 0.000751191f, -0.001703219f,
+      0.003256614f, -0.005448568f, 0.008118433f, -0.010816421f,
+      0.012729541f, -0.012624457f, 0.008764887f, 0.001348673f,
+      -0.021929113f, 0.062720053f, -0.160482511f, 0.764436364f,
+      0.471027225f, -0.186133876f, 0.106395476f, -0.064425871f,
+      0.037741698f, -0.020008134f, 0.008550531f, -0.001734365f,
+      -0.001733148f, 0.002964776f, -0.002889686f, 0.002217407f,
+      -0.001421939f, 0.000760830f, -0.000323397f, 0.000092546f },
+    { 0.000059106f, -0.000263246f, 0.000758295f, -0.001709934f,
+      0.003254906f, -0.005422879f, 0.008043734f, -0.010657401f,
+      0.012441432f, -0.012155586f, 0.008060363f, 0.002343565f,
+      -0.023268150f, 0.064458147f, -0.162607074f, 0.759239912f,
+      0.478184313f, -0.186998919f, 0.106264733f, -0.063985139f,
+      0.037225284f, -0.019523628f, 0.008147689f, -0.001429298f,
+      -0.001944916f, 0.003099062f, -0.002966605f, 0.002256389f,
+      -0.001438796f, 0.000766654f, -0.000324825f, 0.000092811f },
+    { 0.000060996f, -0.000267669f, 0.000765070f, -0.001716010f,
+      0.003252107f, -0.005395521f, 0.007966749f, -0.010495621f,
+      0.012150530f, -0.011684767f, 0.007356244f, 0.003333231f,
+      -0.024592914f, 0.066164404f, -0.164657846f, 0.753974259f,
+      0.485325605f, -0.187809184f, 0.106098078f, -0.063521124f,
+      0.036694240f, -0.019030523f, 0.007740328f, -0.001122312f,
+      -0.002157111f, 0.003233053f, -0.003042993f, 0.002294870f,
+      -0.001455289f, 0.000772261f, -0.000326147f, 0.000093039f },
+    { 0.000062830f, -0.000271945f, 0.000771514f, -0.001721451f,
+      0.003248224f, -0.005366513f, 0.007887517f, -0.010331149f,
+      0.011856945f, -0.011212164f, 0.006652760f, 0.004317368f,
+      -0.025903044f, 0.067838453f, -0.166634947f, 0.748640358f,
+      0.492449731f, -0.188563958f, 0.105895370f, -0.063033856f,
+      0.036148686f, -0.018528946f, 0.007328565f, -0.000813500f,
+      -0.002369661f, 0.003366698f, -0.003118821f, 0.002332833f,
+      -0.001471408f, 0.000777645f, -0.000327363f, 0.000093229f },
+    { 0.000064608f, -0.000276072f, 0.000777630f, -0.001726258f,
+      0.003243265f, -0.005335872f, 0.007806076f, -0.010164055f,
+      0.011560787f, -0.010737943f, 0.005950140f, 0.005295681f,
+      -0.027198188f, 0.069479980f, -0.168538496f, 0.743239343f,
+      0.499555409f, -0.189262584f, 0.105656452f, -0.062523387f,
+      0.035588730f, -0.018019026f, 0.006912518f, -0.000502957f,
+      -0.002582498f, 0.003499953f, -0.003194058f, 0.002370261f,
+      -0.001487145f, 0.000782804f, -0.000328470f, 0.000093380f },
+    { 0.000066331f, -0.000280052f, 0.000783417f, -0.001730436f,
+      0.003237241f, -0.005303619f, 0.007722464f, -0.009994407f,
+      0.011262167f, -0.010262268f, 0.005248613f, 0.006267872f,
+      -0.028478000f, 0.071088642f, -0.170368657f, 0.737772226f,
+      0.506641328f, -0.189904362f, 0.105381213f, -0.061989781f,
+      0.035014495f, -0.017500896f, 0.006492306f, -0.000190780f,
+      -0.002795551f, 0.003632769f, -0.003268676f, 0.002407138f,
+      -0.001502491f, 0.000787732f, -0.000329467f, 0.000093492f },
+    { 0.000067998f, -0.000283883f, 0.000788876f, -0.001733988f,
+      0.003230158f, -0.005269777f, 0.007636723f, -0.009822274f,
+      0.010961196f, -0.009785302f, 0.004548406f, 0.007233651f,
+      -0.029742137f, 0.072664149f, -0.172125578f, 0.732240021f,
+      0.513706207f, -0.190488622f, 0.105069518f, -0.061433092f,
+      0.034426112f, -0.016974693f, 0.006068052f, 0.000122935f,
+      -0.003008748f, 0.003765099f, -0.003342646f, 0.002443448f,
+      -0.001517438f, 0.000792427f, -0.000330351f, 0.000093563f },
+    { 0.000069610f, -0.000287567f, 0.000794009f, -0.001736916f,
+      0.003222028f, -0.005234363f, 0.007548892f, -0.009647726f,
+      0.010657986f, -0.009307209f, 0.003849744f, 0.008192728f,
+      -0.030990267f, 0.074206188f, -0.173809469f, 0.726643860f,
+      0.520748675f, -0.191014722f, 0.104721256f, -0.060853396f,
+      0.033823710f, -0.016440555f, 0.005639878f, 0.000438090f,
+      -0.003222020f, 0.003896894f, -0.003415937f, 0.002479173f,
+      -0.001531978f, 0.000796885f, -0.000331122f, 0.000093594f },
+    { 0.000071167f, -0.000291103f, 0.000798816f, -0.001739226f,
+      0.003212860f, -0.005197402f, 0.007459013f, -0.009470834f,
+      0.010352645f, -0.008828156f, 0.003152851f, 0.009144821f,
+      -0.032222062f, 0.075714476f, -0.175420493f, 0.720984876f,
+      0.527767479f, -0.191481993f, 0.104336344f, -0.060250774f,
+      0.033207420f, -0.015898626f, 0.005207910f, 0.000754586f,
+      -0.003435295f, 0.004028108f, -0.003488521f, 0.002514296f,
+      -0.001546102f, 0.000801100f, -0.000331778f, 0.000093584f },
+    { 0.000072669f, -0.000294492f, 0.000803299f, -0.001740920f,
+      0.003202664f, -0.005158913f, 0.007367126f, -0.009291669f,
+      0.010045289f, -0.008348302f, 0.002457950f, 0.010089646f,
+      -0.033437204f, 0.077188745f, -0.176958889f, 0.715264082f,
+      0.534761250f, -0.191889808f, 0.103914686f, -0.059625309f,
+      0.032577392f, -0.015349051f, 0.004772275f, 0.001072323f,
+      -0.003648499f, 0.004158693f, -0.003560369f, 0.002548803f,
+      -0.001559801f, 0.000805071f, -0.000332316f, 0.000093531f },
+    { 0.000074115f, -0.000297734f, 0.000807458f, -0.001742002f,
+      0.003191450f, -0.005118920f, 0.007273273f, -0.009110302f,
+      0.009736027f, -0.007867811f, 0.001765261f, 0.011026926f,
+      -0.034635376f, 0.078628719f, -0.178424880f, 0.709482670f,
+      0.541728795f, -0.192237526f, 0.103456199f, -0.058977097f,
+      0.031933770f, -0.014791979f, 0.004333101f, 0.001391201f,
+      -0.003861563f, 0.004288601f, -0.003631450f, 0.002582677f,
+      -0.001573068f, 0.000808792f, -0.000332736f, 0.000093436f },
+    { 0.000075507f, -0.000300830f, 0.000811296f, -0.001742478f,
+      0.003179229f, -0.005077445f, 0.007177497f, -0.008926804f,
+      0.009424971f, -0.007386847f, 0.001075004f, 0.011956388f,
+      -0.035816275f, 0.080034159f, -0.179818705f, 0.703641653f,
+      0.548668683f, -0.192524552f, 0.102960825f, -0.058306243f,
+      0.031276707f, -0.014227564f, 0.003890521f, 0.001711118f,
+      -0.004074412f, 0.004417785f, -0.003701738f, 0.002615901f,
+      -0.001585894f, 0.000812260f, -0.000333036f, 0.000093297f },
+    { 0.000076844f, -0.000303779f, 0.000814814f, -0.001742351f,
+      0.003166012f, -0.005034510f, 0.007079840f, -0.008741248f,
+      0.009112234f, -0.006905570f, 0.000387395f, 0.012877760f,
+      -0.036979597f, 0.081404820f, -0.181140631f, 0.697742283f,
+      0.555579722f, -0.192750275f, 0.102428503f, -0.057612859f,
+      0.030606357f, -0.013655960f, 0.003444665f, 0.002031971f,
+      -0.004286975f, 0.004546194f, -0.003771201f, 0.002648460f,
+      -0.001598272f, 0.000815472f, -0.000333215f, 0.000093114f },
+    { 0.000078127f, -0.000306583f, 0.000818013f, -0.001741627f,
+      0.003151809f, -0.004990139f, 0.006980346f, -0.008553706f,
+      0.008797929f, -0.006424141f, -0.000297349f, 0.013790778f,
+      -0.038125057f, 0.082740471f, -0.182390928f, 0.691785574f,
+      0.562460542f, -0.192914113f, 0.101859204f, -0.056897059f,
+      0.029922884f, -0.013077324f, 0.002995668f, 0.002353658f,
+      -0.004499177f, 0.004673784f, -0.003839813f, 0.002680337f,
+      -0.001610193f, 0.000818424f, -0.000333270f, 0.000092887f },
+    { 0.000079356f, -0.000309242f, 0.000820895f, -0.001740309f,
+      0.003136634f, -0.004944356f, 0.006879057f, -0.008364251f,
+      0.008482166f, -0.005942721f, -0.000979015f, 0.014695177f,
+      -0.039252367f, 0.084040910f, -0.183569908f, 0.685772836f,
+      0.569309890f, -0.193015456f, 0.101252876f, -0.056158971f,
+      0.029226458f, -0.012491820f, 0.002543667f, 0.002676074f,
+      -0.004710945f, 0.004800505f, -0.003907543f, 0.002711518f,
+      -0.001621650f, 0.000821112f, -0.000333201f, 0.000092614f },
+    { 0.000080531f, -0.000311756f, 0.000823462f, -0.001738403f,
+      0.003120496f, -0.004897185f, 0.006776018f, -0.008172954f,
+      0.008165057f, -0.005461470f, -0.001657391f, 0.015590699f,
+      -0.040361244f, 0.085305922f, -0.184677854f, 0.679705083f,
+      0.576126516f, -0.193053767f, 0.100609511f, -0.055398725f,
+      0.028517246f, -0.011899611f, 0.002088797f, 0.002999115f,
+      -0.004922207f, 0.004926310f, -0.003974364f, 0.002741986f,
+      -0.001632635f, 0.000823533f, -0.000333006f, 0.000092295f },
+    { 0.000081652f, -0.000314126f, 0.000825717f, -0.001735914f,
+      0.003103409f, -0.004848649f, 0.006671273f, -0.007979892f,
+      0.007846716f, -0.004980546f, -0.002332268f, 0.016477091f,
+      -0.041451424f, 0.086535320f, -0.185715109f, 0.673583567f,
+      0.582909048f, -0.193028465f, 0.099929102f, -0.054616474f,
+      0.027795430f, -0.011300865f, 0.001631199f, 0.003322676f,
+      -0.005132888f, 0.005051152f, -0.004040247f, 0.002771726f,
+      -0.001643141f, 0.000825684f, -0.000332684f, 0.000091930f },
+    { 0.000082720f, -0.000316353f, 0.000827659f, -0.001732848f,
+      0.003085384f, -0.004798774f, 0.006564866f, -0.007785136f,
+      0.007527253f, -0.004500108f, -0.003003437f, 0.017354101f,
+      -0.042522639f, 0.087728932f, -0.186681986f, 0.667409420f,
+      0.589656293f, -0.192939028f, 0.099211641f, -0.053812355f,
+      0.027061190f, -0.010695751f, 0.001171012f, 0.003646650f,
+      -0.005342915f, 0.005174981f, -0.004105164f, 0.002800722f,
+      -0.001653160f, 0.000827562f, -0.000332233f, 0.000091518f },
+    { 0.000083735f, -0.000318438f, 0.000829293f, -0.001729210f,
+      0.003066434f, -0.004747584f, 0.006456842f, -0.007588760f,
+      0.007206780f, -0.004020312f, -0.003670693f, 0.018221484f,
+      -0.043574635f, 0.088886581f, -0.187578857f, 0.661183834f,
+      0.596366942f, -0.192784905f, 0.098457143f, -0.052986532f,
+      0.026314713f, -0.010084443f, 0.000708378f, 0.003970931f,
+      -0.005552212f, 0.005297752f, -0.004169086f, 0.002828961f,
+      -0.001662684f, 0.000829162f, -0.000331652f, 0.000091059f },
+    { 0.000084697f, -0.000320382f, 0.000830620f, -0.001725005f,
+      0.003046571f, -0.004695105f, 0.006347246f, -0.007390837f,
+      0.006885409f, -0.003541317f, -0.004333832f, 0.019078996f,
+      -0.044607162f, 0.090008110f, -0.188406095f, 0.654908061f,
+      0.603039682f, -0.192565590f, 0.097665638f, -0.052139167f,
+      0.025556192f, -0.009467117f, 0.000243442f, 0.004295412f,
+      -0.005760707f, 0.005419416f, -0.004231986f, 0.002856426f,
+      -0.001671706f, 0.000830483f, -0.000330940f, 0.000090551f },
+    { 0.000085607f, -0.000322184f, 0.000831642f, -0.001720240f,
+      0.003025809f, -0.004641363f, 0.006236125f, -0.007191443f,
+      0.006563252f, -0.003063276f, -0.004992655f, 0.019926403f,
+      -0.045619983f, 0.091093391f, -0.189164072f, 0.648583233f,
+      0.609673321f, -0.192280561f, 0.096837163f, -0.051270436f,
+      0.024785822f, -0.008843950f, -0.000223653f, 0.004619985f,
+      -0.005968325f, 0.005539926f, -0.004293836f, 0.002883103f,
+      -0.001680220f, 0.000831521f, -0.000330096f, 0.000089994f },
+    { 0.000086466f, -0.000323847f, 0.000832363f, -0.001714920f,
+      0.003004161f, -0.004586382f, 0.006123523f, -0.006990651f,
+      0.006240419f, -0.002586344f, -0.005646960f, 0.020763466f,
+      -0.046612859f, 0.092142276f, -0.189853176f, 0.642210603f,
+      0.616266549f, -0.191929355f, 0.095971756f, -0.050380521f,
+      0.024003806f, -0.008215126f, -0.000692761f, 0.004944541f,
+      -0.006174991f, 0.005659235f, -0.004354609f, 0.002908977f,
+      -0.001688218f, 0.000832273f, -0.000329118f, 0.000089389f },
+    { 0.000087273f, -0.000325370f, 0.000832783f, -0.001709051f,
+      0.002981640f, -0.004530190f, 0.006009487f, -0.006788536f,
+      0.005917022f, -0.002110675f, -0.006296553f, 0.021589961f,
+      -0.047585566f, 0.093154661f, -0.190473825f, 0.635791421f,
+      0.622818112f, -0.191511467f, 0.095069490f, -0.049469605f,
+      0.023210349f, -0.007580826f, -0.001163733f, 0.005268972f,
+      -0.006380631f, 0.005777297f, -0.004414277f, 0.002934034f,
+      -0.001695694f, 0.000832735f, -0.000328005f, 0.000088734f },
+    { 0.000088028f, -0.000326756f, 0.000832907f, -0.001702640f,
+      0.002958260f, -0.004472813f, 0.005894063f, -0.006585171f,
+      0.005593169f, -0.001636421f, -0.006941239f, 0.022405662f,
+      -0.048537884f, 0.094130434f, -0.191026434f, 0.629326820f,
+      0.629326820f, -0.191026434f, 0.094130434f, -0.048537884f,
+      0.022405662f, -0.006941239f, -0.001636421f, 0.005593169f,
+      -0.006585171f, 0.005894063f, -0.004472813f, 0.002958260f,
+      -0.001702640f, 0.000832907f, -0.000326756f, 0.000088028f },
+    { 0.000088734f, -0.000328005f, 0.000832735f, -0.001695694f,
+      0.002934034f, -0.004414277f, 0.005777297f, -0.006380631f,
+      0.005268972f, -0.001163733f, -0.007580826f, 0.023210349f,
+      -0.049469605f, 0.095069490f, -0.191511467f, 0.622818112f,
+      0.635791421f, -0.190473825f, 0.093154661f, -0.047585566f,
+      0.021589961f, -0.006296553f, -0.002110675f, 0.005917022f,
+      -0.006788536f, 0.006009487f, -0.004530190f, 0.002981640f,
+      -0.001709051f, 0.000832783f, -0.000325370f, 0.000087273f },
+    { 0.000089389f, -0.000329118f, 0.000832273f, -0.001688218f,
+      0.002908977f, -0.004354609f, 0.005659235f, -0.006174991f,
+      0.004944541f, -0.000692761f, -0.008215126f, 0.024003806f,
+      -0.050380521f, 0.095971756f, -0.191929355f, 0.616266549f,
+      0.642210603f, -0.189853176f, 0.092142276f, -0.046612859f,
+      0.020763466f, -0.005646960f, -0.002586344f, 0.006240419f,
+      -0.006990651f, 0.006123523f, -0.004586382f, 0.003004161f,
+      -0.001714920f, 0.000832363f, -0.000323847f, 0.000086466f },
+    { 0.000089994f, -0.000330096f, 0.000831521f, -0.001680220f,
+      0.002883103f, -0.004293836f, 0.005539926f, -0.005968325f,
+      0.004619985f, -0.000223653f, -0.008843950f, 0.024785822f,
+      -0.051270436f, 0.096837163f, -0.192280561f, 0.609673321f,
+      0.648583233f, -0.189164072f, 0.091093391f, -0.045619983f,
+      0.019926403f, -0.004992655f, -0.003063276f, 0.006563252f,
+      -0.007191443f, 0.006236125f, -0.004641363f, 0.003025809f,
+      -0.001720240f, 0.000831642f, -0.000322184f, 0.000085607f },
+    { 0.000090551f, -0.000330940f, 0.000830483f, -0.001671706f,
+      0.002856426f, -0.004231986f, 0.005419416f, -0.005760707f,
+      0.004295412f, 0.000243442f, -0.009467117f, 0.025556192f,
+      -0.052139167f, 0.097665638f, -0.192565590f, 0.603039682f,
+      0.654908061f, -0.188406095f, 0.090008110f, -0.044607162f,
+      0.019078996f, -0.004333832f, -0.003541317f, 0.006885409f,
+      -0.007390837f, 0.006347246f, -0.004695105f, 0.003046571f,
+      -0.001725005f, 0.000830620f, -0.000320382f, 0.000084697f },
+    { 0.000091059f, -0.000331652f, 0.000829162f, -0.001662684f,
+      0.002828961f, -0.004169086f, 0.005297752f, -0.005552212f,
+      0.003970931f, 0.000708378f, -0.010084443f, 0.026314713f,
+      -0.052986532f, 0.098457143f, -0.192784905f, 0.596366942f,
+      0.661183834f, -0.187578857f, 0.088886581f, -0.043574635f,
+      0.018221484f, -0.003670693f, -0.004020312f, 0.007206780f,
+      -0.007588760f, 0.006456842f, -0.004747584f, 0.003066434f,
+      -0.001729210f, 0.000829293f, -0.000318438f, 0.000083735f },
+    { 0.000091518f, -0.000332233f, 0.000827562f, -0.001653160f,
+      0.002800722f, -0.004105164f, 0.005174981f, -0.005342915f,
+      0.003646650f, 0.001171012f, -0.010695751f, 0.027061190f,
+      -0.053812355f, 0.099211641f, -0.192939028f, 0.589656293f,
+      0.667409420f, -0.186681986f, 0.087728932f, -0.042522639f,
+      0.017354101f, -0.003003437f, -0.004500108f, 0.007527253f,
+      -0.007785136f, 0.006564866f, -0.004798774f, 0.003085384f,
+      -0.001732848f, 0.000827659f, -0.000316353f, 0.000082720f },
+    { 0.000091930f, -0.000332684f, 0.000825684f, -0.001643141f,
+      0.002771726f, -0.004040247f, 0.005051152f, -0.005132888f,
+      0.003322676f, 0.001631199f, -0.011300865f, 0.027795430f,
+      -0.054616474f, 0.099929102f, -0.193028465f, 0.582909048f,
+      0.673583567f, -0.185715109f, 0.086535320f, -0.041451424f,
+      0.016477091f, -0.002332268f, -0.004980546f, 0.007846716f,
+      -0.007979892f, 0.006671273f, -0.004848649f, 0.003103409f,
+      -0.001735914f, 0.000825717f, -0.000314126f, 0.000081652f },
+    { 0.000092295f, -0.000333006f, 0.000823533f, -0.001632635f,
+      0.002741986f, -0.003974364f, 0.004926310f, -0.004922207f,
+      0.002999115f, 0.002088797f, -0.011899611f, 0.028517246f,
+      -0.055398725f, 0.100609511f, -0.193053767f, 0.576126516f,
+      0.679705083f, -0.184677854f, 0.085305922f, -0.040361244f,
+      0.015590699f, -0.001657391f, -0.005461470f, 0.008165057f,
+      -0.008172954f, 0.006776018f, -0.004897185f, 0.003120496f,
+      -0.001738403f, 0.000823462f, -0.000311756f, 0.000080531f },
+    { 0.000092614f, -0.000333201f, 0.000821112f, -0.001621650f,
+      0.002711518f, -0.003907543f, 0.004800505f, -0.004710945f,
+      0.002676074f, 0.002543667f, -0.012491820f, 0.029226458f,
+      -0.056158971f, 0.101252876f, -0.193015456f, 0.569309890f,
+      0.685772836f, -0.183569908f, 0.084040910f, -0.039252367f,
+      0.014695177f, -0.000979015f, -0.005942721f, 0.008482166f,
+      -0.008364251f, 0.006879057f, -0.004944356f, 0.003136634f,
+      -0.001740309f, 0.000820895f, -0.000309242f, 0.000079356f },
+    { 0.000092887f, -0.000333270f, 0.000818424f, -0.001610193f,
+      0.002680337f, -0.003839813f, 0.004673784f, -0.004499177f,
+      0.002353658f, 0.002995668f, -0.013077324f, 0.029922884f,
+      -0.056897059f, 0.101859204f, -0.192914113f, 0.562460542f,
+      0.691785574f, -0.182390928f, 0.082740471f, -0.038125057f,
+      0.013790778f, -0.000297349f, -0.006424141f, 0.008797929f,
+      -0.008553706f, 0.006980346f, -0.004990139f, 0.003151809f,
+      -0.001741627f, 0.000818013f, -0.000306583f, 0.000078127f },
+    { 0.000093114f, -0.000333215f, 0.000815472f, -0.001598272f,
+      0.002648460f, -0.003771201f, 0.004546194f, -0.004286975f,
+      0.002031971f, 0.003444665f, -0.013655960f, 0.030606357f,
+      -0.057612859f, 0.102428503f, -0.192750275f, 0.555579722f,
+      0.697742283f, -0.181140631f, 0.081404820f, -0.036979597f,
+      0.012877760f, 0.000387395f, -0.006905570f, 0.009112234f,
+      -0.008741248f, 0.007079840f, -0.005034510f, 0.003166012f,
+      -0.001742351f, 0.000814814f, -0.000303779f, 0.000076844f },
+    { 0.000093297f, -0.000333036f, 0.000812260f, -0.001585894f,
+      0.002615901f, -0.003701738f, 0.004417785f, -0.004074412f,
+      0.001711118f, 0.003890521f, -0.014227564f, 0.031276707f,
+      -0.058306243f, 0.102960825f, -0.192524552f, 0.548668683f,
+      0.703641653f, -0.179818705f, 0.080034159f, -0.035816275f,
+      0.011956388f, 0.001075004f, -0.007386847f, 0.009424971f,
+      -0.008926804f, 0.007177497f, -0.005077445f, 0.003179229f,
+      -0.001742478f, 0.000811296f, -0.000300830f, 0.000075507f },
+    { 0.000093436f, -0.000332736f, 0.000808792f, -0.001573068f,
+      0.002582677f, -0.003631450f, 0.004288601f, -0.003861563f,
+      0.001391201f, 0.004333101f, -0.014791979f, 0.031933770f,
+      -0.058977097f, 0.103456199f, -0.192237526f, 0.541728795f,
+      0.709482670f, -0.178424880f, 0.078628719f, -0.034635376f,
+      0.011026926f, 0.001765261f, -0.007867811f, 0.009736027f,
+      -0.009110302f, 0.007273273f, -0.005118920f, 0.003191450f,
+      -0.001742002f, 0.000807458f, -0.000297734f, 0.000074115f },
+    { 0.000093531f, -0.000332316f, 0.000805071f, -0.001559801f,
+      0.002548803f, -0.003560369f, 0.004158693f, -0.003648499f,
+      0.001072323f, 0.004772275f, -0.015349051f, 0.032577392f,
+      -0.059625309f, 0.103914686f, -0.191889808f, 0.534761250f,
+      0.715264082f, -0.176958889f, 0.077188745f, -0.033437204f,
+      0.010089646f, 0.002457950f, -0.008348302f, 0.010045289f,
+      -0.009291669f, 0.007367126f, -0.005158913f, 0.003202664f,
+      -0.001740920f, 0.000803299f, -0.000294492f, 0.000072669f },
+    { 0.000093584f, -0.000331778f, 0.000801100f, -0.001546102f,
+      0.002514296f, -0.003488521f, 0.004028108f, -0.003435295f,
+      0.000754586f, 0.005207910f, -0.015898626f, 0.033207420f,
+      -0.060250774f, 0.104336344f, -0.191481993f, 0.527767479f,
+      0.720984876f, -0.175420493f, 0.075714476f, -0.032222062f,
+      0.009144821f, 0.003152851f, -0.008828156f, 0.010352645f,
+      -0.009470834f, 0.007459013f, -0.005197402f, 0.003212860f,
+      -0.001739226f, 0.000798816f, -0.000291103f, 0.000071167f },
+    { 0.000093594f, -0.000331122f, 0.000796885f, -0.001531978f,
+      0.002479173f, -0.003415937f, 0.003896894f, -0.003222020f,
+      0.000438090f, 0.005639878f, -0.016440555f, 0.033823710f,
+      -0.060853396f, 0.104721256f, -0.191014722f, 0.520748675f,
+      0.726643860f, -0.173809469f, 0.074206188f, -0.030990267f,
+      0.008192728f, 0.003849744f, -0.009307209f, 0.010657986f,
+      -0.009647726f, 0.007548892f, -0.005234363f, 0.003222028f,
+      -0.001736916f, 0.000794009f, -0.000287567f, 0.000069610f },
+    { 0.000093563f, -0.000330351f, 0.000792427f, -0.001517438f,
+      0.002443448f, -0.003342646f, 0.003765099f, -0.003008748f,
+      0.000122935f, 0.006068052f, -0.016974693f, 0.034426112f,
+      -0.061433092f, 0.105069518f, -0.190488622f, 0.513706207f,
+      0.732240021f, -0.172125578f, 0.072664149f, -0.029742137f,
+      0.007233651f, 0.004548406f, -0.009785302f, 0.010961196f,
+      -0.009822274f, 0.007636723f, -0.005269777f, 0.003230158f,
+      -0.001733988f, 0.000788876f, -0.000283883f, 0.000067998f },
+    { 0.000093492f, -0.000329467f, 0.000787732f, -0.001502491f,
+      0.002407138f, -0.003268676f, 0.003632769f, -0.002795551f,
+      -0.000190780f, 0.006492306f, -0.017500896f, 0.035014495f,
+      -0.061989781f, 0.105381213f, -0.189904362f, 0.506641328f,
+      0.737772226f, -0.170368657f, 0.071088642f, -0.028478000f,
+      0.006267872f, 0.005248613f, -0.010262268f, 0.011262167f,
+      -0.009994407f, 0.007722464f, -0.005303619f, 0.003237241f,
+      -0.001730436f, 0.000783417f, -0.000280052f, 0.000066331f },
+    { 0.000093380f, -0.000328470f, 0.000782804f, -0.001487145f,
+      0.002370261f, -0.003194058f, 0.003499953f, -0.002582498f,
+      -0.000502957f, 0.006912518f, -0.018019026f, 0.035588730f,
+      -0.062523387f, 0.105656452f, -0.189262584f, 0.499555409f,
+      0.743239343f, -0.168538496f, 0.069479980f, -0.027198188f,
+      0.005295681f, 0.005950140f, -0.010737943f, 0.011560787f,
+      -0.010164055f, 0.007806076f, -0.005335872f, 0.003243265f,
+      -0.001726258f, 0.000777630f, -0.000276072f, 0.000064608f },
+    { 0.000093229f, -0.000327363f, 0.000777645f, -0.001471408f,
+      0.002332833f, -0.003118821f, 0.003366698f, -0.002369661f,
+      -0.000813500f, 0.007328565f, -0.018528946f, 0.036148686f,
+      -0.063033856f, 0.105895370f, -0.188563958f, 0.492449731f,
+      0.748640358f, -0.166634947f, 0.067838453f, -0.025903044f,
+      0.004317368f, 0.006652760f, -0.011212164f, 0.011856945f,
+      -0.010331149f, 0.007887517f, -0.005366513f, 0.003248224f,
+      -0.001721451f, 0.000771514f, -0.000271945f, 0.000062830f },
+    { 0.000093039f, -0.000326147f, 0.000772261f, -0.001455289f,
+      0.002294870f, -0.003042993f, 0.003233053f, -0.002157111f,
+      -0.001122312f, 0.007740328f, -0.019030523f, 0.036694240f,
+      -0.063521124f, 0.106098078f, -0.187809184f, 0.485325605f,
+      0.753974259f, -0.164657846f, 0.066164404f, -0.024592914f,
+      0.003333231f, 0.007356244f, -0.011684767f, 0.012150530f,
+      -0.010495621f, 0.007966749f, -0.005395521f, 0.003252107f,
+      -0.001716010f, 0.000765070f, -0.000267669f, 0.000060996f },
+    { 0.000092811f, -0.000324825f, 0.000766654f, -0.001438796f,
+      0.002256389f, -0.002966605f, 0.003099062f, -0.001944916f,
+      -0.001429298f, 0.008147689f, -0.019523628f, 0.037225284f,
+      -0.063985139f, 0.106264733f, -0.186998919f, 0.478184313f,
+      0.759239912f, -0.162607074f, 0.064458147f, -0.023268150f,
+      0.002343565f, 0.008060363f, -0.012155586f, 0.012441432f,
+      -0.010657401f, 0.008043734f, -0.005422879f, 0.003254906f,
+      -0.001709934f, 0.000758295f, -0.000263246f, 0.000059106f },
+    { 0.000092546f, -0.000323397f, 0.000760830f, -0.001421939f,
+      0.002217407f, -0.002889686f, 0.002964776f, -0.001733148f,
+      -0.001734365f, 0.008550531f, -0.020008134f, 0.037741698f,
+      -0.064425871f, 0.106395476f, -0.186133876f, 0.471027225f,
+      0.764436364f, -0.160482511f, 0.062720053f, -0.021929113f,
+      0.001348673f, 0.008764887f, -0.012624457f, 0.012729541f,
+      -0.010816421f, 0.008118433f, -0.005448568f, 0.003256614f,
+      -0.001703219f, 0.000751191f, -0.000258674f, 0.000057161f },
+    { 0.000092245f, -0.000321866f, 0.000754793f, -0.001404726f,
+      0.002177941f, -0.002812265f, 0.002830239f, -0.001521873f,
+      -0.002037419f, 0.008948743f, -0.020483918f, 0.038243383f,
+      -0.064843282f, 0.106490478f, -0.185214773f, 0.463855594f,
+      0.769562542f, -0.158284053f, 0.060950454f, -0.020576168f,
+      0.000348859f, 0.009469584f, -0.013091214f, 0.013014748f,
+      -0.010972616f, 0.008190808f, -0.005472566f, 0.003257221f,
+      -0.001695863f, 0.000743756f, -0.000253955f, 0.000055161f },
+    { 0.000091908f, -0.000320234f, 0.000748546f, -0.001387166f,
+      0.002138008f, -0.002734372f, 0.002695499f, -0.001311162f,
+      -0.002338369f, 0.009342212f, -0.020950863f, 0.038730238f,
+      -0.065237351f, 0.106549904f, -0.184242323f, 0.456670791f,
+      0.774617493f, -0.156011611f, 0.059149742f, -0.019209690f,
+      -0.000655570f, 0.010174219f, -0.013555694f, 0.013296943f,
+      -0.011125918f, 0.008260822f, -0.005494858f, 0.003256721f,
+      -0.001687864f, 0.000735990f, -0.000249088f, 0.000053105f },
+    { 0.000091536f, -0.000318502f, 0.000742094f, -0.001369268f,
+      0.002097625f, -0.002656036f, 0.002560603f, -0.001101081f,
+      -0.002637124f, 0.009730829f, -0.021408850f, 0.039202169f,
+      -0.065608047f, 0.106573932f, -0.183217242f, 0.449474066f,
+      0.779600203f, -0.153665125f, 0.057318285f, -0.017830055f,
+      -0.001664302f, 0.010878562f, -0.014017731f, 0.013576020f,
+      -0.011276261f, 0.008328439f, -0.005515425f, 0.003255106f,
+      -0.001679220f, 0.000727893f, -0.000244073f, 0.000050994f },
+    { 0.000091130f, -0.000316672f, 0.000735442f, -0.001351041f,
+      0.002056808f, -0.002577286f, 0.002425597f, -0.000891698f,
+      -0.002933596f, 0.010114485f, -0.021857768f, 0.039659083f,
+      -0.065955371f, 0.106562763f, -0.182140276f, 0.442266792f,
+      0.784509659f, -0.151244566f, 0.055456478f, -0.016437650f,
+      -0.002677026f, 0.011582375f, -0.014477161f, 0.013851868f,
+      -0.011423579f, 0.008393624f, -0.005534249f, 0.003252370f,
+      -0.001669928f, 0.000719465f, -0.000238911f, 0.000048827f },
+    { 0.000090690f, -0.000314746f, 0.000728592f, -0.001332494f,
+      0.002015575f, -0.002498153f, 0.002290527f, -0.000683080f,
+      -0.003227694f, 0.010493076f, -0.022297507f, 0.040100902f,
+      -0.066279322f, 0.106516600f, -0.181012169f, 0.435050219f,
+      0.789344966f, -0.148749858f, 0.053564731f, -0.015032865f,
+      -0.003693426f, 0.012285423f, -0.014933818f, 0.014124381f,
+      -0.011567809f, 0.008456340f, -0.005551315f, 0.003248506f,
+      -0.001659988f, 0.000710706f, -0.000233603f, 0.000046605f },
+    { 0.000090217f, -0.000312726f, 0.000721551f, -0.001313636f,
+      0.001973944f, -0.002418665f, 0.002155439f, -0.000475293f,
+      -0.003519334f, 0.010866500f, -0.022727963f, 0.040527537f,
+      -0.066579901f, 0.106435642f, -0.179833665f, 0.427825689f,
+      0.794105172f, -0.146181032f, 0.051643457f, -0.013616095f,
+      -0.004713182f, 0.012987470f, -0.015387539f, 0.014393453f,
+      -0.011708886f, 0.008516553f, -0.005566605f, 0.003243508f,
+      -0.001649397f, 0.000701616f, -0.000228148f, 0.000044329f },
+    { 0.000089713f, -0.000310613f, 0.000714322f, -0.001294476f,
+      0.001931930f, -0.002338851f, 0.002020379f, -0.000268403f,
+      -0.003808429f, 0.011234652f, -0.023149032f, 0.040938925f,
+      -0.066857114f, 0.106320128f, -0.178605542f, 0.420594513f,
+      0.798789263f, -0.143538058f, 0.049693085f, -0.012187744f,
+      -0.005735975f, 0.013688279f, -0.015838159f, 0.014658978f,
+      -0.011846748f, 0.008574231f, -0.005580105f, 0.003237371f,
+      -0.001638156f, 0.000692196f, -0.000222548f, 0.000041997f },
+    { 0.000089177f, -0.000308411f, 0.000706909f, -0.001275024f,
+      0.001889552f, -0.002258741f, 0.001885393f, -0.000062473f,
+      -0.004094894f, 0.011597437f, -0.023560617f, 0.041334994f,
+      -0.067110993f, 0.106170274f, -0.177328557f, 0.413357973f,
+      0.803396344f, -0.140820965f, 0.047714055f, -0.010748221f,
+      -0.006761481f, 0.014387613f, -0.016285514f, 0.014920850f,
+      -0.011981333f, 0.008629338f, -0.005591799f, 0.003230087f,
+      -0.001626261f, 0.000682446f, -0.000216802f, 0.000039612f },
+    { 0.000088611f, -0.000306120f, 0.000699318f, -0.001255287f,
+      0.001846825f, -0.002178364f, 0.001750525f, 0.000142430f,
+      -0.004378646f, 0.011954756f, -0.023962623f, 0.041715678f,
+      -0.067341566f, 0.105986327f, -0.176003501f, 0.406117409f,
+      0.807925582f, -0.138029784f, 0.045706812f, -0.009297936f,
+      -0.007789374f, 0.015085232f, -0.016729441f, 0.015178965f,
+      -0.012112577f, 0.008681844f, -0.005601671f, 0.003221654f,
+      -0.001613714f, 0.000672367f, -0.000210911f, 0.000037172f },
+    { 0.000088015f, -0.000303743f, 0.000691552f, -0.001235277f,
+      0.001803769f, -0.002097748f, 0.001615821f, 0.000346244f,
+      -0.004659602f, 0.012306517f, -0.024354959f, 0.042080924f,
+      -0.067548856f, 0.105768532f, -0.174631134f, 0.398874074f,
+      0.812376022f, -0.135164574f, 0.043671828f, -0.007837312f,
+      -0.008819327f, 0.015780898f, -0.017169777f, 0.015433219f,
+      -0.012240422f, 0.008731716f, -0.005609709f, 0.003212066f,
+      -0.001600513f, 0.000661960f, -0.000204877f, 0.000034678f },
+    { 0.000087391f, -0.000301281f, 0.000683616f, -0.001215001f,
+      0.001760399f, -0.002016924f, 0.001481325f, 0.000548906f,
+      -0.004937684f, 0.012652626f, -0.024737535f, 0.042430677f,
+      -0.067732908f, 0.105517156f, -0.173212260f, 0.391629279f,
+      0.816746771f, -0.132225394f, 0.041609567f, -0.006366771f,
+      -0.009851009f, 0.016474374f, -0.017606361f, 0.015683509f,
+      -0.012364808f, 0.008778923f, -0.005615898f, 0.003201318f,
+      -0.001586658f, 0.000651224f, -0.000198699f, 0.000032130f },
+    { 0.000086738f, -0.000298737f, 0.000675514f, -0.001194469f,
+      0.001716733f, -0.001935919f, 0.001347081f, 0.000750354f,
+      -0.005212811f, 0.012992995f, -0.025110271f, 0.042764891f,
+      -0.067893781f, 0.105232462f, -0.171747684f, 0.384384364f,
+      0.821036994f, -0.129212350f, 0.039520517f, -0.004886744f,
+      -0.010884088f, 0.017165417f, -0.018039027f, 0.015929732f,
+      -0.012485675f, 0.008823436f, -0.005620226f, 0.003189407f,
+      -0.001572149f, 0.000640162f, -0.000192379f, 0.000029529f },
+    { 0.000086059f, -0.000296112f, 0.000667251f, -0.001173691f,
+      0.001672788f, -0.001854763f, 0.001213134f, 0.000950526f,
+      -0.005484905f, 0.013327534f, -0.025473082f, 0.043083526f,
+      -0.068031527f, 0.104914725f, -0.170238197f, 0.377140552f,
+      0.825245857f, -0.126125544f, 0.037405174f, -0.003397666f,
+      -0.011918232f, 0.017853789f, -0.018467618f, 0.016171789f,
+      -0.012602964f, 0.008865224f, -0.005622680f, 0.003176329f,
+      -0.001556986f, 0.000628775f, -0.000185918f, 0.000026875f },
+    { 0.000085352f, -0.000293409f, 0.000658832f, -0.001152675f,
+      0.001628582f, -0.001773484f, 0.001079527f, 0.001149362f,
+      -0.005753889f, 0.013656160f, -0.025825894f, 0.043386541f,
+      -0.068146206f, 0.104564235f, -0.168684617f, 0.369899154f,
+      0.829372466f, -0.122965083f, 0.035264045f, -0.001899976f,
+      -0.012953103f, 0.018539250f, -0.018891970f, 0.016409578f,
+      -0.012716620f, 0.008904259f, -0.005623248f, 0.003162081f,
+      -0.001541170f, 0.000617063f, -0.000179315f, 0.000024169f },
+    { 0.000084621f, -0.000290629f, 0.000650262f, -0.001131432f,
+      0.001584130f, -0.001692110f, 0.000946304f, 0.001346801f,
+      -0.006019690f, 0.013978790f, -0.026168631f, 0.043673910f,
+      -0.068237893f, 0.104181282f, -0.167087778f, 0.362661451f,
+      0.833416104f, -0.119731113f, 0.033097643f, -0.000394120f,
+      -0.013988364f, 0.019221561f, -0.019311924f, 0.016642999f,
+      -0.012826587f, 0.008940513f, -0.005621919f, 0.003146661f,
+      -0.001524701f, 0.000605029f, -0.000172574f, 0.000021410f },
+    { 0.000083864f, -0.000287775f, 0.000641543f, -0.001109970f,
+      0.001539451f, -0.001610670f, 0.000813507f, 0.001542784f,
+      -0.006282231f, 0.014295342f, -0.026501229f, 0.043945603f,
+      -0.068306662f, 0.103766173f, -0.165448472f, 0.355428755f,
+      0.837375879f, -0.116423801f, 0.030906502f, 0.001119454f,
+      -0.015023675f, 0.019900482f, -0.019727321f, 0.016871957f,
+      -0.012932808f, 0.008973959f, -0.005618682f, 0.003130065f,
+      -0.001507581f, 0.000592673f, -0.000165693f, 0.000018600f },
+    { 0.000083083f, -0.000284848f, 0.000632683f, -0.001088298f,
+      0.001494561f, -0.001529193f, 0.000681178f, 0.001737253f,
+      -0.006541443f, 0.014605740f, -0.026823616f, 0.044201601f,
+      -0.068352602f, 0.103319213f, -0.163767561f, 0.348202288f,
+      0.841251016f, -0.113043308f, 0.028691158f, 0.002640289f,
+      -0.016058696f, 0.020575771f, -0.020138003f, 0.017096352f,
+      -0.013035230f, 0.009004570f, -0.005613527f, 0.003112292f,
+      -0.001489809f, 0.000579997f, -0.000158676f, 0.000015738f },
+    { 0.000082279f, -0.000281851f, 0.000623684f, -0.001066426f,
+      0.001449477f, -0.001447705f, 0.000549361f, 0.001930150f,
+      -0.006797253f, 0.014909907f, -0.027135732f, 0.044441890f,
+      -0.068375804f, 0.102840729f, -0.162045851f, 0.340983361f,
+      0.845040858f, -0.109589830f, 0.026452160f, 0.004167928f,
+      -0.017093087f, 0.021247191f, -0.020543810f, 0.017316088f,
+      -0.013133801f, 0.009032321f, -0.005606445f, 0.003093340f,
+      -0.001471389f, 0.000567004f, -0.000151522f, 0.000012826f },
+    { 0.000081452f, -0.000278786f, 0.000614551f, -0.001044364f,
+      0.001404216f, -0.001366235f, 0.000418096f, 0.002121419f,
+      -0.007049592f, 0.015207770f, -0.027437519f, 0.044666458f,
+      -0.068376370f, 0.102331042f, -0.160284206f, 0.333773196f,
+      0.848744512f, -0.106063582f, 0.024190068f, 0.005701907f,
+      -0.018126501f, 0.021914503f, -0.020944590f, 0.017531071f,
+      -0.013228467f, 0.009057187f, -0.005597427f, 0.003073208f,
+      -0.001452320f, 0.000553694f, -0.000144233f, 0.000009864f },
+    { 0.000080604f, -0.000275654f, 0.000605290f, -0.001022120f,
+      0.001358796f, -0.001284811f, 0.000287425f, 0.002311003f,
+      -0.007298393f, 0.015499259f, -0.027728923f, 0.044875301f,
+      -0.068354398f, 0.101790495f, -0.158483475f, 0.326573104f,
+      0.852361262f, -0.102464788f, 0.021905454f, 0.007241758f,
+      -0.019158596f, 0.022577465f, -0.021340182f, 0.017741207f,
+      -0.013319177f, 0.009079146f, -0.005586464f, 0.003051896f,
+      -0.001432606f, 0.000540070f, -0.000136810f, 0.000006852f },
+    { 0.000079735f, -0.000272458f, 0.000595904f, -0.000999704f,
+      0.001313232f, -0.001203461f, 0.000157389f, 0.002498848f,
+      -0.007543589f, 0.015784305f, -0.028009890f, 0.045068420f,
+      -0.068310015f, 0.101219423f, -0.156644493f, 0.319384277f,
+      0.855890512f, -0.098793693f, 0.019598896f, 0.008787009f,
+      -0.020189025f, 0.023235839f, -0.021730434f, 0.017946402f,
+      -0.013405882f, 0.009098173f, -0.005573548f, 0.003029403f,
+      -0.001412248f, 0.000526135f, -0.000129256f, 0.000003791f },
+    { 0.000078846f, -0.000269200f, 0.000586399f, -0.000977126f,
+      0.001267542f, -0.001122210f, 0.000028029f, 0.002684898f,
+      -0.007785115f, 0.016062843f, -0.028280374f, 0.045245819f,
+      -0.068243325f, 0.100618184f, -0.154768109f, 0.312208027f,
+      0.859331429f, -0.095050551f, 0.017270986f, 0.010337184f,
+      -0.021217439f, 0.023889389f, -0.022115191f, 0.018146567f,
+      -0.013488532f, 0.009114247f, -0.005558674f, 0.003005728f,
+      -0.001391249f, 0.000511889f, -0.000121570f, 0.000000682f },
+    { 0.000077937f, -0.000265881f, 0.000576778f, -0.000954393f,
+      0.001221742f, -0.001041087f, -0.000100617f, 0.002869102f,
+      -0.008022907f, 0.016334808f, -0.028540332f, 0.045407508f,
+      -0.068154462f, 0.099987127f, -0.152855203f, 0.305045545f,
+      0.862683356f, -0.091235653f, 0.014922327f, 0.011891804f,
+      -0.022243496f, 0.024537876f, -0.022494305f, 0.018341610f,
+      -0.013567081f, 0.009127346f, -0.005541834f, 0.002980873f,
+      -0.001369611f, 0.000497337f, -0.000113756f, -0.000002475f },
+    { 0.000077010f, -0.000262505f, 0.000567048f, -0.000931517f,
+      0.001175850f, -0.000960119f, -0.000228507f, 0.003051406f,
+      -0.008256906f, 0.016600139f, -0.028789721f, 0.045553505f,
+      -0.068043552f, 0.099326633f, -0.150906622f, 0.297898084f,
+      0.865945697f, -0.087349296f, 0.012553528f, 0.013450384f,
+      -0.023266843f, 0.025181064f, -0.022867618f, 0.018531444f,
+      -0.013641481f, 0.009137450f, -0.005523022f, 0.002954838f,
+      -0.001347337f, 0.000482481f, -0.000105814f, -0.000005678f },
+    { 0.000076065f, -0.000259072f, 0.000557212f, -0.000908505f,
+      0.001129881f, -0.000879332f, -0.000355604f, 0.003231759f,
+      -0.008487049f, 0.016858779f, -0.029028507f, 0.045683827f,
+      -0.067910746f, 0.098637067f, -0.148923263f, 0.290766865f,
+      0.869117737f, -0.083391778f, 0.010165210f, 0.015012437f,
+      -0.024287131f, 0.025818715f, -0.023234986f, 0.018715980f,
+      -0.013711688f, 0.009144540f, -0.005502234f, 0.002927625f,
+      -0.001324430f, 0.000467322f, -0.000097745f, -0.000008929f },
+    { 0.000075104f, -0.000255585f, 0.000547274f, -0.000885368f,
+      0.001083851f, -0.000798752f, -0.000481868f, 0.003410110f,
+      -0.008713278f, 0.017110672f, -0.029256655f, 0.045798503f,
+      -0.067756183f, 0.097918808f, -0.146905959f, 0.283653080f,
+      0.872198820f, -0.079363450f, 0.007758004f, 0.016577471f,
+      -0.025304010f, 0.026450593f, -0.023596259f, 0.018895131f,
+      -0.013777657f, 0.009148598f, -0.005479465f, 0.002899235f,
+      -0.001300894f, 0.000451865f, -0.000089553f, -0.000012224f },
+    { 0.000074126f, -0.000252046f, 0.000537240f, -0.000862114f,
+      0.001037778f, -0.000718407f, -0.000607261f, 0.003586409f,
+      -0.008935536f, 0.017355762f, -0.029474139f, 0.045897566f,
+      -0.067580014f, 0.097172245f, -0.144855604f, 0.276558012f,
+      0.875188410f, -0.075264655f, 0.005332550f, 0.018144993f,
+      -0.026317133f, 0.027076468f, -0.023951286f, 0.019068815f,
+      -0.013839345f, 0.009149605f, -0.005454712f, 0.002869670f,
+      -0.001276731f, 0.000436111f, -0.000081238f, -0.000015565f },
+    { 0.000073133f, -0.000248457f, 0.000527114f, -0.000838753f,
+      0.000991678f, -0.000638321f, -0.000731747f, 0.003760608f,
+      -0.009153768f, 0.017594000f, -0.029680930f, 0.045981046f,
+      -0.067382395f, 0.096397772f, -0.142773077f, 0.269482821f,
+      0.878085911f, -0.071095750f, 0.002889497f, 0.019714504f,
+      -0.027326146f, 0.027696101f, -0.024299927f, 0.019236946f,
+      -0.013896711f, 0.009147547f, -0.005427970f, 0.002838933f,
+      -0.001251947f, 0.000420065f, -0.000072803f, -0.000018949f },
+    { 0.000072125f, -0.000244820f, 0.000516901f, -0.000815293f,
+      0.000945566f, -0.000558521f, -0.000855287f, 0.003932660f,
+      -0.009367920f, 0.017825339f, -0.029877009f, 0.046048984f,
+      -0.067163497f, 0.095595792f, -0.140659273f, 0.262428701f,
+      0.880890667f, -0.066857137f, 0.000429505f, 0.021285506f,
+      -0.028330700f, 0.028309261f, -0.024642035f, 0.019399446f,
+      -0.013949714f, 0.009142406f, -0.005399238f, 0.002807027f,
+      -0.001226544f, 0.000403729f, -0.000064249f, -0.000022377f },
+    { 0.000071104f, -0.000241137f, 0.000506605f, -0.000791744f,
+      0.000899459f, -0.000479032f, -0.000977846f, 0.004102516f,
+      -0.009577941f, 0.018049730f, -0.030062353f, 0.046101432f,
+      -0.066923492f, 0.094766706f, -0.138515040f, 0.255396843f,
+      0.883602142f, -0.062549196f, -0.002046759f, 0.022857493f,
+      -0.029330444f, 0.028915720f, -0.024977466f, 0.019556230f,
+      -0.013998315f, 0.009134169f, -0.005368514f, 0.002773955f,
+      -0.001200528f, 0.000387107f, -0.000055578f, -0.000025847f },
+    { 0.000070069f, -0.000237411f, 0.000496231f, -0.000768115f,
+      0.000853372f, -0.000399879f, -0.001099387f, 0.004270131f,
+      -0.009783778f, 0.018267132f, -0.030236954f, 0.046138432f,
+      -0.066662543f, 0.093910940f, -0.136341289f, 0.248388454f,
+      0.886219859f, -0.058172364f, -0.004538617f, 0.024429956f,
+      -0.030325027f, 0.029515244f, -0.025306081f, 0.019707222f,
+      -0.014042475f, 0.009122822f, -0.005335796f, 0.002739721f,
+      -0.001173902f, 0.000370202f, -0.000046793f, -0.000029358f },
+    { 0.000069022f, -0.000233642f, 0.000485784f, -0.000744415f,
+      0.000807322f, -0.000321087f, -0.001219875f, 0.004435461f,
+      -0.009985385f, 0.018477501f, -0.030400796f, 0.046160046f,
+      -0.066380851f, 0.093028896f, -0.134138912f, 0.241404682f,
+      0.888743222f, -0.053727068f, -0.007045383f, 0.026002390f,
+      -0.031314097f, 0.030107604f, -0.025627740f, 0.019852344f,
+      -0.014082159f, 0.009108352f, -0.005301085f, 0.002704330f,
+      -0.001146673f, 0.000353018f, -0.000037895f, -0.000032910f },
+    { 0.000067964f, -0.000229834f, 0.000475267f, -0.000720653f,
+      0.000761324f, -0.000242681f, -0.001339275f, 0.004598462f,
+      -0.010182711f, 0.018680803f, -0.030553874f, 0.046166334f,
+      -0.066078588f, 0.092121020f, -0.131908789f, 0.234446689f,
+      0.891171753f, -0.049213763f, -0.009566363f, 0.027574282f,
+      -0.032297306f, 0.030692575f, -0.025942305f, 0.019991523f,
+      -0.014117331f, 0.009090746f, -0.005264380f, 0.002667786f,
+      -0.001118844f, 0.000335559f, -0.000028887f, -0.000036501f },
+    { 0.000066895f, -0.000225988f, 0.000464686f, -0.000696837f,
+      0.000715394f, -0.000164686f, -0.001457553f, 0.004759090f,
+      -0.010375713f, 0.018876998f, -0.030696182f, 0.046157356f,
+      -0.065755956f, 0.091187730f, -0.129651800f, 0.227515638f,
+      0.893504977f, -0.044632919f, -0.012100851f, 0.029145116f,
+      -0.033274300f, 0.031269930f, -0.026249640f, 0.020124683f,
+      -0.014147958f, 0.009069996f, -0.005225683f, 0.002630093f,
+      -0.001090421f, 0.000317829f, -0.000019771f, -0.000040131f },
+    { 0.000065816f, -0.000222106f, 0.000454046f, -0.000672977f,
+      0.000669547f, -0.000087125f, -0.001574675f, 0.004917304f,
+      -0.010564347f, 0.019066056f, -0.030827722f, 0.046133187f,
+      -0.065413155f, 0.090229467f, -0.127368867f, 0.220612675f,
+      0.895742416f, -0.039985023f, -0.014648138f, 0.030714378f,
+      -0.034244731f, 0.031839445f, -0.026549609f, 0.020251751f,
+      -0.014174007f, 0.009046092f, -0.005184995f, 0.002591259f,
+      -0.001061410f, 0.000299831f, -0.000010549f, -0.000043798f },
+    { 0.000064727f, -0.000218190f, 0.000443349f, -0.000649082f,
+      0.000623798f, -0.000010022f, -0.001690608f, 0.005073063f,
+      -0.010748570f, 0.019247944f, -0.030948495f, 0.046093900f,
+      -0.065050393f, 0.089246675f, -0.125060871f, 0.213738918f,
+      0.897883594f, -0.035270583f, -0.017207501f, 0.032281548f,
+      -0.035208251f, 0.032400895f, -0.026842084f, 0.020372659f,
+      -0.014195446f, 0.009019024f, -0.005142319f, 0.002551288f,
+      -0.001031816f, 0.000281570f, -0.000001224f, -0.000047502f },
+    { 0.000063631f, -0.000214243f, 0.000432602f, -0.000625159f,
+      0.000578163f, 0.000066599f, -0.001805320f, 0.005226328f,
+      -0.010928342f, 0.019422634f, -0.031058511f, 0.046039570f,
+      -0.064667881f, 0.088239804f, -0.122728713f, 0.206895515f,
+      0.899928153f, -0.030490112f, -0.019778214f, 0.033846103f,
+      -0.036164515f, 0.032954060f, -0.027126933f, 0.020487336f,
+      -0.014212247f, 0.008988786f, -0.005097657f, 0.002510187f,
+      -0.001001647f, 0.000263050f, 0.000008202f, -0.000051241f },
+    { 0.000062526f, -0.000210265f, 0.000421808f, -0.000601218f,
+      0.000532657f, 0.000142716f, -0.001918777f, 0.005377058f,
+      -0.011103624f, 0.019590100f, -0.031157779f, 0.045970287f,
+      -0.064265825f, 0.087209299f, -0.120373271f, 0.200083569f,
+      0.901875615f, -0.025644153f, -0.022359539f, 0.035407525f,
+      -0.037113164f, 0.033498719f, -0.027404025f, 0.020595716f,
+      -0.014224381f, 0.008955370f, -0.005051013f, 0.002467964f,
+      -0.000970907f, 0.000244276f, 0.000017727f, -0.000055014f },
+    { 0.000061414f, -0.000206260f, 0.000410973f, -0.000577268f,
+      0.000487294f, 0.000218305f, -0.002030950f, 0.005525219f,
+      -0.011274378f, 0.019750321f, -0.031246312f, 0.045886133f,
+      -0.063844457f, 0.086155631f, -0.117995463f, 0.193304196f,
+      0.903725684f, -0.020733263f, -0.024950732f, 0.036965284f,
+      -0.038053863f, 0.034034658f, -0.027673237f, 0.020697737f,
+      -0.014231821f, 0.008918772f, -0.005002392f, 0.002424625f,
+      -0.000939603f, 0.000225251f, 0.000027347f, -0.000058821f },
+    { 0.000060296f, -0.000202229f, 0.000400099f, -0.000553317f,
+      0.000442089f, 0.000293343f, -0.002141807f, 0.005670771f,
+      -0.011440569f, 0.019903274f, -0.031324126f, 0.045787204f,
+      -0.063404001f, 0.085079253f, -0.115596183f, 0.186558470f,
+      0.905477881f, -0.015758010f, -0.027551040f, 0.038518865f,
+      -0.038986258f, 0.034561660f, -0.027934441f, 0.020793330f,
+      -0.014234542f, 0.008878985f, -0.004951798f, 0.002380177f,
+      -0.000907744f, 0.000205982f, 0.000037061f, -0.000062659f },
+    { 0.000059172f, -0.000198174f, 0.000389192f, -0.000529373f,
+      0.000397057f, 0.000367809f, -0.002251318f, 0.005813680f,
+      -0.011602163f, 0.020048941f, -0.031391248f, 0.045673598f,
+      -0.062944688f, 0.083980642f, -0.113176316f, 0.179847494f,
+      0.907131910f, -0.010718983f, -0.030159706f, 0.040067732f,
+      -0.039910011f, 0.035079509f, -0.028187519f, 0.020882437f,
+      -0.014232519f, 0.008836010f, -0.004899238f, 0.002334630f,
+      -0.000875334f, 0.000186473f, 0.000046865f, -0.000066529f },
+    { 0.000058043f, -0.000194097f, 0.000378257f, -0.000505445f,
+      0.000352212f, 0.000441681f, -0.002359454f, 0.005953912f,
+      -0.011759129f, 0.020187307f, -0.031447697f, 0.045545414f,
+      -0.062466759f, 0.082860269f, -0.110736772f, 0.173172325f,
+      0.908687413f, -0.005616787f, -0.032775961f, 0.041611359f,
+      -0.040824771f, 0.035587996f, -0.028432349f, 0.020964999f,
+      -0.014225732f, 0.008789841f, -0.004844718f, 0.002287992f,
+      -0.000842383f, 0.000166728f, 0.000056756f, -0.000070428f },
+    { 0.000056910f, -0.000190000f, 0.000367297f, -0.000481542f,
+      0.000307568f, 0.000514937f, -0.002466185f, 0.006091432f,
+      -0.011911435f, 0.020318359f, -0.031493500f, 0.045402758f,
+      -0.061970457f, 0.081718601f, -0.108278446f, 0.166534036f,
+      0.910144091f, -0.000452043f, -0.035399031f, 0.043149218f,
+      -0.041730203f, 0.036086913f, -0.028668813f, 0.021040957f,
+      -0.014214158f, 0.008740478f, -0.004788246f, 0.002240272f,
+      -0.000808896f, 0.000146753f, 0.000066733f, -0.000074355f },
+    { 0.000055774f, -0.000185884f, 0.000356316f, -0.000457671f,
+      0.000263139f, 0.000587556f, -0.002571485f, 0.006226210f,
+      -0.012059054f, 0.020442087f, -0.031528693f, 0.045245741f,
+      -0.061456021f, 0.080556132f, -0.105802231f, 0.159933671f,
+      0.911501646f, 0.004774611f, -0.038028136f, 0.044680778f,
+      -0.042625964f, 0.036576048f, -0.028896796f, 0.021110257f,
+      -0.014197778f, 0.008687922f, -0.004729828f, 0.002191478f,
+      -0.000774883f, 0.000126553f, 0.000076792f, -0.000078310f },
+    { 0.000054634f, -0.000181752f, 0.000345319f, -0.000433841f,
+      0.000218940f, 0.000659518f, -0.002675324f, 0.006358213f,
+      -0.012201957f, 0.020558480f, -0.031553306f, 0.045074478f,
+      -0.060923714f, 0.079373345f, -0.103309020f, 0.153372273f,
+      0.912759840f, 0.010062520f, -0.040662486f, 0.046205513f,
+      -0.043511715f, 0.037055202f, -0.029116184f, 0.021172844f,
+      -0.014176575f, 0.008632173f, -0.004669475f, 0.002141623f,
+      -0.000740352f, 0.000106134f, 0.000086930f, -0.000082290f },
+    { 0.000053493f, -0.000177606f, 0.000334311f, -0.000410059f,
+      0.000174984f, 0.000730800f, -0.002777676f, 0.006487411f,
+      -0.012340121f, 0.020667536f, -0.031567380f, 0.044889089f,
+      -0.060373783f, 0.078170724f, -0.100799710f, 0.146850869f,
+      0.913918376f, 0.015411017f, -0.043301288f, 0.047722887f,
+      -0.044387117f, 0.037524167f, -0.029326867f, 0.021228667f,
+      -0.014150532f, 0.008573232f, -0.004607196f, 0.002090714f,
+      -0.000705309f, 0.000085500f, 0.000097144f, -0.000086295f },
+    { 0.000052350f, -0.000173447f, 0.000323295f, -0.000386335f,
+      0.000131284f, 0.000801385f, -0.002878515f, 0.006613776f,
+      -0.012473521f, 0.020769250f, -0.031570952f, 0.044689693f,
+      -0.059806492f, 0.076948762f, -0.098275192f, 0.140370473f,
+      0.914977074f, 0.020819413f, -0.045943744f, 0.049232367f,
+      -0.045251835f, 0.037982747f, -0.029528737f, 0.021277675f,
+      -0.014119634f, 0.008511105f, -0.004543000f, 0.002038765f,
+      -0.000669765f, 0.000064657f, 0.000107430f, -0.000090324f },
+    { 0.000051205f, -0.000169278f, 0.000312275f, -0.000362675f,
+      0.000087854f, 0.000871251f, -0.002977815f, 0.006737279f,
+      -0.012602135f, 0.020863619f, -0.031564075f, 0.044476420f,
+      -0.059222106f, 0.075707965f, -0.095736362f, 0.133932069f,
+      0.915935636f, 0.026287008f, -0.048589043f, 0.050733428f,
+      -0.046105541f, 0.038430743f, -0.029721687f, 0.021319823f,
+      -0.014083869f, 0.008445794f, -0.004476898f, 0.001985785f,
+      -0.000633728f, 0.000043612f, 0.000117787f, -0.000094374f },
+    { 0.000050061f, -0.000165100f, 0.000301256f, -0.000339089f,
+      0.000044707f, 0.000940380f, -0.003075551f, 0.006857895f,
+      -0.012725943f, 0.020950649f, -0.031546786f, 0.044249397f,
+      -0.058620900f, 0.074448824f, -0.093184106f, 0.127536669f,
+      0.916794002f, 0.031813085f, -0.051236372f, 0.052225538f,
+      -0.046947896f, 0.038867962f, -0.029905615f, 0.021355065f,
+      -0.014043224f, 0.008377304f, -0.004408903f, 0.001931786f,
+      -0.000597207f, 0.000022370f, 0.000128211f, -0.000098444f },
+    { 0.000048917f, -0.000160914f, 0.000290241f, -0.000315582f,
+      0.000001856f, 0.001008752f, -0.003171700f, 0.006975596f,
+      -0.012844928f, 0.021030342f, -0.031519145f, 0.044008762f,
+      -0.058003142f, 0.073171847f, -0.090619311f, 0.121185243f,
+      0.917551875f, 0.037396908f, -0.053884912f, 0.053708155f,
+      -0.047778577f, 0.039294209f, -0.030080417f, 0.021383354f,
+      -0.013997690f, 0.008305644f, -0.004339026f, 0.001876780f,
+      -0.000560211f, 0.000000936f, 0.000138698f, -0.000102533f },
+    { 0.000047774f, -0.000156723f, 0.000279235f, -0.000292164f,
+      -0.000040686f, 0.001076349f, -0.003266237f, 0.007090359f,
+      -0.012959071f, 0.021102704f, -0.031481203f, 0.043754652f,
+      -0.057369109f, 0.071877532f, -0.088042863f, 0.114878751f,
+      0.918209136f, 0.043037731f, -0.056533840f, 0.055180762f,
+      -0.048597254f, 0.039709300f, -0.030245999f, 0.021404656f,
+      -0.013947259f, 0.008230819f, -0.004267280f, 0.001820780f,
+      -0.000522749f, -0.000020682f, 0.000149245f, -0.000106640f },
+    { 0.000046632f, -0.000152529f, 0.000268242f, -0.000268842f,
+      -0.000082908f, 0.001143152f, -0.003359139f, 0.007202161f,
+      -0.013068358f, 0.021167746f, -0.031433016f, 0.043487210f,
+      -0.056719091f, 0.070566393f, -0.085455649f, 0.108618148f,
+      0.918765664f, 0.048734788f, -0.059182324f, 0.056642815f,
+      -0.049403604f, 0.040113043f, -0.030402264f, 0.021418925f,
+      -0.013891922f, 0.008152840f, -0.004193679f, 0.001763799f,
+      -0.000484832f, -0.000042480f, 0.000159850f, -0.000110763f },
+    { 0.000045493f, -0.000148333f, 0.000257266f, -0.000245622f,
+      -0.000124795f, 0.001209145f, -0.003450385f, 0.007310978f,
+      -0.013172777f, 0.021225477f, -0.031374648f, 0.043206584f,
+      -0.056053367f, 0.069238953f, -0.082858540f, 0.102404371f,
+      0.919221342f, 0.054487299f, -0.061829530f, 0.058093797f,
+      -0.050197307f, 0.040505257f, -0.030549116f, 0.021426128f,
+      -0.013831677f, 0.008071715f, -0.004118238f, 0.001705850f,
+      -0.000446470f, -0.000064450f, 0.000170507f, -0.000114900f },
+    { 0.000044357f, -0.000144136f, 0.000246310f, -0.000222514f,
+      -0.000166337f, 0.001274308f, -0.003539952f, 0.007416790f,
+      -0.013272315f, 0.021275911f, -0.031306159f, 0.042912919f,
+      -0.055372227f, 0.067895703f, -0.080252416f, 0.096238337f,
+      0.919576108f, 0.060294468f, -0.064474612f, 0.059533168f,
+      -0.050978038f, 0.040885765f, -0.030686468f, 0.021426231f,
+      -0.013766518f, 0.007987455f, -0.004040971f, 0.001646947f,
+      -0.000407672f, -0.000086586f, 0.000181215f, -0.000119051f },
+    { 0.000043224f, -0.000139942f, 0.000235378f, -0.000199523f,
+      -0.000207521f, 0.001338626f, -0.003627821f, 0.007519577f,
+      -0.013366962f, 0.021319067f, -0.031227618f, 0.042606376f,
+      -0.054675967f, 0.066537179f, -0.077638149f, 0.090120971f,
+      0.919829845f, 0.066155493f, -0.067116737f, 0.060960405f,
+      -0.051745489f, 0.041254383f, -0.030814232f, 0.021419197f,
+      -0.013696444f, 0.007900075f, -0.003961895f, 0.001587105f,
+      -0.000368449f, -0.000108881f, 0.000191969f, -0.000123212f },
+    { 0.000042094f, -0.000135750f, 0.000224474f, -0.000176657f,
+      -0.000248336f, 0.001402081f, -0.003713970f, 0.007619319f,
+      -0.013456711f, 0.021354960f, -0.031139094f, 0.042287108f,
+      -0.053964887f, 0.065163895f, -0.075016618f, 0.084053151f,
+      0.919982493f, 0.072069541f, -0.069755040f, 0.062374979f,
+      -0.052499339f, 0.041610945f, -0.030932324f, 0.021405002f,
+      -0.013621456f, 0.007809584f, -0.003881026f, 0.001526336f,
+      -0.000328811f, -0.000131329f, 0.000202766f, -0.000127384f },
+};
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,278 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../SDL_internal.h"
+
+/* Fixed ratio 44.1 to 48 kHz resampler, for drivers of hardware that only
+   plays 48 kHz, so that the most common rate doesn't have to go through
+   the generic resampler of SDL_AudioStream. */
+
+#include "SDL_audio.h"
+#include "SDL_audio_c.h"
+#include "SDL_cpuinfo.h"
+
+#include "SDL_audio_resampler48k_filter.h"
+
+#ifdef __ARM_NEON
+#define HAVE_NEON_INTRINSICS 1
+#endif
+
+#ifdef __SSE__
+#define HAVE_SSE_INTRINSICS 1
+#endif
+
+/* Input frames before the first one that are needed by the first output */
+#define RESAMPLER48K_HISTORY ((RESAMPLER48K_TAPS / 2) - 1)
+
+/* Resample 'count' frames of one channel. 'src' points at the first tap
+   of the first output, and moves ahead by one frame each time the phase
+   wraps around. */
+typedef void (*SDL_Resampler48kFunc)(const float *src, int phase, float *dst, int count, int stride);
+
+struct SDL_Resampler48k
+{
+    int channels;
+    int phase;    /* of the next output, in 160ths of an input frame */
+    int frames;   /* buffered in each channel, starting at the first tap of the next output */
+    int capacity; /* of each channel */
+    float *buffer; /* one channel after the other */
+    SDL_Resampler48kFunc resample;
+};
+
+static void Resample48k_Scalar(const float *src, int phase, float *dst, int count, int stride)
+{
+    int i, j;
+
+    for (i = 0; i < count; i++) {
+        const float *filter = Resampler48kFilter[phase];
+        float sum = 0.0f;
+
+        for (j = 0; j < RESAMPLER48K_TAPS; j++) {
+            sum += src[j] * filter[j];
+        }
+        *dst = sum;
+        dst += stride;
+
+        phase += RESAMPLER48K_STEP;
+        if (phase >= RESAMPLER48K_PHASES) {
+            phase -= RESAMPLER48K_PHASES;
+            src++;
+        }
+    }
+}
+
+#ifdef HAVE_SSE_INTRINSICS
+static void Resample48k_SSE(const float *src, int phase, float *dst, int count, int stride)
+{
+    int i, j;
+
+    SDL_COMPILE_TIME_ASSERT(resampler48k_sse_taps, (RESAMPLER48K_TAPS % 8) == 0);
+
+    for (i = 0; i < count; i++) {
+        const float *filter = Resampler48kFilter[phase];
+        __m128 sum1 = _mm_setzero_ps();
+        __m128 sum2 = _mm_setzero_ps();
+
+        for (j = 0; j < RESAMPLER48K_TAPS; j += 8) {
+            sum1 = _mm_add_ps(sum1, _mm_mul_ps(_mm_loadu_ps(src + j), _mm_loadu_ps(filter + j)));
+            sum2 = _mm_add_ps(sum2, _mm_mul_ps(_mm_loadu_ps(src + j + 4), _mm_loadu_ps(filter + j + 4)));
+        }
+        sum1 = _mm_add_ps(sum1, sum2);
+
+        /* Horizontal add of the four lanes */
+        sum1 = _mm_add_ps(sum1, _mm_movehl_ps(sum1, sum1));
+        sum1 = _mm_add_ss(sum1, _mm_shuffle_ps(sum1, sum1, _MM_SHUFFLE(1, 1, 1, 1)));
+        _mm_store_ss(dst, sum1);
+        dst += stride;
+
+        phase += RESAMPLER48K_STEP;
+        if (phase >= RESAMPLER48K_PHASES) {
+            phase -= RESAMPLER48K_PHASES;
+            src++;
+        }
+    }
+}
+#endif
+
+#ifdef HAVE_NEON_INTRINSICS
+static void Resample48k_NEON(const float *src, int phase, float *dst, int count, int stride)
+{
+    int i, j;
+
+    SDL_COMPILE_TIME_ASSERT(resampler48k_neon_taps, (RESAMPLER48K_TAPS % 8) == 0);
+
+    for (i = 0; i < count; i++) {
+        const float *filter = Resampler48kFilter[phase];
+        float32x4_t sum1 = vdupq_n_f32(0.0f);
+        float32x4_t sum2 = vdupq_n_f32(0.0f);
+        float32x2_t sum;
+
+        for (j = 0; j < RESAMPLER48K_TAPS; j += 8) {
+            sum1 = vmlaq_f32(sum1, vld1q_f32(src + j), vld1q_f32(filter + j));
+            sum2 = vmlaq_f32(sum2, vld1q_f32(src + j + 4), vld1q_f32(filter + j + 4));
+        }
+        sum1 = vaddq_f32(sum1, sum2);
+
+        /* Horizontal add of the four lanes */
+        sum = vadd_f32(vget_low_f32(sum1), vget_high_f32(sum1));
+        sum = vpadd_f32(sum, sum);
+        vst1_lane_f32(dst, sum, 0);
+        dst += stride;
+
+        phase += RESAMPLER48K_STEP;
+        if (phase >= RESAMPLER48K_PHASES) {
+            phase -= RESAMPLER48K_PHASES;
+            src++;
+        }
+    }
+}
+#endif
+
+/* Make room for 'capacity' frames in each channel, keeping those buffered */
+static int Resampler48k_Reserve(SDL_Resampler48k *resampler, int capacity)
+{
+    const int channels = resampler->channels;
+    float *buffer = (float *)SDL_calloc((size_t)capacity * channels, sizeof(float));
+    int i;
+
+    if (!buffer) {
+        return SDL_OutOfMemory();
+    }
+    for (i = 0; i < channels; i++) {
+        if (resampler->buffer) {
+            SDL_memcpy(buffer + i * capacity, resampler->buffer + i * resampler->capacity,
+                       resampler->frames * sizeof(float));
+        }
+    }
+    SDL_free(resampler->buffer);
+    resampler->buffer = buffer;
+    resampler->capacity = capacity;
+    return 0;
+}
+
+SDL_Resampler48k *SDL_CreateResampler48k(int channels, int max_frames)
+{
+    SDL_Resampler48k *resampler;
+
+    if (channels <= 0) {
+        SDL_InvalidParamError("channels");
+        return NULL;
+    }
+
+    resampler = (SDL_Resampler48k *)SDL_calloc(1, sizeof(*resampler));
+    if (!resampler) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    resampler->channels = channels;
+
+    /* Fewer than RESAMPLER48K_TAPS frames are left after each call, unless
+       output was held back */
+    if (max_frames > 0 && Resampler48k_Reserve(resampler, RESAMPLER48K_TAPS + max_frames) < 0) {
+        SDL_free(resampler);
+        return NULL;
+    }
+
+    resampler->resample = Resample48k_Scalar;
+#ifdef HAVE_SSE_INTRINSICS
+    if (SDL_HasSSE()) {
+        resampler->resample = Resample48k_SSE;
+    }
+#endif
+#ifdef HAVE_NEON_INTRINSICS
+    if (SDL_HasNEON()) {
+        resampler->resample = Resample48k_NEON;
+    }
+#endif
+
+    SDL_ResetResampler48k(resampler);
+
+    return resampler;
+}
+
+void SDL_ResetResampler48k(SDL_Resampler48k *resampler)
+{
+    int i;
+
+    /* The first output lines up with the first input frame, silence
+       stands in for the taps before it */
+    resampler->phase = 0;
+    resampler->frames = RESAMPLER48K_HISTORY;
+    if (resampler->buffer) {
+        for (i = 0; i < resampler->channels; i++) {
+            SDL_memset(resampler->buffer + i * resampler->capacity, 0, RESAMPLER48K_HISTORY * sizeof(float));
+        }
+    }
+}
+
+int SDL_Resample48k(SDL_Resampler48k *resampler, const float *src, int src_frames,
+                    float *dst, int dst_frames)
+{
+    const int channels = resampler->channels;
+    int count, consumed, position, i, j;
+
+    /* Only when more is passed than the resampler was created for */
+    if (resampler->frames + src_frames > resampler->capacity &&
+        Resampler48k_Reserve(resampler, resampler->frames + src_frames) < 0) {
+        return -1;
+    }
+
+    for (i = 0; i < channels; i++) {
+        float *buffer = resampler->buffer + i * resampler->capacity + resampler->frames;
+        for (j = 0; j < src_frames; j++) {
+            buffer[j] = src[j * channels + i];
+        }
+    }
+    resampler->frames += src_frames;
+
+    /* Outputs whose last tap is buffered already */
+    if (resampler->frames < RESAMPLER48K_TAPS) {
+        return 0;
+    }
+    count = ((resampler->frames - RESAMPLER48K_TAPS + 1) * RESAMPLER48K_PHASES - resampler->phase - 1) / RESAMPLER48K_STEP + 1;
+    count = SDL_min(count, dst_frames);
+
+    for (i = 0; i < channels; i++) {
+        resampler->resample(resampler->buffer + i * resampler->capacity, resampler->phase,
+                            dst + i, count, channels);
+    }
+
+    /* Drop the frames that no output will need anymore */
+    position = resampler->phase + count * RESAMPLER48K_STEP;
+    consumed = position / RESAMPLER48K_PHASES;
+    resampler->phase = position % RESAMPLER48K_PHASES;
+    resampler->frames -= consumed;
+    for (i = 0; i < channels; i++) {
+        float *buffer = resampler->buffer + i * resampler->capacity;
+        SDL_memmove(buffer, buffer + consumed, resampler->frames * sizeof(float));
+    }
+
+    return count;
+}
+
+void SDL_DestroyResampler48k(SDL_Resampler48k *resampler)
+{
+    if (resampler) {
+        SDL_free(resampler->buffer);
+        SDL_free(resampler);
+    }
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -79,6 +79,7 @@ typedef struct SDL_AudioDriverImpl
     void (*FreeDeviceHandle)(void *handle); /**< SDL is done with handle from SDL_AddAudioDevice() */
     void (*Deinitialize)(void);
     int (*GetDefaultAudioInfo)(char **name, SDL_AudioSpec *spec, int iscapture);
+    int (*GetPendingFrames)(_THIS); /* played to the device but not heard yet */
 
     /* !!! FIXME: add pause(), so we can optimize instead of mixing silence. */
 
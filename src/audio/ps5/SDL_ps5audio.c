@@ -20,12 +20,32 @@
 */
 #include "../../SDL_internal.h"
 
-#ifdef SDL_AUDIO_DRIVER_PS5
+#if defined(SDL_AUDIO_DRIVER_PS5) || defined(SDL_PS5_HOST_TEST)
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
 
 #include "SDL_audio.h"
+#include "SDL_hints.h"
+#include "SDL_timer.h"
+#include "../SDL_audio_c.h"
+#include "../../thread/SDL_systhread.h"
 #include "SDL_ps5audio.h"
 
 
+/* Slots of the channels of SDL's 3 to 7 channel layouts in the 8 channel
+   output, whose order is that of SDL's 7.1 layout. The back center of 6.1
+   goes to the left back slot, and is copied to the right one. */
+static const Uint8 PS5AUDIO_channel_slots[5][7] = {
+    { 0, 1, 3 },                /* FL FR LFE */
+    { 0, 1, 4, 5 },             /* FL FR BL BR */
+    { 0, 1, 3, 4, 5 },          /* FL FR LFE BL BR */
+    { 0, 1, 2, 3, 6, 7 },       /* FL FR FC LFE SL SR */
+    { 0, 1, 2, 3, 4, 6, 7 },    /* FL FR FC LFE BC SL SR */
+};
+
 inline static Uint16 PS5AUDIO_SampleSize(Uint16 size)
 {
     if (size >= 2048) return 2048;
@@ -35,15 +55,120 @@ inline static Uint16 PS5AUDIO_SampleSize(Uint16 size)
     if (size >= 1024) return 1024;
     if (size >= 768) return 768;
     if (size >= 512) return 512;
-    return 256;
+    return PS5AUDIO_MIN_SAMPLES;
+}
+
+static Uint8 PS5AUDIO_OutputParam(SDL_AudioFormat format, int channels)
+{
+    if (format == AUDIO_S16LSB) {
+        return (channels == 1) ? PROSPERO_AUDIO_OUT_PARAM_FORMAT_S16_MONO
+             : (channels == 2) ? PROSPERO_AUDIO_OUT_PARAM_FORMAT_S16_STEREO
+                               : PROSPERO_AUDIO_OUT_PARAM_FORMAT_S16_8CH_STD;
+    }
+    return (channels == 1) ? PROSPERO_AUDIO_OUT_PARAM_FORMAT_FLOAT_MONO
+         : (channels == 2) ? PROSPERO_AUDIO_OUT_PARAM_FORMAT_FLOAT_STEREO
+                           : PROSPERO_AUDIO_OUT_PARAM_FORMAT_FLOAT_8CH_STD;
+}
+
+/* Keeps the input port drained into the capture ring, so that grains
+   aren't lost while the audio thread is in the app's callback. The
+   hardware writes each grain straight into its slot. */
+static int SDLCALL PS5AUDIO_InputThread(void *data)
+{
+    SDL_AudioDevice *this = (SDL_AudioDevice *)data;
+    struct SDL_PrivateAudioData *h = this->hidden;
+    Uint8 *spare = h->grains + PS5AUDIO_CAPTURE_GRAINS * h->grain_size;
+    int32_t err;
+
+    SDL_SetThreadPriority(SDL_THREAD_PRIORITY_TIME_CRITICAL);
+
+    while (!SDL_AtomicGet(&h->input_shutdown)) {
+        const Uint32 written = (Uint32)SDL_AtomicGet(&h->grains_written);
+        Uint8 *slot = spare;
+
+        /* With the ring full, the new grain is the one dropped, the
+           audio thread may be reading the oldest */
+        if (written - (Uint32)SDL_AtomicGet(&h->grains_read) < PS5AUDIO_CAPTURE_GRAINS) {
+            slot = h->grains + (written % PS5AUDIO_CAPTURE_GRAINS) * h->grain_size;
+        }
+
+        err = sceAudioInInput(h->ain, slot);
+        if (err < 0) {
+            SDL_AtomicSet(&h->input_error, err);
+            break;
+        }
+
+        if (slot == spare) {
+            SDL_AtomicIncRef(&h->overruns);
+        } else {
+            SDL_AtomicIncRef(&h->grains_written);
+            SDL_SemPost(h->grains_ready);
+        }
+    }
+
+    /* Don't leave the audio thread waiting for a grain that won't come */
+    SDL_SemPost(h->grains_ready);
+    return 0;
+}
+
+static int PS5AUDIO_OpenCaptureDevice(_THIS)
+{
+    struct SDL_PrivateAudioData *h = this->hidden;
+    /* Voice chat ports are 16 kHz mono, anything asking for more gets a
+       general one at the rate of the hardware */
+    const SDL_bool voice = (this->spec.freq <= 16000);
+    int user_id, err;
+
+    h->ain = -1;
+
+    this->spec.format = AUDIO_S16LSB;
+    this->spec.channels = voice ? 1 : SDL_clamp(this->spec.channels, 1, 2);
+    this->spec.freq = voice ? 16000 : PS5AUDIO_FREQ;
+    this->spec.samples = PS5AUDIO_CAPTURE_GRAIN;
+    SDL_CalculateAudioSpec(&this->spec);
+    h->grain_size = this->spec.size;
+
+    err = sceUserServiceInitialize(NULL);
+    if (err != 0 && err != 0x80960003) {
+        return SDL_SetError("sceUserServiceInitialize: 0x%08x", err);
+    }
+    err = sceUserServiceGetForegroundUser(&user_id);
+    if (err != 0) {
+        return SDL_SetError("sceUserServiceGetForegroundUser: 0x%08x", err);
+    }
+
+    h->grains = (Uint8 *)SDL_calloc(PS5AUDIO_CAPTURE_GRAINS + 1, h->grain_size);
+    if (!h->grains) {
+        return SDL_OutOfMemory();
+    }
+    h->grains_ready = SDL_CreateSemaphore(0);
+    if (!h->grains_ready) {
+        return -1;
+    }
+
+    h->ain = sceAudioInOpen(user_id,
+                            voice ? PROSPERO_AUDIO_IN_TYPE_VOICE_CHAT : PROSPERO_AUDIO_IN_TYPE_GENERAL,
+                            0, PS5AUDIO_CAPTURE_GRAIN, this->spec.freq,
+                            (this->spec.channels == 1) ? PROSPERO_AUDIO_IN_PARAM_FORMAT_S16_MONO
+                                                       : PROSPERO_AUDIO_IN_PARAM_FORMAT_S16_STEREO);
+    if (h->ain < 0) {
+        return SDL_SetError("sceAudioInOpen: 0x%08x", h->ain);
+    }
+
+    h->input_thread = SDL_CreateThreadInternal(PS5AUDIO_InputThread, "SDLAudioInPS5", 0, this);
+    if (!h->input_thread) {
+        return -1;
+    }
+
+    return 0;
 }
 
 static int PS5AUDIO_OpenDevice(_THIS, const char *devname)
 {
     SDL_bool supported_format = SDL_FALSE;
-    SDL_AudioFormat test_format;
-    size_t mix_len, i;
-    Uint8 fmt;
+    SDL_AudioFormat test_format, out_format;
+    size_t mix_len, out_len = 0, i;
+    SDL_bool spread, resample;
 
     this->hidden = (struct SDL_PrivateAudioData *) SDL_malloc(sizeof(*this->hidden));
     if (this->hidden == NULL) {
@@ -51,16 +176,27 @@ static int PS5AUDIO_OpenDevice(_THIS, const char *devname)
     }
     SDL_zerop(this->hidden);
 
+    if (this->iscapture) {
+        return PS5AUDIO_OpenCaptureDevice(this);
+    }
+
+    /* Every channel count SDL knows is kept, so that the app's spec matches
+       the device and no conversion happens on the audio thread. Mono and
+       stereo have output formats of their own, anything else is output
+       as 7.1 with the missing channels silent. */
+    this->spec.channels = SDL_clamp(this->spec.channels, 1, 8);
+    spread = (this->spec.channels > 2 && this->spec.channels < 8);
+
+    /* The hardware only plays 48 kHz. 44.1 kHz, by far the most common
+       other rate, is resampled here with a filter made for that ratio,
+       rather than by the generic resampler of SDL_AudioStream. The output
+       is always float then. */
+    resample = (this->spec.freq == 44100);
+
     test_format = SDL_FirstAudioFormat(this->spec.format);
     while ((!supported_format) && (test_format)) {
-        if (test_format == AUDIO_S16LSB) {
-            supported_format = SDL_TRUE;
-            fmt = (this->spec.channels == 1) ? PROSPERO_AUDIO_OUT_PARAM_FORMAT_S16_MONO
-                                             : PROSPERO_AUDIO_OUT_PARAM_FORMAT_S16_STEREO;
-        } else if (test_format == AUDIO_F32LSB) {
+        if (test_format == AUDIO_S16LSB || test_format == AUDIO_F32LSB) {
             supported_format = SDL_TRUE;
-            fmt = (this->spec.channels == 1) ? PROSPERO_AUDIO_OUT_PARAM_FORMAT_FLOAT_MONO
-                                             : PROSPERO_AUDIO_OUT_PARAM_FORMAT_FLOAT_STEREO;
         } else {
             test_format = SDL_NextAudioFormat();
         }
@@ -72,33 +208,68 @@ static int PS5AUDIO_OpenDevice(_THIS, const char *devname)
     }
 
     this->spec.format = test_format;
-    this->spec.samples = PS5AUDIO_SampleSize(this->spec.samples);
-    this->spec.freq = 48000;
-    this->spec.channels = this->spec.channels == 1 ? 1 : 2;
+    out_format = resample ? AUDIO_F32LSB : test_format;
+    this->hidden->low_latency = SDL_GetHintBoolean(SDL_HINT_PS5_AUDIO_LOW_LATENCY, SDL_FALSE);
+    if (this->hidden->low_latency) {
+        this->spec.samples = PS5AUDIO_MIN_SAMPLES;
+    } else {
+        this->spec.samples = PS5AUDIO_SampleSize(this->spec.samples);
+    }
+    if (!resample) {
+        this->spec.freq = PS5AUDIO_FREQ;
+    }
 
     /* Update the fragment size as size in bytes. */
     SDL_CalculateAudioSpec(&this->spec);
 
+    if (resample) {
+        this->hidden->resampler = SDL_CreateResampler48k(this->spec.channels, this->spec.samples);
+        if (!this->hidden->resampler) {
+            return -1;
+        }
+        this->hidden->resampled = (float *)SDL_malloc(PS5AUDIO_RESAMPLED_FRAMES(this->spec.samples) *
+                                                      this->spec.channels * sizeof(float));
+        if (!this->hidden->resampled) {
+            return SDL_OutOfMemory();
+        }
+        if (test_format == AUDIO_S16LSB) {
+            this->hidden->converted = (float *)SDL_malloc((size_t)this->spec.samples *
+                                                          this->spec.channels * sizeof(float));
+            if (!this->hidden->converted) {
+                return SDL_OutOfMemory();
+            }
+        }
+    }
+
     /* Allocate the mixing buffer.  Its size and starting address must
        be a multiple of 64 bytes.  Our sample count is already a multiple of
        64, so spec->size should be a multiple of 64 as well. */
     mix_len = this->spec.size * NUM_BUFFERS;
-    if (posix_memalign((void**)&this->hidden->rawbuf, 64, mix_len)) {
+    if (spread || resample) {
+        out_len = (size_t)this->spec.samples * (spread ? 8 : this->spec.channels) *
+                  SDL_AUDIO_BITSIZE(out_format) / 8;
+    }
+    if (posix_memalign((void**)&this->hidden->rawbuf, 64, mix_len + out_len * NUM_BUFFERS)) {
         return SDL_SetError("PS5AUDIO_OpenDevice: couldn't allocate mix buffer");
     }
 
     this->hidden->aout = sceAudioOutOpen(PROSPERO_USER_SERVICE_USER_ID_SYSTEM,
                                          PROSPERO_AUDIO_OUT_PORT_TYPE_MAIN,
-                                         0, this->spec.samples, 48000, fmt);
+                                         0, this->spec.samples, PS5AUDIO_FREQ,
+                                         PS5AUDIO_OutputParam(out_format, this->spec.channels));
     if (this->hidden->aout < 1) {
         free(this->hidden->rawbuf);
         this->hidden->rawbuf = NULL;
         return SDL_SetError("sceAudioOutOpen: %s", strerror(this->hidden->aout));
     }
 
-    SDL_memset(this->hidden->rawbuf, 0, mix_len);
+    /* Slots that no channel goes to stay silent from here on */
+    SDL_memset(this->hidden->rawbuf, 0, mix_len + out_len * NUM_BUFFERS);
     for (i = 0; i < NUM_BUFFERS; i++) {
         this->hidden->mixbufs[i] = &this->hidden->rawbuf[i * this->spec.size];
+        if (out_len) {
+            this->hidden->outbufs[i] = &this->hidden->rawbuf[mix_len + i * out_len];
+        }
     }
 
     this->hidden->next_buffer = 0;
@@ -106,13 +277,99 @@ static int PS5AUDIO_OpenDevice(_THIS, const char *devname)
     return 0;
 }
 
-static void PS5AUDIO_PlayDevice(_THIS)
+#define PS5AUDIO_SPREAD_CHANNELS(type)                                  \
+    {                                                                   \
+        const type *src = (const type *)mixbuf;                         \
+        type *dst = (type *)outbuf;                                     \
+        for (i = 0; i < this->spec.samples; i++) {                      \
+            for (c = 0; c < channels; c++) {                            \
+                dst[slots[c]] = src[c];                                 \
+            }                                                           \
+            if (channels == 7) {                                        \
+                dst[5] = dst[4];                                        \
+            }                                                           \
+            src += channels;                                            \
+            dst += 8;                                                   \
+        }                                                               \
+    }
+
+/* Copy a 3 to 7 channel mixing buffer to the slots of its channels */
+static void PS5AUDIO_SpreadChannels(_THIS, SDL_AudioFormat format, const void *mixbuf, Uint8 *outbuf)
+{
+    const int channels = this->spec.channels;
+    const Uint8 *slots = PS5AUDIO_channel_slots[channels - 3];
+    int i, c;
+
+    if (SDL_AUDIO_BITSIZE(format) == 16) {
+        PS5AUDIO_SPREAD_CHANNELS(Sint16);
+    } else {
+        PS5AUDIO_SPREAD_CHANNELS(float);
+    }
+}
+
+static void PS5AUDIO_Output(_THIS, const Uint8 *buf)
 {
-    Uint8 *buf = this->hidden->mixbufs[this->hidden->next_buffer];
     sceAudioOutOutput(this->hidden->aout, buf);
+    this->hidden->play_start = SDL_GetPerformanceCounter();
     this->hidden->next_buffer = (this->hidden->next_buffer + 1) % NUM_BUFFERS;
 }
 
+/* Resample a 44.1 kHz mixing buffer, and output every full buffer of
+   48 kHz frames that comes out of it. That is one most of the time, and
+   two every twelve buffers or so. */
+static void PS5AUDIO_PlayResampled(_THIS, const Uint8 *mixbuf)
+{
+    struct SDL_PrivateAudioData *h = this->hidden;
+    const int channels = this->spec.channels;
+    const int samples = this->spec.samples;
+    const float *src = (const float *)mixbuf;
+    int got, i;
+
+    if (h->converted) {
+        const Sint16 *s16 = (const Sint16 *)mixbuf;
+        for (i = 0; i < samples * channels; i++) {
+            h->converted[i] = s16[i] * (1.0f / 32768.0f);
+        }
+        src = h->converted;
+    }
+
+    got = SDL_Resample48k(h->resampler, src, samples, h->resampled + h->resampled_frames * channels,
+                          PS5AUDIO_RESAMPLED_FRAMES(samples) - h->resampled_frames);
+    if (got > 0) {
+        h->resampled_frames += got;
+    }
+
+    while (h->resampled_frames >= samples) {
+        Uint8 *outbuf = h->outbufs[h->next_buffer];
+
+        if (channels > 2 && channels < 8) {
+            PS5AUDIO_SpreadChannels(this, AUDIO_F32LSB, h->resampled, outbuf);
+        } else {
+            SDL_memcpy(outbuf, h->resampled, (size_t)samples * channels * sizeof(float));
+        }
+        h->resampled_frames -= samples;
+        SDL_memmove(h->resampled, h->resampled + samples * channels,
+                    (size_t)h->resampled_frames * channels * sizeof(float));
+        PS5AUDIO_Output(this, outbuf);
+    }
+}
+
+static void PS5AUDIO_PlayDevice(_THIS)
+{
+    Uint8 *buf = this->hidden->mixbufs[this->hidden->next_buffer];
+    Uint8 *outbuf = this->hidden->outbufs[this->hidden->next_buffer];
+
+    if (this->hidden->resampler) {
+        PS5AUDIO_PlayResampled(this, buf);
+        return;
+    }
+    if (outbuf) {
+        PS5AUDIO_SpreadChannels(this, this->spec.format, buf, outbuf);
+        buf = outbuf;
+    }
+    PS5AUDIO_Output(this, buf);
+}
+
 /* This function waits until it is possible to write a full sound buffer */
 static void PS5AUDIO_WaitDevice(_THIS)
 {
@@ -124,9 +381,96 @@ static Uint8 *PS5AUDIO_GetDeviceBuf(_THIS)
     return this->hidden->mixbufs[this->hidden->next_buffer];
 }
 
+/* Copy out of the oldest grain in the ring, waiting for one if it is
+   empty. A grain is only handed back once all of it has been read. Once
+   the input port has failed and the grains captured before are read,
+   this fails too, and SDL's capture thread reports the device as
+   disconnected. */
+static int PS5AUDIO_CaptureFromDevice(_THIS, void *buffer, int buflen)
+{
+    struct SDL_PrivateAudioData *h = this->hidden;
+    const Uint8 *grain;
+    int len, err;
+
+    if (h->grain_offset == 0) {
+        SDL_SemWait(h->grains_ready);
+        if (SDL_AtomicGet(&h->grains_written) == SDL_AtomicGet(&h->grains_read)) {
+            /* Woken up by the input thread stopping */
+            SDL_SemPost(h->grains_ready);
+            err = SDL_AtomicGet(&h->input_error);
+            if (err != 0) {
+                return SDL_SetError("sceAudioInInput: 0x%08x", err);
+            }
+            return SDL_SetError("PS5 audio: capture stopped");
+        }
+    }
+
+    grain = h->grains + ((Uint32)SDL_AtomicGet(&h->grains_read) % PS5AUDIO_CAPTURE_GRAINS) * h->grain_size;
+    len = SDL_min(buflen, h->grain_size - h->grain_offset);
+    SDL_memcpy(buffer, grain + h->grain_offset, len);
+    h->grain_offset += len;
+
+    if (h->grain_offset == h->grain_size) {
+        h->grain_offset = 0;
+        SDL_AtomicIncRef(&h->grains_read);
+    }
+    return len;
+}
+
+/* Drop every grain captured so far, so that capture resumes with the
+   next one instead of a backlog from while the device was paused */
+static void PS5AUDIO_FlushCapture(_THIS)
+{
+    struct SDL_PrivateAudioData *h = this->hidden;
+
+    if (h->grain_offset) {
+        h->grain_offset = 0;
+        SDL_AtomicIncRef(&h->grains_read);
+    }
+    while (SDL_SemTryWait(h->grains_ready) == 0) {
+        if (SDL_AtomicGet(&h->grains_written) == SDL_AtomicGet(&h->grains_read)) {
+            SDL_SemPost(h->grains_ready);
+            break;
+        }
+        SDL_AtomicIncRef(&h->grains_read);
+    }
+}
+
+static void PS5AUDIO_CloseCaptureDevice(_THIS)
+{
+    struct SDL_PrivateAudioData *h = this->hidden;
+    int res;
+
+    /* The input thread notices within a grain */
+    if (h->input_thread) {
+        SDL_AtomicSet(&h->input_shutdown, 1);
+        SDL_WaitThread(h->input_thread, NULL);
+        h->input_thread = NULL;
+    }
+    if (h->ain >= 0) {
+        res = sceAudioInClose(h->ain);
+        if (res != 0) {
+            SDL_SetError("sceAudioInClose: 0x%08x", res);
+        }
+        h->ain = -1;
+    }
+    if (h->grains_ready) {
+        SDL_DestroySemaphore(h->grains_ready);
+        h->grains_ready = NULL;
+    }
+    SDL_free(h->grains);
+    h->grains = NULL;
+}
+
 static void PS5AUDIO_CloseDevice(_THIS)
 {
     int res;
+
+    if (this->iscapture) {
+        PS5AUDIO_CloseCaptureDevice(this);
+        return;
+    }
+
     if (this->hidden->aout > 0) {
         res = sceAudioOutClose(this->hidden->aout);
         if (res != 0) {
@@ -139,10 +483,46 @@ static void PS5AUDIO_CloseDevice(_THIS)
         free(this->hidden->rawbuf);
         this->hidden->rawbuf = NULL;
     }
+
+    SDL_DestroyResampler48k(this->hidden->resampler);
+    this->hidden->resampler = NULL;
+    SDL_free(this->hidden->resampled);
+    this->hidden->resampled = NULL;
+    SDL_free(this->hidden->converted);
+    this->hidden->converted = NULL;
+}
+
+/* Frames of the buffer being played that haven't been heard yet, plus
+   the resampled ones waiting for a full buffer. The buffer was started
+   when sceAudioOutOutput returned, and nothing is queued behind it. */
+static int PS5AUDIO_GetPendingFrames(_THIS)
+{
+    const Uint64 start = this->hidden->play_start;
+    Uint64 pending = this->hidden->resampled_frames;
+    Uint64 played;
+
+    if (start != 0) {
+        played = (SDL_GetPerformanceCounter() - start) * PS5AUDIO_FREQ / SDL_GetPerformanceFrequency();
+        if (played < this->spec.samples) {
+            pending += this->spec.samples - played;
+        }
+    }
+    /* Counted at the rate of the device's spec */
+    return (int)(pending * this->spec.freq / PS5AUDIO_FREQ);
 }
 
 static void PS5AUDIO_ThreadInit(_THIS)
 {
+    struct sched_param param;
+
+    /* SDL only raises the thread to the top of the default policy, a 5ms
+       buffer needs the audio thread to preempt the game's own threads */
+    if (this->hidden->low_latency) {
+        param.sched_priority = sched_get_priority_max(SCHED_RR);
+        if (pthread_setschedparam(pthread_self(), SCHED_RR, &param) != 0) {
+            SDL_LogWarn(SDL_LOG_CATEGORY_AUDIO, "PS5 audio: couldn't raise the audio thread priority");
+        }
+    }
 }
 
 
@@ -162,9 +542,14 @@ static SDL_bool PS5AUDIO_Init(SDL_AudioDriverImpl *impl)
     impl->WaitDevice = PS5AUDIO_WaitDevice;
     impl->GetDeviceBuf = PS5AUDIO_GetDeviceBuf;
     impl->CloseDevice = PS5AUDIO_CloseDevice;
+    impl->GetPendingFrames = PS5AUDIO_GetPendingFrames;
+    impl->CaptureFromDevice = PS5AUDIO_CaptureFromDevice;
+    impl->FlushCapture = PS5AUDIO_FlushCapture;
     impl->Deinitialize = PS5AUDIO_Deinitialize;
 
+    impl->HasCaptureSupport = SDL_TRUE;
     impl->OnlyHasDefaultOutputDevice = SDL_TRUE;
+    impl->OnlyHasDefaultCaptureDevice = SDL_TRUE;
 
     return SDL_TRUE;
 }
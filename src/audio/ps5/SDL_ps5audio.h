@@ -29,8 +29,30 @@
 /* Hidden "this" pointer for the audio functions */
 #define _THIS   SDL_AudioDevice *this
 
+/* sceAudioOutOutput blocks until the previous buffer has been played, so
+   there is never more than one buffer in flight: two is the shortest ring
+   that lets the next one be mixed meanwhile, and a longer one would not
+   add any margin. The latency is set by the size of the buffers. */
 #define NUM_BUFFERS 2
 
+/* Smallest buffer sceAudioOutOpen takes, in sample frames */
+#define PS5AUDIO_MIN_SAMPLES 256
+
+/* The only rate the hardware plays */
+#define PS5AUDIO_FREQ 48000
+
+/* Room for the 48 kHz frames of resampled mixing buffers that don't make
+   a full output buffer yet. There are less than one buffer's worth left
+   after each output, and a 44.1 kHz buffer adds less than 1.1. */
+#define PS5AUDIO_RESAMPLED_FRAMES(samples) ((samples) * 3)
+
+/* Frames sceAudioInInput returns at a time */
+#define PS5AUDIO_CAPTURE_GRAIN 256
+
+/* Grains the capture ring holds before the oldest is dropped. At 48 kHz
+   that is 43ms of slack for an audio thread held up by the app. */
+#define PS5AUDIO_CAPTURE_GRAINS 8
+
 struct SDL_PrivateAudioData {
     /* The hardware output channel. */
     int32_t aout;
@@ -38,16 +60,66 @@ struct SDL_PrivateAudioData {
     Uint8 *rawbuf;
     /* Individual mixing buffers. */
     Uint8 *mixbufs[NUM_BUFFERS];
+    /* Layouts without an output format of their own are spread over 8
+       channels in these, NULL when the mixing buffers are output as is. */
+    Uint8 *outbufs[NUM_BUFFERS];
     /* Index of the next available mixing buffer. */
     int next_buffer;
+    /* SDL_HINT_PS5_AUDIO_LOW_LATENCY was set when the device was opened. */
+    SDL_bool low_latency;
+    /* Performance counter when the last buffer started playing. */
+    Uint64 play_start;
+    /* 44.1 kHz mixing buffers are resampled to 48 kHz with this, NULL when
+       the device's spec is at 48 kHz already. */
+    struct SDL_Resampler48k *resampler;
+    /* Resampled frames that don't fill an output buffer yet. */
+    float *resampled;
+    int resampled_frames;
+    /* S16 mixing buffers converted to float for the resampler. */
+    float *converted;
+
+    /* The hardware input port, for capture devices. */
+    int32_t ain;
+    /* PS5AUDIO_CAPTURE_GRAINS slots that sceAudioInInput writes to
+       directly, plus a spare one it writes to when they are all full. */
+    Uint8 *grains;
+    int grain_size;
+    /* Grains written by the input thread and read by the audio thread,
+       only ever counting up. Each only changes them on its own side. */
+    SDL_atomic_t grains_written;
+    SDL_atomic_t grains_read;
+    /* Bytes of the grain being read that have been captured already, 0
+       when the audio thread isn't holding one. */
+    int grain_offset;
+    /* Posted once per grain written, and when the input thread stops. */
+    SDL_sem *grains_ready;
+    SDL_Thread *input_thread;
+    SDL_atomic_t input_shutdown;
+    /* What sceAudioInInput returned when it failed, stopping the input
+       thread, 0 until then. */
+    SDL_atomic_t input_error;
+    /* Grains dropped because the ring was full. */
+    SDL_atomic_t overruns;
 };
 
 #define PROSPERO_AUDIO_OUT_PORT_TYPE_MAIN 0
 
 #define PROSPERO_AUDIO_OUT_PARAM_FORMAT_S16_MONO     0
 #define PROSPERO_AUDIO_OUT_PARAM_FORMAT_S16_STEREO   1
+#define PROSPERO_AUDIO_OUT_PARAM_FORMAT_S16_8CH      2
 #define PROSPERO_AUDIO_OUT_PARAM_FORMAT_FLOAT_MONO   3
 #define PROSPERO_AUDIO_OUT_PARAM_FORMAT_FLOAT_STEREO 4
+#define PROSPERO_AUDIO_OUT_PARAM_FORMAT_FLOAT_8CH    5
+/* Same as the two above, in the channel order of SDL's 7.1 layout:
+   FL FR FC LFE BL BR SL SR */
+#define PROSPERO_AUDIO_OUT_PARAM_FORMAT_S16_8CH_STD   6
+#define PROSPERO_AUDIO_OUT_PARAM_FORMAT_FLOAT_8CH_STD 7
+
+#define PROSPERO_AUDIO_IN_TYPE_VOICE_CHAT 0
+#define PROSPERO_AUDIO_IN_TYPE_GENERAL    1
+
+#define PROSPERO_AUDIO_IN_PARAM_FORMAT_S16_MONO   0
+#define PROSPERO_AUDIO_IN_PARAM_FORMAT_S16_STEREO 2
 
 #define PROSPERO_USER_SERVICE_USER_ID_SYSTEM 0xFF
 
@@ -58,6 +130,14 @@ int32_t sceAudioOutOpen(int32_t userId, int32_t type, int32_t index,
 int32_t sceAudioOutOutput(int32_t handle, const void *p);
 int32_t sceAudioOutClose(int32_t handle);
 
+int32_t sceAudioInOpen(int32_t userId, uint32_t type, uint32_t index,
+                       uint32_t len, uint32_t freq, uint32_t param);
+int32_t sceAudioInInput(int32_t handle, void *dest);
+int32_t sceAudioInClose(int32_t handle);
+
+int sceUserServiceInitialize(void *);
+int sceUserServiceGetForegroundUser(int *user_id);
+
 
 #endif /* _SDL_PS5AUDIO_H_ */
 
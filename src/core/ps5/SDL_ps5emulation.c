@@ -0,0 +1,600 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../../SDL_internal.h"
+
+#ifdef SDL_PS5_HOST_EMULATION
+
+/* Stand-in for the PS5 system libraries the PS5 drivers use, so that they
+   run headless on the host (see SDL_PS5_HOST_EMULATION in CMakeLists.txt).
+
+   The display refreshes at 60 Hz from the time the video output is opened,
+   and shows at most one queued flip per vblank, at the flip rate that was
+   set. Flips happen when the driver looks at them, in the vblank they would
+   have happened in on the console. Audio ports consume and produce their
+   grains in real time, with a single grain queued behind the one playing.
+   There is one user, logged in with a connected pad at rest, and a keyboard
+   that nobody types on. */
+
+#include <errno.h>
+#include <stdlib.h>
+
+#include "SDL_atomic.h"
+#include "SDL_audio.h"
+#include "SDL_timer.h"
+
+#include "../../audio/ps5/SDL_ps5audio.h"
+#include "../../joystick/ps5/SDL_ps5joystick.h"
+#undef _THIS /* the audio one, the video headers have their own */
+#include "../../video/ps5/SDL_ps5keyboard.h"
+#include "../../video/ps5/SDL_ps5video.h"
+
+#define PS5_EMU_USER_ID 1
+
+#define PS5_EMU_REFRESH_RATE 60
+#define PS5_EMU_MAX_FLIPS    16
+#define PS5_EMU_AUDIO_PORTS  8
+
+/* Microseconds since the first call, the TSC of the emulated console */
+static Uint64 PS5_EmuTime(void)
+{
+    static Uint64 start;
+    const Uint64 frequency = SDL_GetPerformanceFrequency();
+    Uint64 now = SDL_GetPerformanceCounter();
+
+    if (!start) {
+        start = now;
+    }
+    now -= start;
+    return (now / frequency) * 1000000 + (now % frequency) * 1000000 / frequency;
+}
+
+static void PS5_EmuSleepUntil(Uint64 time)
+{
+    Uint64 now;
+
+    while ((now = PS5_EmuTime()) < time) {
+        SDL_Delay((Uint32)((time - now + 999) / 1000));
+    }
+}
+
+
+/* Direct memory is ordinary memory, its "physical" address the pointer */
+
+int sceKernelAllocateMainDirectMemory(size_t size, size_t align, int type, intptr_t *paddr)
+{
+    void *memory = aligned_alloc(align, size);
+
+    if (!memory) {
+        errno = ENOMEM;
+        return -1;
+    }
+    *paddr = (intptr_t)memory;
+    return 0;
+}
+
+int sceKernelMapDirectMemory(void **vaddr, size_t size, int prot, int flags, intptr_t paddr, size_t align)
+{
+    *vaddr = (void *)paddr;
+    return 0;
+}
+
+int sceKernelMunmap(void *addr, size_t size)
+{
+    return 0;
+}
+
+int sceKernelReleaseDirectMemory(intptr_t paddr, size_t size)
+{
+    free((void *)paddr);
+    return 0;
+}
+
+uint64_t sceKernelGetTscFrequency(void)
+{
+    return 1000000;
+}
+
+
+/* The display, a single video output port */
+
+struct PS5_KernelEqueue
+{
+    int unused;
+};
+
+typedef struct PS5_EmuFlip
+{
+    int index;
+    int64_t arg;
+    uint32_t mode;
+    uint64_t submit_time;
+} PS5_EmuFlip;
+
+static struct
+{
+    SDL_SpinLock lock;
+    SDL_bool open;
+    int buffers;
+    int flip_rate;       /* shows a flip every (flip_rate + 1) vblanks */
+    Uint64 last_vblank;  /* that showed a flip */
+    PS5_EmuFlip queue[PS5_EMU_MAX_FLIPS];
+    int queued;
+    int events;          /* flips not waited for yet */
+    PS5_VideoFlipStatus status;
+} emu_video;
+
+static Uint64 PS5_EmuVblankTime(Uint64 vblank)
+{
+    return vblank * 1000000 / PS5_EMU_REFRESH_RATE;
+}
+
+/* Time of the vblank the next queued flip shows at */
+static Uint64 PS5_EmuNextFlipTime(Uint64 *vblank_out)
+{
+    const PS5_EmuFlip *flip = &emu_video.queue[0];
+    const Uint64 rate = emu_video.flip_rate + 1;
+    Uint64 vblank;
+
+    /* Tearing flips go out right away */
+    if (flip->mode == PS5_VIDEO_OUT_FLIP_MODE_HSYNC) {
+        *vblank_out = emu_video.last_vblank;
+        return flip->submit_time;
+    }
+
+    vblank = flip->submit_time * PS5_EMU_REFRESH_RATE / 1000000 + 1;
+    vblank = SDL_max(vblank, emu_video.last_vblank + 1);
+    vblank = (vblank + rate - 1) / rate * rate;
+    *vblank_out = vblank;
+    return PS5_EmuVblankTime(vblank);
+}
+
+/* Show the flips whose vblank has come, must be called with the lock held */
+static void PS5_EmuFlipUntil(Uint64 now)
+{
+    while (emu_video.queued > 0) {
+        const PS5_EmuFlip *flip = &emu_video.queue[0];
+        Uint64 vblank;
+        const Uint64 time = PS5_EmuNextFlipTime(&vblank);
+
+        if (time > now) {
+            break;
+        }
+
+        emu_video.last_vblank = vblank;
+        emu_video.status.count++;
+        emu_video.status.process_time = time;
+        emu_video.status.tsc = time;
+        emu_video.status.flip_arg = flip->arg;
+        emu_video.status.submit_tsc = flip->submit_time;
+        emu_video.status.current_buffer = flip->index;
+        emu_video.events++;
+        SDL_memmove(emu_video.queue, emu_video.queue + 1, --emu_video.queued * sizeof(*flip));
+    }
+    emu_video.status.flip_pending_num = emu_video.queued;
+}
+
+int sceKernelCreateEqueue(PS5_KernelEqueue **eq, const char *name)
+{
+    *eq = (PS5_KernelEqueue *)SDL_calloc(1, sizeof(PS5_KernelEqueue));
+    if (!*eq) {
+        errno = ENOMEM;
+        return -1;
+    }
+    return 0;
+}
+
+int sceKernelWaitEqueue(PS5_KernelEqueue *eq, PS5_KernelEvent *ev, int num, int *out, unsigned int *timeout)
+{
+    for (;;) {
+        Uint64 vblank, time;
+
+        SDL_AtomicLock(&emu_video.lock);
+        PS5_EmuFlipUntil(PS5_EmuTime());
+        if (emu_video.events > 0) {
+            emu_video.events--;
+            SDL_AtomicUnlock(&emu_video.lock);
+            SDL_zerop(ev);
+            *out = 1;
+            return 0;
+        }
+        if (emu_video.queued == 0) {
+            /* Nothing would ever wake the console up */
+            SDL_AtomicUnlock(&emu_video.lock);
+            errno = EDEADLK;
+            return -1;
+        }
+        time = PS5_EmuNextFlipTime(&vblank);
+        SDL_AtomicUnlock(&emu_video.lock);
+
+        PS5_EmuSleepUntil(time);
+    }
+}
+
+int sceKernelDeleteEqueue(PS5_KernelEqueue *eq)
+{
+    SDL_free(eq);
+    return 0;
+}
+
+int sceVideoOutOpen(int user, int type, int index, const void *param)
+{
+    SDL_AtomicLock(&emu_video.lock);
+    if (emu_video.open) {
+        SDL_AtomicUnlock(&emu_video.lock);
+        errno = EBUSY;
+        return -1;
+    }
+    SDL_zero(emu_video.queue);
+    emu_video.open = SDL_TRUE;
+    emu_video.buffers = 0;
+    emu_video.flip_rate = 0;
+    emu_video.queued = 0;
+    emu_video.events = 0;
+    emu_video.last_vblank = PS5_EmuTime() * PS5_EMU_REFRESH_RATE / 1000000;
+    SDL_zero(emu_video.status);
+    SDL_AtomicUnlock(&emu_video.lock);
+    return 1;
+}
+
+void sceVideoOutClose(int handle)
+{
+    SDL_AtomicLock(&emu_video.lock);
+    emu_video.open = SDL_FALSE;
+    emu_video.buffers = 0;
+    emu_video.queued = 0;
+    SDL_AtomicUnlock(&emu_video.lock);
+}
+
+int sceVideoOutAddFlipEvent(PS5_KernelEqueue *eq, int handle, void *udata)
+{
+    return 0;
+}
+
+int sceVideoOutDeleteFlipEvent(PS5_KernelEqueue *eq, int handle)
+{
+    return 0;
+}
+
+int sceVideoOutSetFlipRate(int handle, int rate)
+{
+    if (rate < 0 || rate > 2) {
+        errno = EINVAL;
+        return -1;
+    }
+    SDL_AtomicLock(&emu_video.lock);
+    emu_video.flip_rate = rate;
+    SDL_AtomicUnlock(&emu_video.lock);
+    return 0;
+}
+
+int sceVideoOutSubmitFlip(int handle, int index, uint32_t mode, int64_t arg)
+{
+    const Uint64 now = PS5_EmuTime();
+    PS5_EmuFlip *flip;
+
+    SDL_AtomicLock(&emu_video.lock);
+    PS5_EmuFlipUntil(now);
+    if (index < 0 || index >= emu_video.buffers || emu_video.queued == PS5_EMU_MAX_FLIPS) {
+        SDL_AtomicUnlock(&emu_video.lock);
+        errno = EINVAL;
+        return -1;
+    }
+    flip = &emu_video.queue[emu_video.queued++];
+    flip->index = index;
+    flip->arg = arg;
+    flip->mode = mode;
+    flip->submit_time = now;
+    PS5_EmuFlipUntil(now);
+    SDL_AtomicUnlock(&emu_video.lock);
+    return 0;
+}
+
+int sceVideoOutGetFlipStatus(int handle, PS5_VideoFlipStatus *status)
+{
+    SDL_AtomicLock(&emu_video.lock);
+    PS5_EmuFlipUntil(PS5_EmuTime());
+    *status = emu_video.status;
+    SDL_AtomicUnlock(&emu_video.lock);
+    return 0;
+}
+
+void sceVideoOutSetBufferAttribute2(PS5_VideoAttr *attr, uint64_t format, uint32_t tiling,
+                                    uint32_t width, uint32_t height, uint64_t option,
+                                    uint32_t dcc, uint64_t clear)
+{
+    SDL_zerop(attr);
+}
+
+int sceVideoOutRegisterBuffers2(int handle, int set, int start, PS5_VideoBuf *bufs, int num,
+                                PS5_VideoAttr *attr, int category, void *option)
+{
+    SDL_AtomicLock(&emu_video.lock);
+    if (emu_video.buffers > 0) {
+        SDL_AtomicUnlock(&emu_video.lock);
+        errno = EBUSY;
+        return -1;
+    }
+    emu_video.buffers = num;
+    SDL_AtomicUnlock(&emu_video.lock);
+    return 0;
+}
+
+int sceSystemServiceHideSplashScreen(void)
+{
+    return 0;
+}
+
+
+/* Audio ports, paced by the clock of the host */
+
+typedef struct PS5_EmuAudioPort
+{
+    SDL_bool used;
+    Uint64 grain_time; /* in microseconds */
+    Uint64 next_time;  /* when the grain playing or recording is done */
+    int frame_size;    /* of captured data */
+    uint32_t len;
+} PS5_EmuAudioPort;
+
+static PS5_EmuAudioPort emu_audio_ports[PS5_EMU_AUDIO_PORTS];
+static SDL_SpinLock emu_audio_lock;
+
+static int32_t PS5_EmuOpenAudioPort(uint32_t len, uint32_t freq, int frame_size)
+{
+    int32_t handle = -1;
+
+    if (len == 0 || freq == 0) {
+        return -EINVAL;
+    }
+
+    SDL_AtomicLock(&emu_audio_lock);
+    for (int i = 0; i < PS5_EMU_AUDIO_PORTS; i++) {
+        PS5_EmuAudioPort *port = &emu_audio_ports[i];
+
+        if (!port->used) {
+            port->used = SDL_TRUE;
+            port->grain_time = (Uint64)len * 1000000 / freq;
+            port->next_time = 0;
+            port->frame_size = frame_size;
+            port->len = len;
+            handle = i + 1;
+            break;
+        }
+    }
+    SDL_AtomicUnlock(&emu_audio_lock);
+
+    return (handle > 0) ? handle : -EBUSY;
+}
+
+static PS5_EmuAudioPort *PS5_EmuGetAudioPort(int32_t handle)
+{
+    if (handle < 1 || handle > PS5_EMU_AUDIO_PORTS || !emu_audio_ports[handle - 1].used) {
+        return NULL;
+    }
+    return &emu_audio_ports[handle - 1];
+}
+
+int32_t sceAudioOutInit(void)
+{
+    return 0;
+}
+
+int32_t sceAudioOutOpen(int32_t userId, int32_t type, int32_t index,
+                        uint32_t len, uint32_t freq, uint32_t param)
+{
+    return PS5_EmuOpenAudioPort(len, freq, 0);
+}
+
+int32_t sceAudioOutOutput(int32_t handle, const void *p)
+{
+    PS5_EmuAudioPort *port = PS5_EmuGetAudioPort(handle);
+    Uint64 now;
+
+    if (!port) {
+        return -EINVAL;
+    }
+    if (!p) {
+        return 0;
+    }
+
+    /* Returns once the grain before this one starts playing, after an
+       underrun the port starts over from now */
+    now = PS5_EmuTime();
+    if (port->next_time < now) {
+        port->next_time = now;
+    }
+    if (port->next_time > now + port->grain_time) {
+        PS5_EmuSleepUntil(port->next_time - port->grain_time);
+    }
+    port->next_time += port->grain_time;
+    return 0;
+}
+
+int32_t sceAudioOutClose(int32_t handle)
+{
+    PS5_EmuAudioPort *port = PS5_EmuGetAudioPort(handle);
+
+    if (!port) {
+        return -EINVAL;
+    }
+    port->used = SDL_FALSE;
+    return 0;
+}
+
+int32_t sceAudioInOpen(int32_t userId, uint32_t type, uint32_t index,
+                       uint32_t len, uint32_t freq, uint32_t param)
+{
+    const int channels = (param == PROSPERO_AUDIO_IN_PARAM_FORMAT_S16_MONO) ? 1 : 2;
+
+    return PS5_EmuOpenAudioPort(len, freq, channels * sizeof(Sint16));
+}
+
+int32_t sceAudioInInput(int32_t handle, void *dest)
+{
+    PS5_EmuAudioPort *port = PS5_EmuGetAudioPort(handle);
+    Uint64 now;
+
+    if (!port || !port->frame_size) {
+        return -EINVAL;
+    }
+
+    /* Silence, a grain at a time, as it would have been recorded. A
+       reader that fell behind gets what was recorded in the meantime
+       without waiting, up to what the hardware keeps. */
+    now = PS5_EmuTime();
+    if (!port->next_time || port->next_time + port->grain_time * 8 < now) {
+        port->next_time = now + port->grain_time;
+    }
+    PS5_EmuSleepUntil(port->next_time);
+    port->next_time += port->grain_time;
+
+    SDL_memset(dest, 0, (size_t)port->len * port->frame_size);
+    return (int32_t)port->len;
+}
+
+int32_t sceAudioInClose(int32_t handle)
+{
+    return sceAudioOutClose(handle);
+}
+
+
+/* The user, their pad and their keyboard */
+
+int sceUserServiceInitialize(void *params)
+{
+    return 0;
+}
+
+int sceUserServiceGetForegroundUser(int *user_id)
+{
+    *user_id = PS5_EMU_USER_ID;
+    return 0;
+}
+
+int sceUserServiceGetLoginUserIdList(int user_ids[4])
+{
+    user_ids[0] = PS5_EMU_USER_ID;
+    user_ids[1] = user_ids[2] = user_ids[3] = -1;
+    return 0;
+}
+
+int sceUserServiceGetEvent(PS5_UserServiceEvent *event)
+{
+    return 0x80960007; /* no event */
+}
+
+int scePadInit(void)
+{
+    return 0;
+}
+
+int scePadOpen(int user_id, int type, int index, void *param)
+{
+    return (user_id == PS5_EMU_USER_ID) ? 0x100 + user_id : -1;
+}
+
+int scePadReadState(int handle, PS5_PadData *data)
+{
+    SDL_zerop(data);
+    data->connected = 1;
+    data->leftStick.x = data->leftStick.y = 128;
+    data->rightStick.x = data->rightStick.y = 128;
+    data->timestamp = PS5_EmuTime();
+    return 0;
+}
+
+int scePadSetMotionSensorState(int handle, uint8_t enable)
+{
+    return 0;
+}
+
+int scePadSetVibration(int handle, const PS5_PadVibrationParam *param)
+{
+    return 0;
+}
+
+int scePadSetLightBar(int handle, const PS5_PadLightBarParam *param)
+{
+    return 0;
+}
+
+int scePadSetTriggerEffect(int handle, const PS5_PadTriggerEffectParam *param)
+{
+    return 0;
+}
+
+int scePadClose(int handle)
+{
+    return 0;
+}
+
+int sceKeyboardInit(void)
+{
+    return 0;
+}
+
+int sceKeyboardOpen(int user_id, int type, int index, void *param)
+{
+    return 1;
+}
+
+int sceKeyboardReadState(int handle, keyboard_state_t *state)
+{
+    SDL_zerop(state);
+    state->available = 1;
+    return 0;
+}
+
+int sceKeyboardRead(int handle, keyboard_state_t *states, int count)
+{
+    return 0;
+}
+
+int sceKeyboardClose(int handle)
+{
+    return 0;
+}
+
+int sceImeDialogInit(const SceImeDialogParam *param, void *extended)
+{
+    return 0;
+}
+
+int sceImeDialogGetResult(SceImeDialogResult *result)
+{
+    SDL_zerop(result);
+    result->outcome = SCE_IME_DIALOG_END_STATUS_ABORTED;
+    return 0;
+}
+
+int sceImeDialogTerm(void)
+{
+    return 0;
+}
+
+SceImeDialogStatus sceImeDialogGetStatus(void)
+{
+    return SCE_IME_DIALOG_STATUS_NONE;
+}
+
+#endif /* SDL_PS5_HOST_EMULATION */
+
+/* vi: set ts=4 sw=4 expandtab: */
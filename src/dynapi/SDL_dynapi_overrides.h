@@ -898,3 +898,8 @@
 #define SDL_DestroyWindowSurface SDL_DestroyWindowSurface_REAL
 #define SDL_GDKGetDefaultUser SDL_GDKGetDefaultUser_REAL
 #define SDL_GameControllerGetSteamHandle SDL_GameControllerGetSteamHandle_REAL
+#define SDL_PS5GetFlipStats SDL_PS5GetFlipStats_REAL
+#define SDL_PS5GetVideoMemoryUsage SDL_PS5GetVideoMemoryUsage_REAL
+#define SDL_PS5GetAudioDeviceLatency SDL_PS5GetAudioDeviceLatency_REAL
+#define SDL_RWFromMappedFile SDL_RWFromMappedFile_REAL
+#define SDL_RWFromBuffered SDL_RWFromBuffered_REAL
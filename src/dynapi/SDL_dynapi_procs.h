@@ -985,3 +985,10 @@ SDL_DYNAPI_PROC(int,SDL_DestroyWindowSurface,(SDL_Window *a),(a),return)
 SDL_DYNAPI_PROC(int,SDL_GDKGetDefaultUser,(XUserHandle *a),(a),return)
 #endif
 SDL_DYNAPI_PROC(Uint64,SDL_GameControllerGetSteamHandle,(SDL_GameController *a),(a),return)
+#if defined(__PROSPERO__) || defined(SDL_PS5_HOST_EMULATION)
+SDL_DYNAPI_PROC(int,SDL_PS5GetFlipStats,(SDL_PS5FlipStats *a, SDL_bool b),(a,b),return)
+SDL_DYNAPI_PROC(size_t,SDL_PS5GetVideoMemoryUsage,(void),(),return)
+SDL_DYNAPI_PROC(int,SDL_PS5GetAudioDeviceLatency,(SDL_AudioDeviceID a),(a),return)
+#endif
+SDL_DYNAPI_PROC(SDL_RWops*,SDL_RWFromMappedFile,(const char *a),(a),return)
+SDL_DYNAPI_PROC(SDL_RWops*,SDL_RWFromBuffered,(SDL_RWops *a, size_t b),(a,b),return)
@@ -27,6 +27,7 @@
 #include "SDL_thread.h"
 #include "SDL_events_c.h"
 #include "../SDL_hints_c.h"
+#include "../SDL_trace_c.h"
 #include "../timer/SDL_timer_c.h"
 #ifndef SDL_JOYSTICK_DISABLED
 #include "../joystick/SDL_joystick_c.h"
@@ -910,6 +911,8 @@ static void SDL_PumpEventsInternal(SDL_bool push_sentinel)
 {
     SDL_VideoDevice *_this = SDL_GetVideoDevice();
 
+    SDL_TRACE_BEGIN("SDL_PumpEvents");
+
     /* Release any keys held down from last frame */
     SDL_ReleaseAutoReleaseKeys();
 
@@ -946,6 +949,8 @@ static void SDL_PumpEventsInternal(SDL_bool push_sentinel)
         sentinel.type = SDL_POLLSENTINEL;
         SDL_PushEvent(&sentinel);
     }
+
+    SDL_TRACE_END("SDL_PumpEvents");
 }
 
 void SDL_PumpEvents(void)
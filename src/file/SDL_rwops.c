@@ -48,6 +48,7 @@
 */
 
 #include "SDL_endian.h"
+#include "SDL_hints.h"
 #include "SDL_rwops.h"
 
 #ifdef __APPLE__
@@ -67,6 +68,17 @@
 #include "nacl_io/nacl_io.h"
 #endif
 
+/* Files opened for reading can be served from a mapping of them */
+#if defined(HAVE_STDIO_H) && \
+    (defined(__LINUX__) || defined(__MACOSX__) || defined(__FREEBSD__) || \
+     defined(__NETBSD__) || defined(__OPENBSD__) || defined(__PROSPERO__))
+#define SDL_RWOPS_MMAP 1
+#include <sys/mman.h>
+
+/* Below this, stdio costs less than setting up the mapping */
+#define SDL_RWOPS_MMAP_MIN_SIZE (64 * 1024)
+#endif
+
 #if defined(__WIN32__) || defined(__GDK__)
 
 /* Functions to read/write Win32 API file pointers */
@@ -522,6 +534,244 @@ static int SDLCALL mem_close(SDL_RWops *context)
     return 0;
 }
 
+#ifdef SDL_RWOPS_MMAP
+
+/* Functions to read memory mapped files, as read-only memory */
+
+static int SDLCALL mmap_close(SDL_RWops *context)
+{
+    int status = 0;
+
+    if (context) {
+        if (munmap(context->hidden.mem.base,
+                   context->hidden.mem.stop - context->hidden.mem.base) < 0) {
+            status = SDL_SetError("Error unmapping file: %s", strerror(errno));
+        }
+        SDL_FreeRW(context);
+    }
+    return status;
+}
+
+/* The descriptor can be closed once the file is mapped */
+static SDL_RWops *SDL_RWFromMappedFD(int fd, Sint64 size)
+{
+    SDL_RWops *rwops;
+    void *base;
+
+    if (size <= 0 || (Uint64)size > SDL_SIZE_MAX) {
+        SDL_SetError("Can't map a file of %" SDL_PRIs64 " bytes", size);
+        return NULL;
+    }
+
+    base = mmap(NULL, (size_t)size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (base == MAP_FAILED) {
+        SDL_SetError("Error mapping file: %s", strerror(errno));
+        return NULL;
+    }
+
+    rwops = SDL_AllocRW();
+    if (!rwops) {
+        munmap(base, (size_t)size);
+        return NULL;
+    }
+    rwops->size = mem_size;
+    rwops->seek = mem_seek;
+    rwops->read = mem_read;
+    rwops->write = mem_writeconst;
+    rwops->close = mmap_close;
+    rwops->hidden.mem.base = (Uint8 *)base;
+    rwops->hidden.mem.here = rwops->hidden.mem.base;
+    rwops->hidden.mem.stop = rwops->hidden.mem.base + size;
+    rwops->type = SDL_RWOPS_MEMORY_RO;
+    return rwops;
+}
+
+/* Map a file opened for reading only if it's large enough to be worth it,
+   returns NULL to read it through stdio */
+static SDL_RWops *SDL_RWFromLargeFP(FILE *fp, const char *mode)
+{
+    struct stat st;
+
+    if (*mode != 'r' || SDL_strchr(mode, '+') ||
+        !SDL_GetHintBoolean(SDL_HINT_RWOPS_FILE_MAPPING, SDL_TRUE)) {
+        return NULL;
+    }
+    if (fstat(fileno(fp), &st) < 0 || !S_ISREG(st.st_mode) ||
+        st.st_size < SDL_RWOPS_MMAP_MIN_SIZE) {
+        return NULL;
+    }
+    return SDL_RWFromMappedFD(fileno(fp), st.st_size);
+}
+
+#endif /* SDL_RWOPS_MMAP */
+
+/* Functions to read ahead of another stream */
+
+/* Read-ahead past this default, parsers mostly read a few bytes at a time */
+#define SDL_RWOPS_BUFFER_SIZE (16 * 1024)
+
+typedef struct SDL_RWbuffer
+{
+    SDL_RWops *inner;
+    Sint64 offset; /* of the inner stream, at stop, or -1 if unknown */
+    Uint8 *here;   /* the unread bytes are here to stop */
+    Uint8 *stop;
+    size_t size;
+    Uint8 data[1];
+} SDL_RWbuffer;
+
+static void SDL_RWbufferDrop(SDL_RWbuffer *buffer)
+{
+    buffer->here = buffer->stop = buffer->data;
+}
+
+static Sint64 SDLCALL buffered_size(SDL_RWops *context)
+{
+    SDL_RWbuffer *buffer = (SDL_RWbuffer *)context->hidden.unknown.data1;
+
+    return SDL_RWsize(buffer->inner);
+}
+
+static Sint64 SDLCALL buffered_seek(SDL_RWops *context, Sint64 offset, int whence)
+{
+    SDL_RWbuffer *buffer = (SDL_RWbuffer *)context->hidden.unknown.data1;
+    const Sint64 unread = (Sint64)(buffer->stop - buffer->here);
+
+    if (buffer->offset >= 0) {
+        if (whence == RW_SEEK_CUR) {
+            offset += buffer->offset - unread;
+            whence = RW_SEEK_SET;
+        }
+        /* Stay in the buffer when the offset is in what was read ahead */
+        if (whence == RW_SEEK_SET && offset <= buffer->offset &&
+            offset >= buffer->offset - (Sint64)(buffer->stop - buffer->data)) {
+            buffer->here = buffer->stop - (size_t)(buffer->offset - offset);
+            return offset;
+        }
+    } else if (whence == RW_SEEK_CUR) {
+        offset -= unread;
+    }
+
+    offset = SDL_RWseek(buffer->inner, offset, whence);
+    if (offset >= 0) {
+        SDL_RWbufferDrop(buffer);
+        buffer->offset = offset;
+    }
+    return offset;
+}
+
+static size_t SDLCALL
+buffered_read(SDL_RWops *context, void *ptr, size_t size, size_t maxnum)
+{
+    SDL_RWbuffer *buffer = (SDL_RWbuffer *)context->hidden.unknown.data1;
+    Uint8 *dst = (Uint8 *)ptr;
+    size_t total_bytes, left, available, read;
+
+    total_bytes = (maxnum * size);
+    if (!maxnum || !size || ((total_bytes / maxnum) != size)) {
+        return 0;
+    }
+
+    left = total_bytes;
+    while (left > 0) {
+        available = (size_t)(buffer->stop - buffer->here);
+        if (available > 0) {
+            available = SDL_min(available, left);
+            SDL_memcpy(dst, buffer->here, available);
+            buffer->here += available;
+            dst += available;
+            left -= available;
+            continue;
+        }
+
+        /* Large reads go straight to the caller, small ones refill */
+        if (left >= buffer->size) {
+            SDL_RWbufferDrop(buffer);
+            read = SDL_RWread(buffer->inner, dst, 1, left);
+            dst += read;
+            left -= read;
+        } else {
+            read = SDL_RWread(buffer->inner, buffer->data, 1, buffer->size);
+            buffer->here = buffer->data;
+            buffer->stop = buffer->data + read;
+        }
+        if (buffer->offset >= 0) {
+            buffer->offset += read;
+        }
+        if (read == 0) {
+            break;
+        }
+    }
+    return (total_bytes - left) / size;
+}
+
+static size_t SDLCALL
+buffered_write(SDL_RWops *context, const void *ptr, size_t size, size_t num)
+{
+    SDL_RWbuffer *buffer = (SDL_RWbuffer *)context->hidden.unknown.data1;
+    const Sint64 unread = (Sint64)(buffer->stop - buffer->here);
+    Sint64 offset;
+    size_t written;
+
+    /* Put the inner stream back where the reader is, it is at stop */
+    if (unread > 0) {
+        if (buffer->offset >= 0) {
+            offset = SDL_RWseek(buffer->inner, buffer->offset - unread, RW_SEEK_SET);
+        } else {
+            offset = SDL_RWseek(buffer->inner, -unread, RW_SEEK_CUR);
+        }
+        if (offset < 0) {
+            return 0;
+        }
+        buffer->offset = offset;
+    }
+    SDL_RWbufferDrop(buffer);
+
+    written = SDL_RWwrite(buffer->inner, ptr, size, num);
+    if (buffer->offset >= 0) {
+        buffer->offset += (Sint64)(written * size);
+    }
+    return written;
+}
+
+static int SDLCALL buffered_close(SDL_RWops *context)
+{
+    int status = 0;
+
+    if (context) {
+        SDL_RWbuffer *buffer = (SDL_RWbuffer *)context->hidden.unknown.data1;
+
+        status = SDL_RWclose(buffer->inner);
+        SDL_free(buffer);
+        SDL_FreeRW(context);
+    }
+    return status;
+}
+
+/* Take a small read straight out of memory when the bytes are there,
+   without going through the stream's read function */
+static SDL_INLINE SDL_bool SDL_RWreadFast(SDL_RWops *context, void *ptr, size_t size)
+{
+    /* Only our own streams, the type and read function of a stream are
+       the app's to change */
+    if (context->read == buffered_read) {
+        SDL_RWbuffer *buffer = (SDL_RWbuffer *)context->hidden.unknown.data1;
+
+        if ((size_t)(buffer->stop - buffer->here) >= size) {
+            SDL_memcpy(ptr, buffer->here, size);
+            buffer->here += size;
+            return SDL_TRUE;
+        }
+    } else if (context->read == mem_read) {
+        if ((size_t)(context->hidden.mem.stop - context->hidden.mem.here) >= size) {
+            SDL_memcpy(ptr, context->hidden.mem.here, size);
+            context->hidden.mem.here += size;
+            return SDL_TRUE;
+        }
+    }
+    return SDL_FALSE;
+}
+
 /* Functions to create SDL_RWops structures from various data sources */
 
 #if defined(HAVE_STDIO_H) && !(defined(__WIN32__) || defined(__GDK__))
@@ -639,6 +889,13 @@ SDL_RWops *SDL_RWFromFile(const char *file, const char *mode)
             fp = NULL;
             SDL_SetError("%s is not a regular file or pipe", file);
         } else {
+#ifdef SDL_RWOPS_MMAP
+            rwops = SDL_RWFromLargeFP(fp, mode);
+            if (rwops) {
+                fclose(fp);
+                return rwops;
+            }
+#endif
             rwops = SDL_RWFromFP(fp, SDL_TRUE);
         }
     }
@@ -729,6 +986,78 @@ SDL_RWops *SDL_RWFromConstMem(const void *mem, int size)
     return rwops;
 }
 
+SDL_RWops *SDL_RWFromMappedFile(const char *file)
+{
+#ifdef SDL_RWOPS_MMAP
+    SDL_RWops *rwops = NULL;
+    struct stat st;
+    FILE *fp;
+
+    if (!file || !*file) {
+        SDL_InvalidParamError("file");
+        return NULL;
+    }
+
+#if defined(__APPLE__) && !defined(SDL_FILE_DISABLED)
+    fp = SDL_OpenFPFromBundleOrFallback(file, "rb");
+#else
+    fp = fopen(file, "rb");
+#endif
+    if (!fp) {
+        SDL_SetError("Couldn't open %s: %s", file, strerror(errno));
+        return NULL;
+    }
+    if (fstat(fileno(fp), &st) < 0 || !S_ISREG(st.st_mode)) {
+        SDL_SetError("%s is not a regular file", file);
+    } else {
+        rwops = SDL_RWFromMappedFD(fileno(fp), st.st_size);
+    }
+    fclose(fp);
+    return rwops;
+#else
+    SDL_Unsupported();
+    return NULL;
+#endif
+}
+
+SDL_RWops *SDL_RWFromBuffered(SDL_RWops *inner, size_t bufsize)
+{
+    SDL_RWbuffer *buffer;
+    SDL_RWops *rwops;
+
+    if (!inner) {
+        SDL_InvalidParamError("inner");
+        return NULL;
+    }
+    if (bufsize == 0) {
+        bufsize = SDL_RWOPS_BUFFER_SIZE;
+    }
+
+    buffer = (SDL_RWbuffer *)SDL_malloc(sizeof(*buffer) + bufsize);
+    if (!buffer) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    rwops = SDL_AllocRW();
+    if (!rwops) {
+        SDL_free(buffer);
+        return NULL;
+    }
+    buffer->inner = inner;
+    buffer->offset = SDL_RWtell(inner);
+    buffer->size = bufsize;
+    SDL_RWbufferDrop(buffer);
+
+    rwops->size = buffered_size;
+    rwops->seek = buffered_seek;
+    rwops->read = buffered_read;
+    rwops->write = buffered_write;
+    rwops->close = buffered_close;
+    rwops->hidden.unknown.data1 = buffer;
+    rwops->type = SDL_RWOPS_BUFFERED;
+    return rwops;
+}
+
 SDL_RWops *SDL_AllocRW(void)
 {
     SDL_RWops *area;
@@ -754,6 +1083,7 @@ void *SDL_LoadFile_RW(SDL_RWops *src, size_t *datasize, int freesrc)
     Sint64 size;
     size_t size_read, size_total = 0;
     void *data = NULL, *newdata;
+    SDL_bool loading_chunks = SDL_FALSE;
 
     if (!src) {
         SDL_InvalidParamError("src");
@@ -763,6 +1093,7 @@ void *SDL_LoadFile_RW(SDL_RWops *src, size_t *datasize, int freesrc)
     size = SDL_RWsize(src);
     if (size < 0) {
         size = FILE_CHUNK_SIZE;
+        loading_chunks = SDL_TRUE;
     }
     data = SDL_malloc((size_t)(size + 1));
     if (!data) {
@@ -771,7 +1102,20 @@ void *SDL_LoadFile_RW(SDL_RWops *src, size_t *datasize, int freesrc)
     }
 
     for (;;) {
-        if ((((Sint64)size_total) + FILE_CHUNK_SIZE) > size) {
+        /* A stream of known size is read in place, without growing the
+           buffer to find out it has ended. It may still be longer than it
+           said, as files in /proc are, which the byte kept for the
+           terminator tells. */
+        if (!loading_chunks && (Sint64)size_total == size) {
+            size_read = SDL_RWread(src, (char *)data + size_total, 1, 1);
+            if (size_read == 0) {
+                break;
+            }
+            size_total += size_read;
+            loading_chunks = SDL_TRUE;
+            continue;
+        }
+        if (loading_chunks && (((Sint64)size_total) + FILE_CHUNK_SIZE) > size) {
             size = (size_total + FILE_CHUNK_SIZE);
             newdata = SDL_realloc(data, (size_t)(size + 1));
             if (!newdata) {
@@ -845,7 +1189,9 @@ Uint8 SDL_ReadU8(SDL_RWops *src)
 {
     Uint8 value = 0;
 
-    SDL_RWread(src, &value, sizeof(value), 1);
+    if (!SDL_RWreadFast(src, &value, sizeof(value))) {
+        SDL_RWread(src, &value, sizeof(value), 1);
+    }
     return value;
 }
 
@@ -853,7 +1199,9 @@ Uint16 SDL_ReadLE16(SDL_RWops *src)
 {
     Uint16 value = 0;
 
-    SDL_RWread(src, &value, sizeof(value), 1);
+    if (!SDL_RWreadFast(src, &value, sizeof(value))) {
+        SDL_RWread(src, &value, sizeof(value), 1);
+    }
     return SDL_SwapLE16(value);
 }
 
@@ -861,7 +1209,9 @@ Uint16 SDL_ReadBE16(SDL_RWops *src)
 {
     Uint16 value = 0;
 
-    SDL_RWread(src, &value, sizeof(value), 1);
+    if (!SDL_RWreadFast(src, &value, sizeof(value))) {
+        SDL_RWread(src, &value, sizeof(value), 1);
+    }
     return SDL_SwapBE16(value);
 }
 
@@ -869,7 +1219,9 @@ Uint32 SDL_ReadLE32(SDL_RWops *src)
 {
     Uint32 value = 0;
 
-    SDL_RWread(src, &value, sizeof(value), 1);
+    if (!SDL_RWreadFast(src, &value, sizeof(value))) {
+        SDL_RWread(src, &value, sizeof(value), 1);
+    }
     return SDL_SwapLE32(value);
 }
 
@@ -877,7 +1229,9 @@ Uint32 SDL_ReadBE32(SDL_RWops *src)
 {
     Uint32 value = 0;
 
-    SDL_RWread(src, &value, sizeof(value), 1);
+    if (!SDL_RWreadFast(src, &value, sizeof(value))) {
+        SDL_RWread(src, &value, sizeof(value), 1);
+    }
     return SDL_SwapBE32(value);
 }
 
@@ -885,7 +1239,9 @@ Uint64 SDL_ReadLE64(SDL_RWops *src)
 {
     Uint64 value = 0;
 
-    SDL_RWread(src, &value, sizeof(value), 1);
+    if (!SDL_RWreadFast(src, &value, sizeof(value))) {
+        SDL_RWread(src, &value, sizeof(value), 1);
+    }
     return SDL_SwapLE64(value);
 }
 
@@ -893,7 +1249,9 @@ Uint64 SDL_ReadBE64(SDL_RWops *src)
 {
     Uint64 value = 0;
 
-    SDL_RWread(src, &value, sizeof(value), 1);
+    if (!SDL_RWreadFast(src, &value, sizeof(value))) {
+        SDL_RWread(src, &value, sizeof(value), 1);
+    }
     return SDL_SwapBE64(value);
 }
 
@@ -20,18 +20,30 @@
 */
 #include "../../SDL_internal.h"
 
-#if SDL_JOYSTICK_PS5
+#if defined(SDL_JOYSTICK_PS5) || defined(SDL_PS5_HOST_TEST)
 
 #include <errno.h>
+#include <stdlib.h>
+#include <string.h>
 
 #include "../SDL_sysjoystick.h"
+#include "../../thread/SDL_systhread.h"
+#include "SDL_atomic.h"
+#include "SDL_bits.h"
 #include "SDL_error.h"
 #include "SDL_events.h"
+#include "SDL_hints.h"
+#include "SDL_mutex.h"
+#include "SDL_timer.h"
 
 #include "SDL_ps5joystick.h"
 
 #define PS5_MAX_USERS 4
 
+// How often the login list and the pads that aren't open are checked, in
+// milliseconds. Logins and logouts also come as user service events.
+#define PS5_PAD_POLL_INTERVAL 2000
+
 #define PS5_PAD_AXIS_LX 0
 #define PS5_PAD_AXIS_LY 1
 #define PS5_PAD_AXIS_RX 2
@@ -39,18 +51,102 @@
 #define PS5_PAD_AXIS_L2 4
 #define PS5_PAD_AXIS_R2 5
 
-typedef struct PS5_PadContext
+// Size of the touchpad in the units of PS5_PadTouch
+#define PS5_PAD_TOUCHPAD_WIDTH  1920
+#define PS5_PAD_TOUCHPAD_HEIGHT 1070
+
+// Rate the pad service updates the motion sensors at
+#define PS5_PAD_SENSOR_RATE 250.0f
+
+// Frequency of the trigger vibration SDL_JoystickRumbleTriggers() sets
+#define PS5_PAD_TRIGGER_RUMBLE_FREQUENCY 100
+
+// Output waiting for the next update, see PS5_PadSendOutput()
+#define PS5_PAD_OUTPUT_VIBRATION 0x01
+#define PS5_PAD_OUTPUT_LIGHTBAR  0x02
+#define PS5_PAD_OUTPUT_TRIGGERS  0x04
+
+// How often the input thread reads the pads, in milliseconds
+#define PS5_PAD_SAMPLE_INTERVAL 2
+
+// Changes the input thread keeps for the next update, a power of two
+#define PS5_PAD_RING_SIZE 64
+
+typedef struct PS5_PadSample
+{
+    Uint64 ticks; // performance counter when the pad was read
+    PS5_PadData pad;
+} PS5_PadSample;
+
+// A slot per logged in user, whose pad is open from login to logout. It
+// is an SDL device while the pad is connected, and the hwdata of the
+// joystick while that is open.
+typedef struct joystick_hwdata
 {
     int user_id;
     int handle;
-    char* name;
+    SDL_bool present; // SDL_PrivateJoystickAdded() was sent for instance_id
+    SDL_bool opened;  // by SDL_JoystickOpen(), so read by the input thread
     SDL_JoystickGUID global_id;
     SDL_JoystickID instance_id;
     PS5_PadData pad;
+    // Set while the app has a sensor enabled, read by the input thread
+    SDL_atomic_t sensors_enabled;
+
+    // States that differ from the one before, written by the input thread
+    // and read by PS5_JoystickUpdate. Each side only moves its own index.
+    PS5_PadSample ring[PS5_PAD_RING_SIZE];
+    SDL_atomic_t ring_head;
+    SDL_atomic_t ring_tail;
+    // Last state put in the ring, only used by the input thread
+    PS5_PadData sampled;
+    // Changes that didn't fit in the ring, and were put off until there
+    // was room for them again
+    SDL_atomic_t overflows;
+
+    // Output set since the last update, where it is sent once however
+    // many times it was set. Triggers in triggerMask have a new command.
+    Uint32 output;
+    PS5_PadVibrationParam vibration;
+    PS5_PadLightBarParam lightbar;
+    PS5_PadTriggerEffectParam triggers;
 } PS5_PadContext;
 
 static PS5_PadContext pad_ctx[PS5_MAX_USERS];
 
+// The input thread, when SDL_HINT_PS5_JOYSTICK_THREAD is set. The lock is
+// held while it reads the pads, so that none is closed under it.
+static SDL_Thread *pad_thread;
+static SDL_mutex *pad_lock;
+static SDL_atomic_t pad_thread_quit;
+
+static Uint64 pad_next_poll;
+
+static const char pad_name[] = "Sony DualSense";
+
+// The slot of the device_index'th pad that is connected
+static PS5_PadContext *PS5_GetPadByDeviceIndex(int device_index)
+{
+    for (int i = 0; i < SDL_arraysize(pad_ctx); i++) {
+        if (pad_ctx[i].present && device_index-- == 0) {
+            return &pad_ctx[i];
+        }
+    }
+    return NULL;
+}
+
+// The slot of an open joystick, unless its pad was removed and the slot
+// went to another since
+static PS5_PadContext *PS5_GetPadContext(SDL_Joystick *joystick)
+{
+    PS5_PadContext *ctx = joystick->hwdata;
+
+    if (!ctx || ctx->instance_id != joystick->instance_id) {
+        return NULL;
+    }
+    return ctx;
+}
+
 // Map analog inputs from [0, 255] to [-32768, 32767]
 static int analog_map[256] = {
     -32767, -32759, -32742, -32712, -32671, -32618, -32553, -32478, -32392,
@@ -81,13 +177,15 @@ static int analog_map[256] = {
     32767
 };
 
-static const unsigned int btn_map[] = {
+// The scePad button each SDL button is, the bit of the SDL button in the
+// word PS5_PadButtons() makes is its index here
+static const uint32_t btn_map[] = {
     PS5_PAD_BUTTON_CROSS,     // a:b0
     PS5_PAD_BUTTON_CIRCLE,    // b:b1
     PS5_PAD_BUTTON_SQUARE,    // x:b2
     PS5_PAD_BUTTON_TRIANGLE,  // y:b3
     PS5_PAD_BUTTON_OPTIONS,   // back:b4
-    -1,                       // guide:b5
+    0,                        // guide:b5
     PS5_PAD_BUTTON_TOUCH_PAD, // start:b6
     PS5_PAD_BUTTON_L3,        // leftstick:b7
     PS5_PAD_BUTTON_R3,        // rightstick:b8
@@ -101,26 +199,55 @@ static const unsigned int btn_map[] = {
     PS5_PAD_BUTTON_R2         // righttrigger:b16
 };
 
-static SDL_JoystickID PS5_JoystickGetDeviceInstanceID(int device_index)
+// The d-pad bits are in the order of SDL's hat bits
+SDL_COMPILE_TIME_ASSERT(ps5_hat_up, (PS5_PAD_BUTTON_UP >> 4) == SDL_HAT_UP);
+SDL_COMPILE_TIME_ASSERT(ps5_hat_right, (PS5_PAD_BUTTON_RIGHT >> 4) == SDL_HAT_RIGHT);
+SDL_COMPILE_TIME_ASSERT(ps5_hat_down, (PS5_PAD_BUTTON_DOWN >> 4) == SDL_HAT_DOWN);
+SDL_COMPILE_TIME_ASSERT(ps5_hat_left, (PS5_PAD_BUTTON_LEFT >> 4) == SDL_HAT_LEFT);
+
+static Uint8 PS5_PadHat(uint32_t buttons)
+{
+    return (Uint8)((buttons >> 4) & 0xF);
+}
+
+// btn_map by byte of the scePad buttons, the SDL buttons of each value
+// of bytes 0 to 2, see PS5_PadInitButtons()
+static Uint32 btn_lut[3][256];
+
+static void PS5_PadInitButtons(void)
 {
-    if (device_index < 0 || device_index >= SDL_arraysize(pad_ctx)) {
-        return -1;
+    for (int byte = 0; byte < SDL_arraysize(btn_lut); byte++) {
+        for (uint32_t value = 0; value < 256; value++) {
+            Uint32 sdl_buttons = 0;
+
+            for (int i = 0; i < SDL_arraysize(btn_map); i++) {
+                if ((value << (byte * 8)) & btn_map[i]) {
+                    sdl_buttons |= 1u << i;
+                }
+            }
+            btn_lut[byte][value] = sdl_buttons;
+        }
     }
+}
 
-    return pad_ctx[device_index].instance_id;
+// The scePad buttons as a word of SDL buttons, bit i for button i
+static Uint32 PS5_PadButtons(uint32_t buttons)
+{
+    return btn_lut[0][buttons & 0xFF] |
+           btn_lut[1][(buttons >> 8) & 0xFF] |
+           btn_lut[2][(buttons >> 16) & 0xFF];
 }
 
-static const char *PS5_JoystickGetDeviceName(int device_index)
+static SDL_JoystickID PS5_JoystickGetDeviceInstanceID(int device_index)
 {
-    if (device_index < 0 || device_index >= SDL_arraysize(pad_ctx)) {
-        return NULL;
-    }
+    PS5_PadContext *ctx = PS5_GetPadByDeviceIndex(device_index);
 
-    if (pad_ctx[device_index].name) {
-        return pad_ctx[device_index].name;
-    } else {
-        return "";
-    }
+    return ctx ? ctx->instance_id : -1;
+}
+
+static const char *PS5_JoystickGetDeviceName(int device_index)
+{
+    return PS5_GetPadByDeviceIndex(device_index) ? pad_name : NULL;
 }
 
 static SDL_bool PS5_JoystickGetGamepadMapping(int device_index, SDL_GamepadMapping *out)
@@ -171,108 +298,320 @@ static SDL_bool PS5_JoystickGetGamepadMapping(int device_index, SDL_GamepadMappi
     return SDL_TRUE;
 }
 
-static void PS5_JoystickUpdate(SDL_Joystick *joystick)
+// Send the events for the changes from the last state sent to 'pad'
+static void PS5_PadApply(SDL_Joystick *joystick, PS5_PadContext *ctx,
+                         const PS5_PadData *pad)
 {
-    SDL_JoystickID instance_id = SDL_JoystickInstanceID(joystick);
-    PS5_PadContext *ctx = NULL;
-    uint32_t btn_change;
-    PS5_PadData pad;
-    uint8_t hat = 0;
+    // Axes
+    if (ctx->pad.leftStick.x != pad->leftStick.x) {
+        SDL_PrivateJoystickAxis(joystick, PS5_PAD_AXIS_LX,
+                                analog_map[pad->leftStick.x]);
+    }
+    if (ctx->pad.leftStick.y != pad->leftStick.y) {
+        SDL_PrivateJoystickAxis(joystick, PS5_PAD_AXIS_LY,
+                                analog_map[pad->leftStick.y]);
+    }
+    if (ctx->pad.rightStick.x != pad->rightStick.x) {
+        SDL_PrivateJoystickAxis(joystick, PS5_PAD_AXIS_RX,
+                                analog_map[pad->rightStick.x]);
+    }
+    if (ctx->pad.rightStick.y != pad->rightStick.y) {
+        SDL_PrivateJoystickAxis(joystick, PS5_PAD_AXIS_RY,
+                                analog_map[pad->rightStick.y]);
+    }
+    if (ctx->pad.analogButtons.l2 != pad->analogButtons.l2) {
+        SDL_PrivateJoystickAxis(joystick, PS5_PAD_AXIS_L2,
+                                analog_map[pad->analogButtons.l2]);
+    }
+    if (ctx->pad.analogButtons.r2 != pad->analogButtons.r2) {
+        SDL_PrivateJoystickAxis(joystick, PS5_PAD_AXIS_R2,
+                                analog_map[pad->analogButtons.r2]);
+    }
 
-    for (int i = 0; i < SDL_arraysize(pad_ctx); i++) {
-        if (instance_id == pad_ctx[i].instance_id) {
-            ctx = &pad_ctx[i];
-            break;
+    // Buttons, only visiting the ones that changed
+    if (ctx->pad.buttons != pad->buttons) {
+        const Uint32 sdl_buttons = PS5_PadButtons(pad->buttons);
+        Uint32 changed = PS5_PadButtons(ctx->pad.buttons) ^ sdl_buttons;
+
+        while (changed) {
+            const int i = SDL_MostSignificantBitIndex32(changed);
+
+            SDL_PrivateJoystickButton(joystick, (Uint8)i, (sdl_buttons >> i) & 1);
+            changed &= ~(1u << i);
         }
-    }
 
-    if (!ctx || instance_id < 0) {
-        SDL_SetError("PS5_JoystickUpdate: instance not connected");
-        return;
+        // The hat is the whole d-pad, not just the part that changed
+        if (PS5_PadHat(ctx->pad.buttons) != PS5_PadHat(pad->buttons)) {
+            SDL_PrivateJoystickHat(joystick, 0, PS5_PadHat(pad->buttons));
+        }
     }
 
-    switch (scePadReadState(ctx->handle, &pad)) {
-    case 0:
-        break;
+    // Touchpad, one finger per slot of the touch data
+    for (int i = 0; i < SDL_arraysize(pad->touch.touch); i++) {
+        const SDL_bool down = i < pad->touch.fingers;
+        const SDL_bool was_down = i < ctx->pad.touch.fingers;
+        const PS5_PadTouch *touch = &pad->touch.touch[i];
+
+        if (down != was_down ||
+            (down && (touch->x != ctx->pad.touch.touch[i].x ||
+                      touch->y != ctx->pad.touch.touch[i].y))) {
+            SDL_PrivateJoystickTouchpad(joystick, 0, i, down ? SDL_PRESSED : SDL_RELEASED,
+                                        down ? (float)touch->x / PS5_PAD_TOUCHPAD_WIDTH : 0.0f,
+                                        down ? (float)touch->y / PS5_PAD_TOUCHPAD_HEIGHT : 0.0f,
+                                        down ? 1.0f : 0.0f);
+        }
+    }
 
-        // TODO: on disconnect
+    // Sensors, in SDL's units, and only when they moved so that a pad
+    // lying still doesn't send an event per update
+    if (SDL_AtomicGet(&ctx->sensors_enabled)) {
+        float data[3];
 
-    default:
-        SDL_SetError("scePadReadState: %s", strerror(errno));
-        return;
+        if (memcmp(&ctx->pad.vel, &pad->vel, sizeof(pad->vel)) != 0) {
+            data[0] = pad->vel.x;
+            data[1] = pad->vel.y;
+            data[2] = pad->vel.z;
+            SDL_PrivateJoystickSensor(joystick, SDL_SENSOR_GYRO, pad->timestamp, data, 3);
+        }
+        if (memcmp(&ctx->pad.acell, &pad->acell, sizeof(pad->acell)) != 0) {
+            data[0] = pad->acell.x * SDL_STANDARD_GRAVITY;
+            data[1] = pad->acell.y * SDL_STANDARD_GRAVITY;
+            data[2] = pad->acell.z * SDL_STANDARD_GRAVITY;
+            SDL_PrivateJoystickSensor(joystick, SDL_SENSOR_ACCEL, pad->timestamp, data, 3);
+        }
     }
 
-    // Axes
-    if (ctx->pad.leftStick.x != pad.leftStick.x) {
-        SDL_PrivateJoystickAxis(joystick, PS5_PAD_AXIS_LX,
-                                analog_map[pad.leftStick.x]);
+    memcpy(&ctx->pad, pad, sizeof(*pad));
+}
+
+static SDL_bool PS5_PadChanged(const PS5_PadData *a, const PS5_PadData *b, SDL_bool sensors)
+{
+    if (a->connected != b->connected || a->buttons != b->buttons ||
+        a->leftStick.x != b->leftStick.x || a->leftStick.y != b->leftStick.y ||
+        a->rightStick.x != b->rightStick.x || a->rightStick.y != b->rightStick.y ||
+        a->analogButtons.l2 != b->analogButtons.l2 ||
+        a->analogButtons.r2 != b->analogButtons.r2) {
+        return SDL_TRUE;
     }
-    if (ctx->pad.leftStick.y != pad.leftStick.y) {
-        SDL_PrivateJoystickAxis(joystick, PS5_PAD_AXIS_LY,
-                                analog_map[pad.leftStick.y]);
+    if (a->touch.fingers != b->touch.fingers ||
+        memcmp(a->touch.touch, b->touch.touch,
+               SDL_min(b->touch.fingers, SDL_arraysize(b->touch.touch)) * sizeof(b->touch.touch[0])) != 0) {
+        return SDL_TRUE;
     }
-    if (ctx->pad.rightStick.x != pad.rightStick.x) {
-        SDL_PrivateJoystickAxis(joystick, PS5_PAD_AXIS_RX,
-                                analog_map[pad.rightStick.x]);
+    if (sensors && (memcmp(&a->vel, &b->vel, sizeof(b->vel)) != 0 ||
+                    memcmp(&a->acell, &b->acell, sizeof(b->acell)) != 0)) {
+        return SDL_TRUE;
     }
-    if (ctx->pad.rightStick.y != pad.rightStick.y) {
-        SDL_PrivateJoystickAxis(joystick, PS5_PAD_AXIS_RY,
-                                analog_map[pad.rightStick.y]);
+    return SDL_FALSE;
+}
+
+// Read a pad on the input thread, and queue its state if it changed
+static void PS5_PadSampleState(PS5_PadContext *ctx)
+{
+    PS5_PadSample *sample;
+    PS5_PadData pad;
+    Uint32 head;
+
+    if (scePadReadState(ctx->handle, &pad) != 0) {
+        SDL_zero(pad); // PS5_JoystickUpdate takes it as a disconnect
     }
-    if (ctx->pad.analogButtons.l2 != pad.analogButtons.l2) {
-        SDL_PrivateJoystickAxis(joystick, PS5_PAD_AXIS_L2,
-                                analog_map[pad.analogButtons.l2]);
+    if (!PS5_PadChanged(&ctx->sampled, &pad, SDL_AtomicGet(&ctx->sensors_enabled))) {
+        return;
     }
-    if (ctx->pad.analogButtons.r2 != pad.analogButtons.r2) {
-        SDL_PrivateJoystickAxis(joystick, PS5_PAD_AXIS_R2,
-                                analog_map[pad.analogButtons.r2]);
+
+    head = (Uint32)SDL_AtomicGet(&ctx->ring_head);
+    if (head - (Uint32)SDL_AtomicGet(&ctx->ring_tail) >= PS5_PAD_RING_SIZE) {
+        // Tried again on the next read, so the latest state isn't lost
+        SDL_AtomicIncRef(&ctx->overflows);
+        return;
     }
 
-    // Buttons
-    btn_change = ctx->pad.buttons ^ pad.buttons;
-    if (btn_change) {
-        for (int i = 0; i < SDL_arraysize(btn_map); i++) {
-            if (btn_map[i] == -1) {
-                continue;
+    sample = &ctx->ring[head % PS5_PAD_RING_SIZE];
+    sample->ticks = SDL_GetPerformanceCounter();
+    sample->pad = pad;
+    SDL_AtomicSet(&ctx->ring_head, (int)(head + 1));
+    ctx->sampled = pad;
+}
+
+static int SDLCALL PS5_PadThread(void *data)
+{
+    SDL_SetThreadPriority(SDL_THREAD_PRIORITY_HIGH);
+
+    while (!SDL_AtomicGet(&pad_thread_quit)) {
+        SDL_LockMutex(pad_lock);
+        for (int i = 0; i < SDL_arraysize(pad_ctx); i++) {
+            if (pad_ctx[i].opened && pad_ctx[i].present) {
+                PS5_PadSampleState(&pad_ctx[i]);
             }
-            if (btn_change & btn_map[i]) {
-                if (pad.buttons & btn_map[i]) {
-                    SDL_PrivateJoystickButton(joystick, i, SDL_PRESSED);
-                } else {
-                    SDL_PrivateJoystickButton(joystick, i, SDL_RELEASED);
-                }
+        }
+        SDL_UnlockMutex(pad_lock);
 
-                // handle hat
-                if (i == 11 && (pad.buttons & btn_map[i])) {
-                    hat |= SDL_HAT_UP;
-                } else if (i == 12 && (pad.buttons & btn_map[i])) {
-                    hat |= SDL_HAT_DOWN;
-                } else if (i == 13 && (pad.buttons & btn_map[i])) {
-                    hat |= SDL_HAT_LEFT;
-                } else if (i == 14 && (pad.buttons & btn_map[i])) {
-                    hat |= SDL_HAT_RIGHT;
-                }
+        SDL_Delay(PS5_PAD_SAMPLE_INTERVAL);
+    }
+
+    return 0;
+}
+
+// Announce a pad as a new SDL device, or that it is gone
+static void PS5_PadSetPresent(PS5_PadContext *ctx, SDL_bool present)
+{
+    if (present && !ctx->present) {
+        ctx->instance_id = SDL_GetNextJoystickInstanceID();
+        ctx->present = SDL_TRUE;
+        SDL_PrivateJoystickAdded(ctx->instance_id);
+    } else if (!present && ctx->present) {
+        ctx->present = SDL_FALSE;
+        SDL_PrivateJoystickRemoved(ctx->instance_id);
+    }
+}
+
+static void PS5_PadUpdate(SDL_Joystick *joystick, PS5_PadContext *ctx)
+{
+    PS5_PadData pad;
+
+    // Every change the input thread saw, in order, so that presses
+    // shorter than a frame still get both of their events
+    if (pad_thread) {
+        Uint32 tail = (Uint32)SDL_AtomicGet(&ctx->ring_tail);
+        const Uint32 head = (Uint32)SDL_AtomicGet(&ctx->ring_head);
+
+        for (; tail != head; tail++) {
+            const PS5_PadData *sample = &ctx->ring[tail % PS5_PAD_RING_SIZE].pad;
+
+            if (!sample->connected) {
+                PS5_PadSetPresent(ctx, SDL_FALSE);
+                tail = head;
+                break;
             }
+            PS5_PadApply(joystick, ctx, sample);
         }
-        // send hat events now
-        SDL_PrivateJoystickHat(joystick, 0, hat);
+        SDL_AtomicSet(&ctx->ring_tail, (int)tail);
+        return;
+    }
+
+    if (scePadReadState(ctx->handle, &pad) != 0 || !pad.connected) {
+        // Back as a new device once it reconnects, see PS5_JoystickDetect()
+        PS5_PadSetPresent(ctx, SDL_FALSE);
+        return;
+    }
+
+    PS5_PadApply(joystick, ctx, &pad);
+}
+
+// Send the output set since the last update, one call per kind of output
+static void PS5_PadSendOutput(PS5_PadContext *ctx)
+{
+    int err;
+
+    if (ctx->output & PS5_PAD_OUTPUT_VIBRATION) {
+        err = scePadSetVibration(ctx->handle, &ctx->vibration);
+        if (err != 0) {
+            SDL_SetError("scePadSetVibration: 0x%08x", err);
+        }
+    }
+    if (ctx->output & PS5_PAD_OUTPUT_LIGHTBAR) {
+        err = scePadSetLightBar(ctx->handle, &ctx->lightbar);
+        if (err != 0) {
+            SDL_SetError("scePadSetLightBar: 0x%08x", err);
+        }
+    }
+    if (ctx->output & PS5_PAD_OUTPUT_TRIGGERS) {
+        err = scePadSetTriggerEffect(ctx->handle, &ctx->triggers);
+        if (err != 0) {
+            SDL_SetError("scePadSetTriggerEffect: 0x%08x", err);
+        }
+        ctx->triggers.triggerMask = 0;
+    }
+    ctx->output = 0;
+}
+
+static void PS5_JoystickUpdate(SDL_Joystick *joystick)
+{
+    PS5_PadContext *ctx = PS5_GetPadContext(joystick);
+
+    if (!ctx) {
+        SDL_SetError("PS5_JoystickUpdate: instance not connected");
+        return;
     }
 
-    memcpy(&ctx->pad, &pad, sizeof(pad));
+    PS5_PadUpdate(joystick, ctx);
+    if (ctx->output) {
+        PS5_PadSendOutput(ctx);
+    }
 }
 
 static SDL_JoystickGUID PS5_JoystickGetDeviceGUID(int device_index)
 {
+    PS5_PadContext *ctx = PS5_GetPadByDeviceIndex(device_index);
     SDL_JoystickGUID guid = { 0 };
 
-    if (device_index < 0 || device_index >= SDL_arraysize(pad_ctx)) {
-        return guid;
+    return ctx ? ctx->global_id : guid;
+}
+
+// A pad is only a device while it is connected. Pads that are open are
+// checked as they are read.
+static void PS5_PadCheckConnected(PS5_PadContext *ctx)
+{
+    PS5_PadData pad;
+    int err;
+
+    SDL_LockMutex(pad_lock);
+    err = scePadReadState(ctx->handle, &pad);
+    SDL_UnlockMutex(pad_lock);
+
+    PS5_PadSetPresent(ctx, err == 0 && pad.connected);
+}
+
+static void PS5_PadAddUser(int user_id)
+{
+    PS5_PadContext *ctx = NULL;
+    int handle;
+
+    for (int i = 0; i < SDL_arraysize(pad_ctx); i++) {
+        if (pad_ctx[i].user_id == user_id) {
+            return;
+        }
+        if (!ctx && pad_ctx[i].user_id == -1) {
+            ctx = &pad_ctx[i];
+        }
     }
+    if (!ctx) {
+        return;
+    }
+
+    handle = scePadOpen(user_id, 0, 0, NULL);
+    if (handle < 0) {
+        SDL_SetError("scePadOpen: 0x%08x", handle);
+        return;
+    }
+
+    SDL_LockMutex(pad_lock);
+    ctx->user_id = user_id;
+    ctx->handle = handle;
+    SDL_UnlockMutex(pad_lock);
+    ctx->global_id = SDL_CreateJoystickGUIDForName(pad_name);
 
-    return pad_ctx[device_index].global_id;
+    PS5_PadCheckConnected(ctx);
 }
 
-static void PS5_JoystickDetect(void)
+static void PS5_PadRemoveUser(PS5_PadContext *ctx)
+{
+    int err;
+
+    PS5_PadSetPresent(ctx, SDL_FALSE);
+
+    SDL_LockMutex(pad_lock);
+    err = scePadClose(ctx->handle);
+    ctx->handle = -1;
+    ctx->user_id = -1;
+    ctx->opened = SDL_FALSE;
+    SDL_UnlockMutex(pad_lock);
+    if (err != 0) {
+        SDL_SetError("scePadClose: 0x%08x", err);
+    }
+}
+
+static void PS5_PadRefreshUsers(void)
 {
     int user_ids[PS5_MAX_USERS];
 
@@ -281,9 +620,58 @@ static void PS5_JoystickDetect(void)
         return;
     }
 
+    for (int i = 0; i < SDL_arraysize(pad_ctx); i++) {
+        SDL_bool logged_in = SDL_FALSE;
+
+        if (pad_ctx[i].user_id == -1) {
+            continue;
+        }
+        for (int j = 0; j < PS5_MAX_USERS; j++) {
+            logged_in |= (user_ids[j] == pad_ctx[i].user_id);
+        }
+        if (!logged_in) {
+            PS5_PadRemoveUser(&pad_ctx[i]);
+        }
+    }
+
     for (int i = 0; i < PS5_MAX_USERS; i++) {
-        if (user_ids[i] != -1 && pad_ctx[i].user_id == -1) {
-            pad_ctx[i].user_id = user_ids[i];
+        if (user_ids[i] != -1) {
+            PS5_PadAddUser(user_ids[i]);
+        }
+    }
+}
+
+static void PS5_JoystickDetect(void)
+{
+    PS5_UserServiceEvent event;
+    Uint64 now;
+
+    // Logins and logouts, as they happen
+    while (sceUserServiceGetEvent(&event) == 0) {
+        if (event.eventType == PS5_USER_SERVICE_EVENT_TYPE_LOGIN) {
+            PS5_PadAddUser(event.userId);
+        } else if (event.eventType == PS5_USER_SERVICE_EVENT_TYPE_LOGOUT) {
+            for (int i = 0; i < SDL_arraysize(pad_ctx); i++) {
+                if (pad_ctx[i].user_id == event.userId) {
+                    PS5_PadRemoveUser(&pad_ctx[i]);
+                }
+            }
+        }
+    }
+
+    // Detect runs once per SDL_JoystickUpdate(), the login list is only
+    // queried now and then, in case an event was missed, and so are pads
+    // that nothing reads to notice them come and go
+    now = SDL_GetTicks64();
+    if (now < pad_next_poll) {
+        return;
+    }
+    pad_next_poll = now + PS5_PAD_POLL_INTERVAL;
+
+    PS5_PadRefreshUsers();
+    for (int i = 0; i < SDL_arraysize(pad_ctx); i++) {
+        if (pad_ctx[i].handle >= 0 && (!pad_ctx[i].opened || !pad_ctx[i].present)) {
+            PS5_PadCheckConnected(&pad_ctx[i]);
         }
     }
 }
@@ -293,7 +681,7 @@ static int PS5_JoystickGetCount(void)
     int n = 0;
 
     for (int i = 0; i < SDL_arraysize(pad_ctx); i++) {
-        n += (pad_ctx[i].user_id != -1);
+        n += pad_ctx[i].present;
     }
 
     return n;
@@ -301,62 +689,65 @@ static int PS5_JoystickGetCount(void)
 
 static int PS5_JoystickOpen(SDL_Joystick *joystick, int device_index)
 {
-    const char name[] = "Sony DualSense";
+    PS5_PadContext *ctx = PS5_GetPadByDeviceIndex(device_index);
 
-    if (device_index < 0 || device_index >= SDL_arraysize(pad_ctx)) {
+    if (!ctx) {
         return SDL_SetError("PS5_JoystickOpen: Invalid device index");
     }
 
-    pad_ctx[device_index].handle = scePadOpen(pad_ctx[device_index].user_id,
-                                              0, 0, NULL);
-    if (pad_ctx[device_index].handle < 0) {
-        return SDL_SetError("scePadOpen: %s", strerror(errno));
-    }
-
-    if (pad_ctx[device_index].name) {
-        free(pad_ctx[device_index].name);
-    }
-
-    pad_ctx[device_index].instance_id++;
-    pad_ctx[device_index].global_id = SDL_CreateJoystickGUIDForName(name);
-    pad_ctx[device_index].name = strdup(name);
+    SDL_LockMutex(pad_lock);
+    ctx->opened = SDL_TRUE;
+    // A new joystick starts from nothing pressed, and the input thread
+    // from there
+    SDL_zero(ctx->pad);
+    ctx->sampled = ctx->pad;
+    SDL_AtomicSet(&ctx->ring_head, 0);
+    SDL_AtomicSet(&ctx->ring_tail, 0);
+    SDL_AtomicSet(&ctx->sensors_enabled, 0);
+    SDL_UnlockMutex(pad_lock);
 
     joystick->nbuttons = SDL_arraysize(btn_map);
     joystick->naxes = 6;
     joystick->nhats = 1;
-    joystick->instance_id = pad_ctx[device_index].instance_id;
+    joystick->instance_id = ctx->instance_id;
+    joystick->hwdata = ctx;
+
+    SDL_PrivateJoystickAddTouchpad(joystick, SDL_arraysize(ctx->pad.touch.touch));
+    SDL_PrivateJoystickAddSensor(joystick, SDL_SENSOR_GYRO, PS5_PAD_SENSOR_RATE);
+    SDL_PrivateJoystickAddSensor(joystick, SDL_SENSOR_ACCEL, PS5_PAD_SENSOR_RATE);
 
     return 0;
 }
 
+// The pad stays open until its user logs out
 static void PS5_JoystickClose(SDL_Joystick *joystick)
 {
-    SDL_JoystickID instance_id = SDL_JoystickInstanceID(joystick);
-    PS5_PadContext *ctx = NULL;
-    int err;
+    PS5_PadContext *ctx = PS5_GetPadContext(joystick);
 
-    for (int i = 0; i < SDL_arraysize(pad_ctx); i++) {
-        if (instance_id == pad_ctx[i].instance_id) {
-            ctx = &pad_ctx[i];
-            break;
-        }
-    }
-
-    if (!ctx || instance_id < 0) {
+    joystick->hwdata = NULL;
+    if (!ctx) {
         return;
     }
 
-    err = scePadClose(ctx->handle);
-    if (err != 0) {
-        SDL_SetError("scePadClose: 0x%08x", err);
-    }
+    SDL_LockMutex(pad_lock);
+    ctx->opened = SDL_FALSE;
+    SDL_UnlockMutex(pad_lock);
 
-    if (ctx->name) {
-        free(ctx->name);
+    // SDL_JoystickClose() stops the rumble and trigger effects just before,
+    // there won't be another update to send that
+    if (ctx->output) {
+        PS5_PadSendOutput(ctx);
     }
+}
 
+static void PS5_PadReset(PS5_PadContext *ctx)
+{
+    ctx->user_id = -1;
     ctx->handle = -1;
-    ctx->name = 0;
+    ctx->present = SDL_FALSE;
+    ctx->opened = SDL_FALSE;
+    ctx->instance_id = -1;
+    ctx->global_id = (SDL_JoystickGUID){0};
 }
 
 static int PS5_JoystickInit(void)
@@ -364,12 +755,9 @@ static int PS5_JoystickInit(void)
     int err;
 
     for (int i = 0; i < SDL_arraysize(pad_ctx); i++) {
-        pad_ctx[i].user_id = -1;
-        pad_ctx[i].handle = -1;
-        pad_ctx[i].name = 0;
-        pad_ctx[i].instance_id = -1;
-        pad_ctx[i].global_id = (SDL_JoystickGUID){0};
+        PS5_PadReset(&pad_ctx[i]);
     }
+    PS5_PadInitButtons();
 
     err = sceUserServiceInitialize(0);
     if (err != 0 && err != 0x80960003) {
@@ -381,14 +769,43 @@ static int PS5_JoystickInit(void)
         return SDL_SetError("scePadInit: 0x%08x", err);
     }
 
-    PS5_JoystickDetect();
+    if (SDL_GetHintBoolean(SDL_HINT_PS5_JOYSTICK_THREAD, SDL_FALSE) && !pad_thread) {
+        pad_lock = SDL_CreateMutex();
+        if (!pad_lock) {
+            return -1;
+        }
+        SDL_AtomicSet(&pad_thread_quit, 0);
+        pad_thread = SDL_CreateThreadInternal(PS5_PadThread, "SDLPadPS5", 0, NULL);
+        if (!pad_thread) {
+            SDL_DestroyMutex(pad_lock);
+            pad_lock = NULL;
+            return -1;
+        }
+    }
+
+    // Pads plugged in later show up through PS5_JoystickDetect()
+    PS5_PadRefreshUsers();
+    pad_next_poll = SDL_GetTicks64() + PS5_PAD_POLL_INTERVAL;
 
-    return PS5_JoystickGetCount() > 0 ? 0 : -1;
+    return 0;
 }
 
 static void PS5_JoystickQuit(void)
 {
-    // NOP
+    if (pad_thread) {
+        SDL_AtomicSet(&pad_thread_quit, 1);
+        SDL_WaitThread(pad_thread, NULL);
+        pad_thread = NULL;
+        SDL_DestroyMutex(pad_lock);
+        pad_lock = NULL;
+    }
+
+    for (int i = 0; i < SDL_arraysize(pad_ctx); i++) {
+        if (pad_ctx[i].handle >= 0) {
+            scePadClose(pad_ctx[i].handle);
+        }
+        PS5_PadReset(&pad_ctx[i]);
+    }
 }
 
 //
@@ -399,37 +816,127 @@ static void PS5_JoystickQuit(void)
 
 static Uint32 PS5_JoystickGetCapabilities(SDL_Joystick *joystick)
 {
-    return 0;
+    return SDL_JOYCAP_LED | SDL_JOYCAP_RUMBLE | SDL_JOYCAP_RUMBLE_TRIGGERS;
 }
 
+// The output functions below only record what was asked for, it is sent
+// on the next update
+
 static int PS5_JoystickRumble(SDL_Joystick *joystick, Uint16 low_frequency_rumble,
                               Uint16 high_frequency_rumble)
 {
-    return SDL_Unsupported();
+    PS5_PadContext *ctx = PS5_GetPadContext(joystick);
+
+    if (!ctx) {
+        return SDL_SetError("PS5_JoystickRumble: instance not connected");
+    }
+
+    ctx->vibration.largeMotor = low_frequency_rumble >> 8;
+    ctx->vibration.smallMotor = high_frequency_rumble >> 8;
+    ctx->output |= PS5_PAD_OUTPUT_VIBRATION;
+
+    return 0;
+}
+
+// Merge the commands of the triggers in 'param' into those waiting
+static void PS5_PadSetTriggerEffect(PS5_PadContext *ctx, const PS5_PadTriggerEffectParam *param)
+{
+    for (int i = 0; i < SDL_arraysize(param->command); i++) {
+        if (param->triggerMask & (1 << i)) {
+            ctx->triggers.command[i] = param->command[i];
+        }
+    }
+    ctx->triggers.triggerMask |= param->triggerMask & (PS5_PAD_TRIGGER_EFFECT_TRIGGER_MASK_L2 |
+                                                       PS5_PAD_TRIGGER_EFFECT_TRIGGER_MASK_R2);
+    ctx->output |= PS5_PAD_OUTPUT_TRIGGERS;
 }
 
 static int PS5_JoystickRumbleTriggers(SDL_Joystick *joystick, Uint16 left,
                                       Uint16 right)
 {
-    return SDL_Unsupported();
+    PS5_PadContext *ctx = PS5_GetPadContext(joystick);
+    PS5_PadTriggerEffectParam param;
+    const Uint16 strength[2] = { left, right };
+
+    if (!ctx) {
+        return SDL_SetError("PS5_JoystickRumbleTriggers: instance not connected");
+    }
+
+    // Vibration along the whole travel, no weaker than the smallest
+    // amplitude the trigger has so that weak rumble isn't lost
+    SDL_zero(param);
+    param.triggerMask = PS5_PAD_TRIGGER_EFFECT_TRIGGER_MASK_L2 | PS5_PAD_TRIGGER_EFFECT_TRIGGER_MASK_R2;
+    for (int i = 0; i < SDL_arraysize(strength); i++) {
+        PS5_PadTriggerEffectCommand *command = &param.command[i];
+
+        if (strength[i] == 0) {
+            command->mode = PS5_PAD_TRIGGER_EFFECT_MODE_OFF;
+            continue;
+        }
+        command->mode = PS5_PAD_TRIGGER_EFFECT_MODE_VIBRATION;
+        command->commandData.vibration.position = 0;
+        command->commandData.vibration.amplitude = (Uint8)SDL_max((strength[i] * 8 + 0x7FFF) / 0xFFFF, 1);
+        command->commandData.vibration.frequency = PS5_PAD_TRIGGER_RUMBLE_FREQUENCY;
+    }
+    PS5_PadSetTriggerEffect(ctx, &param);
+
+    return 0;
 }
 
 static int PS5_JoystickSetLED(SDL_Joystick *joystick, Uint8 red, Uint8 green,
                               Uint8 blue)
 {
-    return SDL_Unsupported();
+    PS5_PadContext *ctx = PS5_GetPadContext(joystick);
+
+    if (!ctx) {
+        return SDL_SetError("PS5_JoystickSetLED: instance not connected");
+    }
+
+    ctx->lightbar.r = red;
+    ctx->lightbar.g = green;
+    ctx->lightbar.b = blue;
+    ctx->output |= PS5_PAD_OUTPUT_LIGHTBAR;
+
+    return 0;
 }
 
+// Takes the ScePadTriggerEffectParam of scePadSetTriggerEffect, for the
+// adaptive trigger effects SDL has no API for
 static int
 PS5_JoystickSendEffect(SDL_Joystick *joystick, const void *data, int size)
 {
-    return SDL_Unsupported();
+    PS5_PadContext *ctx = PS5_GetPadContext(joystick);
+
+    if (!ctx) {
+        return SDL_SetError("PS5_JoystickSendEffect: instance not connected");
+    }
+    if (size != sizeof(PS5_PadTriggerEffectParam)) {
+        return SDL_SetError("PS5_JoystickSendEffect: expected a ScePadTriggerEffectParam of %d bytes",
+                            (int)sizeof(PS5_PadTriggerEffectParam));
+    }
+
+    PS5_PadSetTriggerEffect(ctx, (const PS5_PadTriggerEffectParam *)data);
+
+    return 0;
 }
 
 static int
 PS5_JoystickSetSensorsEnabled(SDL_Joystick *joystick, SDL_bool enabled)
 {
-    return SDL_Unsupported();
+    PS5_PadContext *ctx = PS5_GetPadContext(joystick);
+    int err;
+
+    if (!ctx) {
+        return SDL_SetError("PS5_JoystickSetSensorsEnabled: instance not connected");
+    }
+
+    err = scePadSetMotionSensorState(ctx->handle, enabled ? 1 : 0);
+    if (err != 0) {
+        return SDL_SetError("scePadSetMotionSensorState: 0x%08x", err);
+    }
+    SDL_AtomicSet(&ctx->sensors_enabled, enabled ? 1 : 0);
+
+    return 0;
 }
 
 static const char *PS5_JoystickGetDevicePath(int index)
@@ -475,6 +982,6 @@ SDL_JoystickDriver SDL_PS5_JoystickDriver = {
     PS5_JoystickGetGamepadMapping
 };
 
-#endif /* SDL_JOYSTICK_PS5 */
+#endif /* SDL_JOYSTICK_PS5 || SDL_PS5_HOST_TEST */
 
 /* vi: set ts=4 sw=4 expandtab: */
@@ -81,10 +81,70 @@ typedef struct PS5_PadData
     uint8_t unknown[15];
 } PS5_PadData;
 
+typedef struct PS5_PadVibrationParam
+{
+    uint8_t largeMotor;
+    uint8_t smallMotor;
+} PS5_PadVibrationParam;
+
+typedef struct PS5_PadLightBarParam
+{
+    uint8_t r;
+    uint8_t g;
+    uint8_t b;
+    uint8_t pad;
+} PS5_PadLightBarParam;
+
+#define PS5_PAD_TRIGGER_EFFECT_TRIGGER_MASK_L2 0x01
+#define PS5_PAD_TRIGGER_EFFECT_TRIGGER_MASK_R2 0x02
+
+#define PS5_PAD_TRIGGER_EFFECT_MODE_OFF       0
+#define PS5_PAD_TRIGGER_EFFECT_MODE_FEEDBACK  1
+#define PS5_PAD_TRIGGER_EFFECT_MODE_WEAPON    2
+#define PS5_PAD_TRIGGER_EFFECT_MODE_VIBRATION 3
+
+typedef struct PS5_PadTriggerEffectCommand
+{
+    uint32_t mode;
+    uint8_t padding[4];
+    union
+    {
+        struct
+        {
+            uint8_t position;  // 0 to 9, where along the travel it starts
+            uint8_t amplitude; // 0 to 8
+            uint8_t frequency; // in Hz
+        } vibration;
+        uint8_t data[48];
+    } commandData;
+} PS5_PadTriggerEffectCommand;
+
+// One command for each trigger, L2 first. Only those in triggerMask apply.
+typedef struct PS5_PadTriggerEffectParam
+{
+    uint8_t triggerMask;
+    uint8_t padding[7];
+    PS5_PadTriggerEffectCommand command[2];
+} PS5_PadTriggerEffectParam;
+
 int scePadInit(void);
 int scePadOpen(int handle, int, int, void *);
 int scePadReadState(int handle, PS5_PadData *data);
+int scePadSetMotionSensorState(int handle, uint8_t enable);
+int scePadSetVibration(int handle, const PS5_PadVibrationParam *param);
+int scePadSetLightBar(int handle, const PS5_PadLightBarParam *param);
+int scePadSetTriggerEffect(int handle, const PS5_PadTriggerEffectParam *param);
 int scePadClose(int handle);
 
+#define PS5_USER_SERVICE_EVENT_TYPE_LOGIN  0
+#define PS5_USER_SERVICE_EVENT_TYPE_LOGOUT 1
+
+typedef struct PS5_UserServiceEvent
+{
+    int32_t eventType;
+    int32_t userId;
+} PS5_UserServiceEvent;
+
 int sceUserServiceInitialize(void *);
 int sceUserServiceGetLoginUserIdList(int userId[4]);
+int sceUserServiceGetEvent(PS5_UserServiceEvent *event);
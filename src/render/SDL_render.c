@@ -28,6 +28,7 @@
 #include "SDL_sysrender.h"
 #include "software/SDL_render_sw_c.h"
 #include "../video/SDL_pixels_c.h"
+#include "../SDL_trace_c.h"
 
 #if defined(__ANDROID__)
 #include "../core/android/SDL_android.h"
@@ -125,7 +126,12 @@ static const SDL_RenderDriver *render_drivers[] = {
     &VITA_GXM_RenderDriver,
 #endif
 #if SDL_VIDEO_RENDER_SW
-    &SW_RenderDriver
+    &SW_RenderDriver,
+#endif
+#if SDL_VIDEO_RENDER_PS5
+    /* After the software renderer until it can do as much, so it is only
+       used when asked for with SDL_HINT_RENDER_DRIVER */
+    &PS5_RenderDriver,
 #endif
 };
 #endif /* !SDL_RENDER_DISABLED */
@@ -246,7 +252,9 @@ static int FlushRenderCommands(SDL_Renderer *renderer)
 
     DebugLogRenderCommands(renderer->render_commands);
 
+    SDL_TRACE_BEGIN("FlushRenderCommands");
     retval = renderer->RunCommandQueue(renderer, renderer->render_commands, renderer->vertex_data, renderer->vertex_data_used);
+    SDL_TRACE_END("FlushRenderCommands");
 
     /* Move the whole render command queue to the unused pool so we can reuse them next time. */
     if (renderer->render_commands_tail) {
@@ -0,0 +1,525 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../../SDL_internal.h"
+
+#if SDL_VIDEO_RENDER_PS5 || defined(SDL_PS5_HOST_TEST)
+
+#include "../../video/ps5/SDL_ps5tiling.h"
+#include "SDL_ps5draw.h"
+
+/* Pixels blended at a time, rows are processed in pieces of this size */
+#define PS5_SPAN_SIZE 256
+
+#define PS5_ABGR(r, g, b, a) \
+    (((Uint32)(a) << 24) | ((Uint32)(b) << 16) | ((Uint32)(g) << 8) | (Uint32)(r))
+
+typedef struct
+{
+    const SDL_Rect *viewport;
+    const SDL_Rect *cliprect;
+    SDL_bool clip_dirty;
+    SDL_Rect clip; /* in target coordinates, from the two above */
+} PS5_DrawStateCache;
+
+int PS5_QueueDrawPoints(SDL_Renderer *renderer, SDL_RenderCommand *cmd,
+                        const SDL_FPoint *points, int count)
+{
+    SDL_Point *verts = (SDL_Point *)SDL_AllocateRenderVertices(renderer, count * sizeof(SDL_Point), 0, &cmd->data.draw.first);
+
+    if (!verts) {
+        return -1;
+    }
+
+    cmd->data.draw.count = count;
+
+    for (int i = 0; i < count; i++, verts++, points++) {
+        verts->x = (int)points->x;
+        verts->y = (int)points->y;
+    }
+
+    return 0;
+}
+
+int PS5_QueueFillRects(SDL_Renderer *renderer, SDL_RenderCommand *cmd,
+                       const SDL_FRect *rects, int count)
+{
+    SDL_Rect *verts = (SDL_Rect *)SDL_AllocateRenderVertices(renderer, count * sizeof(SDL_Rect), 0, &cmd->data.draw.first);
+
+    if (!verts) {
+        return -1;
+    }
+
+    cmd->data.draw.count = count;
+
+    for (int i = 0; i < count; i++, verts++, rects++) {
+        verts->x = (int)rects->x;
+        verts->y = (int)rects->y;
+        verts->w = SDL_max((int)rects->w, 1);
+        verts->h = SDL_max((int)rects->h, 1);
+    }
+
+    return 0;
+}
+
+int PS5_QueueCopy(SDL_Renderer *renderer, SDL_RenderCommand *cmd,
+                  SDL_Texture *texture, const SDL_Rect *srcrect,
+                  const SDL_FRect *dstrect)
+{
+    SDL_Rect *verts = (SDL_Rect *)SDL_AllocateRenderVertices(renderer, 2 * sizeof(SDL_Rect), 0, &cmd->data.draw.first);
+
+    if (!verts) {
+        return -1;
+    }
+
+    cmd->data.draw.count = 1;
+
+    SDL_copyp(verts, srcrect);
+    verts++;
+
+    verts->x = (int)dstrect->x;
+    verts->y = (int)dstrect->y;
+    verts->w = (int)dstrect->w;
+    verts->h = (int)dstrect->h;
+
+    return 0;
+}
+
+void PS5_ReadTargetSpan(const PS5_RenderTarget *target, int x, int y,
+                        Uint32 *pixels, int count)
+{
+    if (target->linear) {
+        SDL_memcpy(pixels, target->pixels + (size_t)y * target->width + x,
+                   count * sizeof(Uint32));
+    } else {
+        PS5_ReadTileSpan(target->pixels, target->width, x, y, pixels, count);
+    }
+}
+
+static void PS5_WriteTargetSpan(const PS5_RenderTarget *target, int x, int y,
+                                const Uint32 *pixels, int count)
+{
+    if (target->linear) {
+        SDL_memcpy(target->pixels + (size_t)y * target->width + x, pixels,
+                   count * sizeof(Uint32));
+    } else {
+        PS5_WriteTileSpan(target->pixels, target->width, x, y, pixels, count);
+    }
+}
+
+static void PS5_FillTargetRect(const PS5_RenderTarget *target,
+                               const SDL_Rect *rect, Uint32 color)
+{
+    if (target->linear) {
+        for (int y = rect->y; y < rect->y + rect->h; y++) {
+            Uint32 *row = target->pixels + (size_t)y * target->width;
+
+            for (int x = rect->x; x < rect->x + rect->w; x++) {
+                row[x] = color;
+            }
+        }
+    } else {
+        PS5_FillTileRect(target->pixels, target->width, rect, color);
+    }
+}
+
+/* Blend 'src' over 'dst' with the same arithmetic as the software
+   renderer, the source isn't premultiplied */
+static void PS5_BlendSpan(Uint32 *dst, const Uint32 *src, int n,
+                          SDL_BlendMode blend)
+{
+    for (int i = 0; i < n; i++) {
+        const Uint32 s = src[i], d = dst[i];
+        Uint32 sr = s & 0xFF, sg = (s >> 8) & 0xFF, sb = (s >> 16) & 0xFF;
+        const Uint32 sa = s >> 24, inva = 255 - sa;
+        Uint32 dr = d & 0xFF, dg = (d >> 8) & 0xFF, db = (d >> 16) & 0xFF;
+        Uint32 da = d >> 24;
+
+        switch (blend) {
+        case SDL_BLENDMODE_BLEND:
+            sr = (sr * sa) / 255;
+            sg = (sg * sa) / 255;
+            sb = (sb * sa) / 255;
+            dr = sr + (inva * dr) / 255;
+            dg = sg + (inva * dg) / 255;
+            db = sb + (inva * db) / 255;
+            da = sa + (inva * da) / 255;
+            break;
+        case SDL_BLENDMODE_ADD:
+            dr = SDL_min((sr * sa) / 255 + dr, 255);
+            dg = SDL_min((sg * sa) / 255 + dg, 255);
+            db = SDL_min((sb * sa) / 255 + db, 255);
+            break;
+        case SDL_BLENDMODE_MOD:
+            dr = (sr * dr) / 255;
+            dg = (sg * dg) / 255;
+            db = (sb * db) / 255;
+            break;
+        case SDL_BLENDMODE_MUL:
+            dr = SDL_min((sr * dr + dr * inva) / 255, 255);
+            dg = SDL_min((sg * dg + dg * inva) / 255, 255);
+            db = SDL_min((sb * db + db * inva) / 255, 255);
+            break;
+        default:
+            dr = sr;
+            dg = sg;
+            db = sb;
+            da = sa;
+            break;
+        }
+        dst[i] = PS5_ABGR(dr, dg, db, da);
+    }
+}
+
+static void PS5_ModulateSpan(Uint32 *pixels, int n, Uint32 r, Uint32 g,
+                             Uint32 b, Uint32 a)
+{
+    for (int i = 0; i < n; i++) {
+        const Uint32 p = pixels[i];
+
+        pixels[i] = PS5_ABGR(((p & 0xFF) * r) / 255, (((p >> 8) & 0xFF) * g) / 255,
+                             (((p >> 16) & 0xFF) * b) / 255, ((p >> 24) * a) / 255);
+    }
+}
+
+static void PS5_SetDrawState(const PS5_RenderTarget *target,
+                             PS5_DrawStateCache *drawstate)
+{
+    SDL_Rect bounds, clip;
+
+    if (!drawstate->clip_dirty) {
+        return;
+    }
+
+    bounds.x = bounds.y = 0;
+    bounds.w = target->width;
+    bounds.h = target->height;
+    if (!drawstate->viewport) {
+        clip = bounds;
+    } else if (drawstate->cliprect) {
+        clip.x = drawstate->cliprect->x + drawstate->viewport->x;
+        clip.y = drawstate->cliprect->y + drawstate->viewport->y;
+        clip.w = drawstate->cliprect->w;
+        clip.h = drawstate->cliprect->h;
+        SDL_IntersectRect(drawstate->viewport, &clip, &clip);
+    } else {
+        clip = *drawstate->viewport;
+    }
+    if (!SDL_IntersectRect(&bounds, &clip, &drawstate->clip)) {
+        SDL_zero(drawstate->clip);
+    }
+    drawstate->clip_dirty = SDL_FALSE;
+}
+
+static void PS5_DrawPixel(const PS5_RenderTarget *target, const SDL_Rect *clip,
+                          int x, int y, Uint32 color, SDL_BlendMode blend)
+{
+    Uint32 pixel = color;
+
+    if (x < clip->x || y < clip->y ||
+        x >= clip->x + clip->w || y >= clip->y + clip->h) {
+        return;
+    }
+    if (blend != SDL_BLENDMODE_NONE) {
+        PS5_ReadTargetSpan(target, x, y, &pixel, 1);
+        PS5_BlendSpan(&pixel, &color, 1, blend);
+    }
+    PS5_WriteTargetSpan(target, x, y, &pixel, 1);
+}
+
+/* Bresenham's algorithm, as in SDL_draw.h. Lines are clipped pixel by
+   pixel, so that their slope doesn't change. */
+static void PS5_DrawLine(const PS5_RenderTarget *target, const SDL_Rect *clip,
+                         int x1, int y1, int x2, int y2, Uint32 color,
+                         SDL_BlendMode blend, SDL_bool draw_end)
+{
+    const int deltax = SDL_abs(x2 - x1);
+    const int deltay = SDL_abs(y2 - y1);
+    int numpixels, d, dinc1, dinc2, xinc1, xinc2, yinc1, yinc2;
+    int x = x1, y = y1;
+
+    if (deltax >= deltay) {
+        numpixels = deltax + 1;
+        d = (2 * deltay) - deltax;
+        dinc1 = deltay * 2;
+        dinc2 = (deltay - deltax) * 2;
+        xinc1 = xinc2 = 1;
+        yinc1 = 0;
+        yinc2 = 1;
+    } else {
+        numpixels = deltay + 1;
+        d = (2 * deltax) - deltay;
+        dinc1 = deltax * 2;
+        dinc2 = (deltax - deltay) * 2;
+        xinc1 = 0;
+        xinc2 = 1;
+        yinc1 = yinc2 = 1;
+    }
+    if (x1 > x2) {
+        xinc1 = -xinc1;
+        xinc2 = -xinc2;
+    }
+    if (y1 > y2) {
+        yinc1 = -yinc1;
+        yinc2 = -yinc2;
+    }
+    if (!draw_end) {
+        --numpixels;
+    }
+
+    for (int i = 0; i < numpixels; i++) {
+        PS5_DrawPixel(target, clip, x, y, color, blend);
+        if (d < 0) {
+            d += dinc1;
+            x += xinc1;
+            y += yinc1;
+        } else {
+            d += dinc2;
+            x += xinc2;
+            y += yinc2;
+        }
+    }
+}
+
+static void PS5_FillRect(const PS5_RenderTarget *target, const SDL_Rect *clip,
+                         const SDL_Rect *rect, Uint32 color, SDL_BlendMode blend)
+{
+    Uint32 src[PS5_SPAN_SIZE], dst[PS5_SPAN_SIZE];
+    SDL_Rect r;
+
+    if (!SDL_IntersectRect(rect, clip, &r)) {
+        return;
+    }
+    if (blend == SDL_BLENDMODE_NONE) {
+        PS5_FillTargetRect(target, &r, color);
+        return;
+    }
+
+    for (int i = 0; i < SDL_min(r.w, PS5_SPAN_SIZE); i++) {
+        src[i] = color;
+    }
+    for (int y = r.y; y < r.y + r.h; y++) {
+        for (int x = r.x; x < r.x + r.w; x += PS5_SPAN_SIZE) {
+            const int n = SDL_min(r.x + r.w - x, PS5_SPAN_SIZE);
+
+            PS5_ReadTargetSpan(target, x, y, dst, n);
+            PS5_BlendSpan(dst, src, n, blend);
+            PS5_WriteTargetSpan(target, x, y, dst, n);
+        }
+    }
+}
+
+/* Fetch 'n' texels of row 'sy' as ABGR8888, stepping through the source
+   in 16.16 fixed point from 'posx' like the software stretcher does */
+static void PS5_FetchTexels(const SDL_Surface *surface, int sx, int sy,
+                            Uint64 posx, Uint64 incx, Uint32 *dst, int n)
+{
+    const Uint32 *row = (const Uint32 *)((const Uint8 *)surface->pixels +
+                                         (size_t)sy * surface->pitch) + sx;
+
+    if (incx == 0x10000) {
+        SDL_memcpy(dst, row + (posx >> 16), n * sizeof(Uint32));
+    } else {
+        for (int i = 0; i < n; i++, posx += incx) {
+            dst[i] = row[posx >> 16];
+        }
+    }
+
+    if (surface->format->format == SDL_PIXELFORMAT_ARGB8888) {
+        for (int i = 0; i < n; i++) {
+            const Uint32 p = dst[i];
+
+            dst[i] = (p & 0xFF00FF00) | ((p >> 16) & 0xFF) | ((p & 0xFF) << 16);
+        }
+    }
+}
+
+/* Nearest neighbor copy of 'srcrect' to 'dstrect', with color and alpha
+   modulation */
+static void PS5_Copy(const PS5_RenderTarget *target, const SDL_Rect *clip,
+                     const SDL_RenderCommand *cmd, const SDL_Rect *srcrect,
+                     const SDL_Rect *dstrect)
+{
+    const SDL_Surface *surface = (const SDL_Surface *)cmd->data.draw.texture->driverdata;
+    const Uint8 r = cmd->data.draw.r, g = cmd->data.draw.g;
+    const Uint8 b = cmd->data.draw.b, a = cmd->data.draw.a;
+    const SDL_bool modulate = ((r & g & b & a) != 0xFF);
+    const SDL_BlendMode blend = cmd->data.draw.blend;
+    Uint32 src[PS5_SPAN_SIZE], dst[PS5_SPAN_SIZE];
+    Uint64 incx, incy;
+    SDL_Rect area;
+
+    if (srcrect->w <= 0 || srcrect->h <= 0 ||
+        !SDL_IntersectRect(dstrect, clip, &area)) {
+        return;
+    }
+
+    incx = ((Uint64)srcrect->w << 16) / dstrect->w;
+    incy = ((Uint64)srcrect->h << 16) / dstrect->h;
+
+    for (int y = area.y; y < area.y + area.h; y++) {
+        const Uint64 posy = incy / 2 + (y - dstrect->y) * incy;
+        const int sy = srcrect->y + (int)(posy >> 16);
+
+        for (int x = area.x; x < area.x + area.w; x += PS5_SPAN_SIZE) {
+            const int n = SDL_min(area.x + area.w - x, PS5_SPAN_SIZE);
+            const Uint64 posx = incx / 2 + (x - dstrect->x) * incx;
+
+            PS5_FetchTexels(surface, srcrect->x, sy, posx, incx, src, n);
+            if (modulate) {
+                PS5_ModulateSpan(src, n, r, g, b, a);
+            }
+            if (blend == SDL_BLENDMODE_NONE) {
+                PS5_WriteTargetSpan(target, x, y, src, n);
+            } else {
+                PS5_ReadTargetSpan(target, x, y, dst, n);
+                PS5_BlendSpan(dst, src, n, blend);
+                PS5_WriteTargetSpan(target, x, y, dst, n);
+            }
+        }
+    }
+}
+
+int PS5_RunDrawCommands(const PS5_RenderTarget *target, SDL_RenderCommand *cmd,
+                        void *vertices)
+{
+    PS5_DrawStateCache drawstate;
+
+    drawstate.viewport = NULL;
+    drawstate.cliprect = NULL;
+    drawstate.clip_dirty = SDL_TRUE;
+
+    while (cmd) {
+        const int vx = drawstate.viewport ? drawstate.viewport->x : 0;
+        const int vy = drawstate.viewport ? drawstate.viewport->y : 0;
+
+        switch (cmd->command) {
+        case SDL_RENDERCMD_SETDRAWCOLOR: {
+            break; /* Not used in this backend. */
+        }
+
+        case SDL_RENDERCMD_SETVIEWPORT: {
+            drawstate.viewport = &cmd->data.viewport.rect;
+            drawstate.clip_dirty = SDL_TRUE;
+            break;
+        }
+
+        case SDL_RENDERCMD_SETCLIPRECT: {
+            drawstate.cliprect = cmd->data.cliprect.enabled ? &cmd->data.cliprect.rect : NULL;
+            drawstate.clip_dirty = SDL_TRUE;
+            break;
+        }
+
+        case SDL_RENDERCMD_CLEAR: {
+            SDL_Rect all;
+
+            /* By definition the clear ignores the clip rect */
+            all.x = all.y = 0;
+            all.w = target->width;
+            all.h = target->height;
+            PS5_FillTargetRect(target, &all, PS5_ABGR(cmd->data.color.r, cmd->data.color.g,
+                                                      cmd->data.color.b, cmd->data.color.a));
+            break;
+        }
+
+        case SDL_RENDERCMD_DRAW_POINTS: {
+            const Uint32 color = PS5_ABGR(cmd->data.draw.r, cmd->data.draw.g,
+                                          cmd->data.draw.b, cmd->data.draw.a);
+            const int count = (int)cmd->data.draw.count;
+            const SDL_Point *verts = (SDL_Point *)((Uint8 *)vertices + cmd->data.draw.first);
+
+            PS5_SetDrawState(target, &drawstate);
+            for (int i = 0; i < count; i++) {
+                PS5_DrawPixel(target, &drawstate.clip, verts[i].x + vx, verts[i].y + vy,
+                              color, cmd->data.draw.blend);
+            }
+            break;
+        }
+
+        case SDL_RENDERCMD_DRAW_LINES: {
+            const Uint32 color = PS5_ABGR(cmd->data.draw.r, cmd->data.draw.g,
+                                          cmd->data.draw.b, cmd->data.draw.a);
+            const int count = (int)cmd->data.draw.count;
+            const SDL_Point *verts = (SDL_Point *)((Uint8 *)vertices + cmd->data.draw.first);
+
+            PS5_SetDrawState(target, &drawstate);
+
+            /* Joints are drawn once, like SDL_DrawLines does */
+            for (int i = 1; i < count; i++) {
+                const SDL_bool draw_end = (verts[i - 1].x == verts[i].x &&
+                                           verts[i - 1].y == verts[i].y);
+
+                PS5_DrawLine(target, &drawstate.clip, verts[i - 1].x + vx, verts[i - 1].y + vy,
+                             verts[i].x + vx, verts[i].y + vy, color, cmd->data.draw.blend,
+                             draw_end);
+            }
+            if (count > 0 && (verts[0].x != verts[count - 1].x ||
+                              verts[0].y != verts[count - 1].y)) {
+                PS5_DrawPixel(target, &drawstate.clip, verts[count - 1].x + vx,
+                              verts[count - 1].y + vy, color, cmd->data.draw.blend);
+            }
+            break;
+        }
+
+        case SDL_RENDERCMD_FILL_RECTS: {
+            const Uint32 color = PS5_ABGR(cmd->data.draw.r, cmd->data.draw.g,
+                                          cmd->data.draw.b, cmd->data.draw.a);
+            const int count = (int)cmd->data.draw.count;
+            const SDL_Rect *verts = (SDL_Rect *)((Uint8 *)vertices + cmd->data.draw.first);
+
+            PS5_SetDrawState(target, &drawstate);
+            for (int i = 0; i < count; i++) {
+                SDL_Rect rect = verts[i];
+
+                rect.x += vx;
+                rect.y += vy;
+                PS5_FillRect(target, &drawstate.clip, &rect, color, cmd->data.draw.blend);
+            }
+            break;
+        }
+
+        case SDL_RENDERCMD_COPY: {
+            const SDL_Rect *verts = (SDL_Rect *)((Uint8 *)vertices + cmd->data.draw.first);
+            SDL_Rect dstrect = verts[1];
+
+            PS5_SetDrawState(target, &drawstate);
+            dstrect.x += vx;
+            dstrect.y += vy;
+            PS5_Copy(target, &drawstate.clip, cmd, &verts[0], &dstrect);
+            break;
+        }
+
+        case SDL_RENDERCMD_COPY_EX:
+        case SDL_RENDERCMD_GEOMETRY:
+            break; /* Not queued by this backend. */
+
+        case SDL_RENDERCMD_NO_OP:
+            break;
+        }
+
+        cmd = cmd->next;
+    }
+
+    return 0;
+}
+
+#endif /* SDL_VIDEO_RENDER_PS5 */
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,63 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../../SDL_internal.h"
+
+#ifndef SDL_ps5draw_h_
+#define SDL_ps5draw_h_
+
+/* Translation of the render command queue into pixels of a scan-out
+   buffer. It has no SCE dependency, so that it can be checked on the host
+   against the software renderer (see test/testps5render.c). */
+
+#include "../SDL_sysrender.h"
+
+/* Where the commands are drawn. Textures are SDL_Surfaces in one of the
+   formats of PS5_RenderDriver, the target is always ABGR8888. */
+typedef struct PS5_RenderTarget
+{
+    Uint32 *pixels;
+    int width;
+    int height;
+    SDL_bool linear; /* laid out in rows rather than in tiles */
+} PS5_RenderTarget;
+
+/* Vertex data is queued in the layout of the software renderer: points
+   and lines as SDL_Points, rects as SDL_Rects and copies as a pair of
+   source and destination SDL_Rects */
+int PS5_QueueDrawPoints(SDL_Renderer *renderer, SDL_RenderCommand *cmd,
+                        const SDL_FPoint *points, int count);
+int PS5_QueueFillRects(SDL_Renderer *renderer, SDL_RenderCommand *cmd,
+                       const SDL_FRect *rects, int count);
+int PS5_QueueCopy(SDL_Renderer *renderer, SDL_RenderCommand *cmd,
+                  SDL_Texture *texture, const SDL_Rect *srcrect,
+                  const SDL_FRect *dstrect);
+
+/* Draw the commands starting at 'cmd' into 'target' */
+int PS5_RunDrawCommands(const PS5_RenderTarget *target, SDL_RenderCommand *cmd,
+                        void *vertices);
+
+/* Read 'count' pixels of row 'y', starting at column 'x' */
+void PS5_ReadTargetSpan(const PS5_RenderTarget *target, int x, int y,
+                        Uint32 *pixels, int count);
+
+#endif /* SDL_ps5draw_h_ */
+
+/* vi: set ts=4 sw=4 expandtab: */
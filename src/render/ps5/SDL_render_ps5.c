@@ -0,0 +1,300 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../../SDL_internal.h"
+
+#if SDL_VIDEO_RENDER_PS5
+
+#include "../SDL_sysrender.h"
+#include "../../video/ps5/SDL_ps5video.h"
+#include "SDL_ps5draw.h"
+
+/* Commands are drawn straight into the scan-out buffers, skipping the
+   window surface and the swizzle pass of the framebuffer path. Textures
+   live in system memory as SDL_Surfaces. */
+
+typedef struct
+{
+    PS5_DeviceData *device_data;
+    int buffer; /* being drawn into, -1 until the first command of a frame */
+} PS5_RenderData;
+
+/* Get the buffer for the current frame, the first time it is needed */
+static int PS5_ActivateRenderer(SDL_Renderer *renderer, PS5_RenderTarget *target)
+{
+    PS5_RenderData *data = (PS5_RenderData *)renderer->driverdata;
+    PS5_VideoOut *vo = &data->device_data->video_out;
+
+    if (data->buffer < 0) {
+        data->buffer = PS5_VideoOutAcquire(vo);
+        if (data->buffer < 0) {
+            return -1;
+        }
+    }
+
+    target->pixels = (Uint32 *)vo->vbuf[data->buffer].data;
+    target->width = vo->width;
+    target->height = vo->height;
+    target->linear = vo->linear;
+
+    return 0;
+}
+
+static void PS5_WindowEvent(SDL_Renderer *renderer, const SDL_WindowEvent *event)
+{
+    PS5_RenderData *data = (PS5_RenderData *)renderer->driverdata;
+
+    /* The scan-out buffers may have been reallocated */
+    if (event->event == SDL_WINDOWEVENT_SIZE_CHANGED) {
+        data->buffer = -1;
+    }
+}
+
+static int PS5_GetOutputSize(SDL_Renderer *renderer, int *w, int *h)
+{
+    PS5_RenderData *data = (PS5_RenderData *)renderer->driverdata;
+
+    if (w) {
+        *w = data->device_data->video_out.width;
+    }
+    if (h) {
+        *h = data->device_data->video_out.height;
+    }
+    return 0;
+}
+
+static int PS5_CreateTexture(SDL_Renderer *renderer, SDL_Texture *texture)
+{
+    texture->driverdata = SDL_CreateRGBSurfaceWithFormat(0, texture->w, texture->h, 0,
+                                                         texture->format);
+    if (!texture->driverdata) {
+        return -1;
+    }
+    return 0;
+}
+
+static int PS5_UpdateTexture(SDL_Renderer *renderer, SDL_Texture *texture,
+                             const SDL_Rect *rect, const void *pixels, int pitch)
+{
+    SDL_Surface *surface = (SDL_Surface *)texture->driverdata;
+    const Uint8 *src = (const Uint8 *)pixels;
+    Uint8 *dst = (Uint8 *)surface->pixels + rect->y * surface->pitch + rect->x * 4;
+
+    for (int row = 0; row < rect->h; ++row) {
+        SDL_memcpy(dst, src, (size_t)rect->w * 4);
+        src += pitch;
+        dst += surface->pitch;
+    }
+    return 0;
+}
+
+static int PS5_LockTexture(SDL_Renderer *renderer, SDL_Texture *texture,
+                           const SDL_Rect *rect, void **pixels, int *pitch)
+{
+    SDL_Surface *surface = (SDL_Surface *)texture->driverdata;
+
+    *pixels = (Uint8 *)surface->pixels + rect->y * surface->pitch + rect->x * 4;
+    *pitch = surface->pitch;
+    return 0;
+}
+
+static void PS5_UnlockTexture(SDL_Renderer *renderer, SDL_Texture *texture)
+{
+}
+
+static void PS5_SetTextureScaleMode(SDL_Renderer *renderer, SDL_Texture *texture, SDL_ScaleMode scaleMode)
+{
+    /* Textures are always sampled with the nearest filter */
+}
+
+static int PS5_SetRenderTarget(SDL_Renderer *renderer, SDL_Texture *texture)
+{
+    return SDL_Unsupported();
+}
+
+static int PS5_QueueNoOp(SDL_Renderer *renderer, SDL_RenderCommand *cmd)
+{
+    return 0; /* viewport and draw color are tracked in PS5_RunDrawCommands. */
+}
+
+static int PS5_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, void *vertices, size_t vertsize)
+{
+    PS5_RenderTarget target;
+
+    if (PS5_ActivateRenderer(renderer, &target) < 0) {
+        return -1;
+    }
+    return PS5_RunDrawCommands(&target, cmd, vertices);
+}
+
+static int PS5_RenderReadPixels(SDL_Renderer *renderer, const SDL_Rect *rect,
+                                Uint32 format, void *pixels, int pitch)
+{
+    PS5_RenderTarget target;
+    Uint32 *row;
+    int retval = 0;
+
+    if (PS5_ActivateRenderer(renderer, &target) < 0) {
+        return -1;
+    }
+    if (rect->x < 0 || rect->x + rect->w > target.width ||
+        rect->y < 0 || rect->y + rect->h > target.height) {
+        return SDL_SetError("Tried to read outside of surface bounds");
+    }
+
+    row = (Uint32 *)SDL_malloc((size_t)rect->w * sizeof(Uint32));
+    if (!row) {
+        return SDL_OutOfMemory();
+    }
+    for (int y = 0; y < rect->h && retval == 0; y++) {
+        PS5_ReadTargetSpan(&target, rect->x, rect->y + y, row, rect->w);
+        retval = SDL_ConvertPixels(rect->w, 1, SDL_PIXELFORMAT_ABGR8888, row,
+                                   rect->w * 4, format,
+                                   (Uint8 *)pixels + y * pitch, pitch);
+    }
+    SDL_free(row);
+
+    return retval;
+}
+
+static int PS5_RenderPresent(SDL_Renderer *renderer)
+{
+    PS5_RenderData *data = (PS5_RenderData *)renderer->driverdata;
+    PS5_RenderTarget target;
+    int buffer;
+
+    if (PS5_ActivateRenderer(renderer, &target) < 0) {
+        return -1;
+    }
+    buffer = data->buffer;
+    data->buffer = -1;
+
+    return PS5_VideoOutSubmit(&data->device_data->video_out, buffer);
+}
+
+static void PS5_DestroyTexture(SDL_Renderer *renderer, SDL_Texture *texture)
+{
+    SDL_FreeSurface((SDL_Surface *)texture->driverdata);
+}
+
+static void PS5_DestroyRenderer(SDL_Renderer *renderer)
+{
+    PS5_RenderData *data = (PS5_RenderData *)renderer->driverdata;
+
+    if (data) {
+        /* A window surface created later has to redraw the whole frame */
+        data->device_data->tiled_width = data->device_data->tiled_height = 0;
+        SDL_free(data);
+    }
+    SDL_free(renderer);
+}
+
+static int PS5_SetVSync(SDL_Renderer *renderer, const int vsync)
+{
+    PS5_RenderData *data = (PS5_RenderData *)renderer->driverdata;
+
+    data->device_data->vsync = vsync ? SDL_TRUE : SDL_FALSE;
+    PS5_UpdateSwapInterval(data->device_data);
+    if (vsync) {
+        renderer->info.flags |= SDL_RENDERER_PRESENTVSYNC;
+    } else {
+        renderer->info.flags &= ~SDL_RENDERER_PRESENTVSYNC;
+    }
+    return 0;
+}
+
+static SDL_Renderer *PS5_CreateRenderer(SDL_Window *window, Uint32 flags)
+{
+    SDL_VideoDevice *device = SDL_GetVideoDevice();
+    SDL_Renderer *renderer;
+    PS5_RenderData *data;
+
+    if (!device || SDL_strcmp(device->name, PS5_bootstrap.name) != 0) {
+        SDL_SetError("PS5 renderer needs the PS5 video driver");
+        return NULL;
+    }
+
+    renderer = (SDL_Renderer *)SDL_calloc(1, sizeof(*renderer));
+    if (!renderer) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+
+    data = (PS5_RenderData *)SDL_calloc(1, sizeof(*data));
+    if (!data) {
+        PS5_DestroyRenderer(renderer);
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    data->device_data = (PS5_DeviceData *)device->driverdata;
+    data->buffer = -1;
+
+    renderer->WindowEvent = PS5_WindowEvent;
+    renderer->GetOutputSize = PS5_GetOutputSize;
+    renderer->CreateTexture = PS5_CreateTexture;
+    renderer->UpdateTexture = PS5_UpdateTexture;
+    renderer->LockTexture = PS5_LockTexture;
+    renderer->UnlockTexture = PS5_UnlockTexture;
+    renderer->SetTextureScaleMode = PS5_SetTextureScaleMode;
+    renderer->SetRenderTarget = PS5_SetRenderTarget;
+    renderer->QueueSetViewport = PS5_QueueNoOp;
+    renderer->QueueSetDrawColor = PS5_QueueNoOp;
+    renderer->QueueDrawPoints = PS5_QueueDrawPoints;
+    renderer->QueueDrawLines = PS5_QueueDrawPoints; /* lines and points queue vertices the same way. */
+    renderer->QueueFillRects = PS5_QueueFillRects;
+    renderer->QueueCopy = PS5_QueueCopy;
+    renderer->RunCommandQueue = PS5_RunCommandQueue;
+    renderer->RenderReadPixels = PS5_RenderReadPixels;
+    renderer->RenderPresent = PS5_RenderPresent;
+    renderer->DestroyTexture = PS5_DestroyTexture;
+    renderer->DestroyRenderer = PS5_DestroyRenderer;
+    renderer->SetVSync = PS5_SetVSync;
+    renderer->info = PS5_RenderDriver.info;
+    renderer->driverdata = data;
+    renderer->window = window;
+
+    /* Nothing outside of the command queue touches the scan-out buffers */
+    renderer->always_batch = SDL_TRUE;
+
+    PS5_SetVSync(renderer, (flags & SDL_RENDERER_PRESENTVSYNC) ? 1 : 0);
+
+    return renderer;
+}
+
+/* Drawn by the CPU. Not accelerated either, as it can't do copies with
+   rotation, geometry or target textures yet, so the software renderer
+   stays the default and window surfaces don't go through this driver. */
+SDL_RenderDriver PS5_RenderDriver = {
+    PS5_CreateRenderer,
+    {
+     "PS5",
+     SDL_RENDERER_PRESENTVSYNC,
+     2,
+     {
+      SDL_PIXELFORMAT_ABGR8888,
+      SDL_PIXELFORMAT_ARGB8888
+     },
+     4096,
+     4096}
+};
+
+#endif /* SDL_VIDEO_RENDER_PS5 */
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -27,6 +27,7 @@
 #include "SDL_pixels_c.h"
 #include "SDL_yuv_c.h"
 #include "../render/SDL_sysrender.h"
+#include "../SDL_trace_c.h"
 
 /* Check to make sure we can safely check multiplication of surface w and pitch and it won't overflow size_t */
 SDL_COMPILE_TIME_ASSERT(surface_size_assumptions,
@@ -680,6 +681,8 @@ void SDL_GetClipRect(SDL_Surface *surface, SDL_Rect *rect)
 int SDL_LowerBlit(SDL_Surface *src, SDL_Rect *srcrect,
                   SDL_Surface *dst, SDL_Rect *dstrect)
 {
+    int retval;
+
     /* Check to make sure the blit mapping is valid */
     if ((src->map->dst != dst) ||
         (dst->format->palette &&
@@ -695,7 +698,11 @@ int SDL_LowerBlit(SDL_Surface *src, SDL_Rect *srcrect,
         /*              src, dst->flags, src->map->info.flags, dst, dst->flags, */
         /*              dst->map->info.flags, src->map->blit); */
     }
-    return src->map->blit(src, srcrect, dst, dstrect);
+
+    SDL_TRACE_BEGIN("SDL_LowerBlit");
+    retval = src->map->blit(src, srcrect, dst, dstrect);
+    SDL_TRACE_END("SDL_LowerBlit");
+    return retval;
 }
 
 int SDL_UpperBlit(SDL_Surface *src, const SDL_Rect *srcrect,
@@ -31,6 +31,7 @@
 #include "SDL_rect_c.h"
 #include "../events/SDL_events_c.h"
 #include "../timer/SDL_timer_c.h"
+#include "../SDL_trace_c.h"
 
 #include "SDL_syswm.h"
 
@@ -2801,6 +2802,8 @@ int SDL_UpdateWindowSurface(SDL_Window *window)
 int SDL_UpdateWindowSurfaceRects(SDL_Window *window, const SDL_Rect *rects,
                                  int numrects)
 {
+    int retval;
+
     CHECK_WINDOW_MAGIC(window, -1);
 
     if (!window->surface_valid) {
@@ -2809,7 +2812,10 @@ int SDL_UpdateWindowSurfaceRects(SDL_Window *window, const SDL_Rect *rects,
 
     SDL_assert(_this->checked_texture_framebuffer); /* we should have done this before we had a valid surface. */
 
-    return _this->UpdateWindowFramebuffer(_this, window, rects, numrects);
+    SDL_TRACE_BEGIN("UpdateWindowFramebuffer");
+    retval = _this->UpdateWindowFramebuffer(_this, window, rects, numrects);
+    SDL_TRACE_END("UpdateWindowFramebuffer");
+    return retval;
 }
 
 int SDL_DestroyWindowSurface(SDL_Window *window)
@@ -21,107 +21,35 @@
 
 #include "../../SDL_internal.h"
 
-#if SDL_VIDEO_DRIVER_PS5
+#if defined(SDL_VIDEO_DRIVER_PS5) || defined(SDL_PS5_HOST_TEST)
 
 #include <errno.h>
 #include <stdbool.h>
 #include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
 
 #include "SDL_error.h"
 #include "SDL_events.h"
+#include "SDL_hints.h"
 
 #include "../../events/SDL_keyboard_c.h"
 
 #include "SDL_ps5keyboard.h"
 
-typedef struct keyboard_state
-{
-    uint64_t junk0[2];
-    uint8_t available;
-    uint32_t junk1[2];
-    uint32_t modifiers;
-    uint16_t scankey[16];
-    uint64_t junk3[4];
-} keyboard_state_t;
-
-typedef enum SceImeDialogStatus
-{
-    SCE_IME_DIALOG_STATUS_NONE,
-    SCE_IME_DIALOG_STATUS_RUNNING,
-    SCE_IME_DIALOG_STATUS_FINISHED
-} SceImeDialogStatus;
-
-typedef int (*SceImeTextFilter)(wchar_t*, uint32_t*, const wchar_t*, uint32_t);
-
-typedef struct SceImeDialogParam
-{
-    int userId;
-    enum {
-	SCE_IME_TYPE_DEFAULT,
-	SCE_IME_TYPE_BASIC_LATIN,
-	SCE_IME_TYPE_URL,
-	SCE_IME_TYPE_MAIL,
-	SCE_IME_TYPE_NUMBER
-    } type;
-    uint64_t supportedLanguages;
-    enum {
-	SCE_IME_ENTER_LABEL_DEFAULT,
-	SCE_IME_ENTER_LABEL_SEND,
-	SCE_IME_ENTER_LABEL_SEARCH,
-	SCE_IME_ENTER_LABEL_GO,
-    } enterLabel;
-    enum {
-	SCE_IME_INPUT_METHOD_DEFAULT
-    } inputMethod;
-    SceImeTextFilter filter;
-    uint32_t option;
-    uint32_t maxTextLength;
-    wchar_t *inputTextBuffer;
-    float posx;
-    float posy;
-    enum {
-	SCE_IME_HALIGN_LEFT,
-	SCE_IME_HALIGN_CENTER,
-	SCE_IME_HALIGN_RIGHT
-    } halign;
-    enum {
-	SCE_IME_VALIGN_TOP,
-	SCE_IME_VALIGN_CENTER,
-	SCE_IME_VALIGN_BOTTOM
-    } valign;
-    const wchar_t *placeholder;
-    const wchar_t *title;
-    int8_t reserved[16];
-} SceImeDialogParam;
-
-typedef struct SceImeDialogResult
-{
-    enum {
-	SCE_IME_DIALOG_END_STATUS_OK,
-	SCE_IME_DIALOG_END_STATUS_USER_CANCELED,
-	SCE_IME_DIALOG_END_STATUS_ABORTED,
-    } outcome;
-    int8_t reserved[12];
-} SceImeDialogResult;
-
-
-int sceKeyboardInit(void);
-int sceKeyboardOpen(int, int, int, void *);
-int sceKeyboardReadState(int, keyboard_state_t *);
-int sceKeyboardClose(int);
-
-int sceUserServiceInitialize(void *);
-int sceUserServiceGetForegroundUser(int *);
-
-int sceImeDialogInit(const SceImeDialogParam*, void*);
-int sceImeDialogGetResult(SceImeDialogResult*);
-int sceImeDialogTerm(void);
-
-SceImeDialogStatus sceImeDialogGetStatus(void);
+// States taken from the keyboard's buffer per call in buffered mode
+#define PS5_KEYBOARD_STATES 16
 
+// The scancodes of the bits of keyboard_state_t.modifiers
+static const SDL_Scancode g_modifier_keys[8] = {
+    SDL_SCANCODE_LCTRL, SDL_SCANCODE_LSHIFT, SDL_SCANCODE_LALT, SDL_SCANCODE_LGUI,
+    SDL_SCANCODE_RCTRL, SDL_SCANCODE_RSHIFT, SDL_SCANCODE_RALT, SDL_SCANCODE_RGUI
+};
 
 static int g_keyboard_handle = -1;
 static keyboard_state_t g_prev_keyboard_state = {0};
+static SDL_bool g_keyboard_buffered = SDL_FALSE;
+static keyboard_state_t g_keyboard_states[PS5_KEYBOARD_STATES];
 
 static SceImeDialogStatus g_ime_dialog_status = SCE_IME_DIALOG_STATUS_NONE;;
 static wchar_t g_ime_dialog_title[0x80] = {0};
@@ -184,6 +112,9 @@ int PS5_Keyboard_Init(void)
         return SDL_SetError("scePadInit: 0x%08x", err);
     }
 
+    g_keyboard_buffered = SDL_GetHintBoolean(SDL_HINT_PS5_KEYBOARD_BUFFERED, SDL_FALSE);
+    SDL_zero(g_prev_keyboard_state);
+
     return 0;
 }
 
@@ -237,100 +168,120 @@ static int PS5_ImeDialog_PumpEvents(void)
     return 0;
 }
 
-int PS5_Keyboard_PumpEvents(void)
+// The keys of 'keys' that aren't in 'others', sorted by scancode. A key
+// can be in any slot of the state, and move to another one as keys before
+// it are released.
+static int PS5_Keyboard_Missing(const uint16_t *keys, const uint16_t *others,
+                                uint16_t *missing)
 {
-    keyboard_state_t curr;
-    uint32_t diff;
-    int err;
+    int n = 0;
 
-    PS5_ImeDialog_PumpEvents();
+    for (int i = 0; i < 16; i++) {
+        SDL_bool found = (keys[i] == 0);
+        int j;
 
-    if (g_keyboard_handle <= 0) {
-        return 0;
-    }
+        for (j = 0; j < 16; j++) {
+            found |= (others[j] == keys[i]);
+        }
+        for (j = 0; j < n && !found; j++) {
+            found = (missing[j] == keys[i]);
+        }
+        if (found) {
+            continue;
+        }
 
-    err = sceKeyboardReadState(g_keyboard_handle, &curr);
-    if (err != 0) {
-        return SDL_SetError("sceKeyboardReadState: 0x%08x", err);
+        for (j = n++; j > 0 && missing[j - 1] > keys[i]; j--) {
+            missing[j] = missing[j - 1];
+        }
+        missing[j] = keys[i];
     }
 
-    if (!curr.available) {
-        return 0;
+    return n;
+}
+
+// Send the keys that went up and down from one state to the next. Keys go
+// up before modifiers, and modifiers go down before keys, so that a
+// shortcut typed between two pumps still comes out as one.
+static void PS5_Keyboard_SendChanges(const keyboard_state_t *prev,
+                                     const keyboard_state_t *curr)
+{
+    const uint32_t released = prev->modifiers & ~curr->modifiers;
+    const uint32_t pressed = curr->modifiers & ~prev->modifiers;
+    uint16_t keys[16];
+    int n;
+
+    n = PS5_Keyboard_Missing(prev->scankey, curr->scankey, keys);
+    for (int i = 0; i < n; i++) {
+        SDL_SendKeyboardKey(SDL_RELEASED, (SDL_Scancode)keys[i]);
     }
 
-    diff = g_prev_keyboard_state.modifiers ^ curr.modifiers;
-    if (diff) {
-        if (diff & 0x01) {
-            if (g_prev_keyboard_state.modifiers & 0x01) {
-                SDL_SendKeyboardKey(SDL_RELEASED, SDL_SCANCODE_LCTRL);
-            } else {
-                SDL_SendKeyboardKey(SDL_PRESSED, SDL_SCANCODE_LCTRL);
-            }
-        }
-        if (diff & 0x02) {
-            if (g_prev_keyboard_state.modifiers & 0x02) {
-                SDL_SendKeyboardKey(SDL_RELEASED, SDL_SCANCODE_LSHIFT);
-            } else {
-                SDL_SendKeyboardKey(SDL_PRESSED, SDL_SCANCODE_LSHIFT);
-            }
-        }
-        if (diff & 0x04) {
-            if (g_prev_keyboard_state.modifiers & 0x04) {
-                SDL_SendKeyboardKey(SDL_RELEASED, SDL_SCANCODE_LALT);
-            } else {
-                SDL_SendKeyboardKey(SDL_PRESSED, SDL_SCANCODE_LALT);
-            }
-        }
-        if (diff & 0x08) {
-            if (g_prev_keyboard_state.modifiers & 0x08) {
-                SDL_SendKeyboardKey(SDL_RELEASED, SDL_SCANCODE_LGUI);
-            } else {
-                SDL_SendKeyboardKey(SDL_PRESSED, SDL_SCANCODE_LGUI);
-            }
+    for (int i = 0; i < SDL_arraysize(g_modifier_keys); i++) {
+        if (released & (1u << i)) {
+            SDL_SendKeyboardKey(SDL_RELEASED, g_modifier_keys[i]);
         }
-        if (diff & 0x10) {
-            if (g_prev_keyboard_state.modifiers & 0x10) {
-                SDL_SendKeyboardKey(SDL_RELEASED, SDL_SCANCODE_RCTRL);
-            } else {
-                SDL_SendKeyboardKey(SDL_PRESSED, SDL_SCANCODE_RCTRL);
-            }
-        }
-        if (diff & 0x20) {
-            if (g_prev_keyboard_state.modifiers & 0x20) {
-                SDL_SendKeyboardKey(SDL_RELEASED, SDL_SCANCODE_RSHIFT);
-            } else {
-                SDL_SendKeyboardKey(SDL_PRESSED, SDL_SCANCODE_RSHIFT);
-            }
+    }
+    for (int i = 0; i < SDL_arraysize(g_modifier_keys); i++) {
+        if (pressed & (1u << i)) {
+            SDL_SendKeyboardKey(SDL_PRESSED, g_modifier_keys[i]);
         }
-        if (diff & 0x40) {
-            if (g_prev_keyboard_state.modifiers & 0x40) {
-                SDL_SendKeyboardKey(SDL_RELEASED, SDL_SCANCODE_RALT);
-            } else {
-                SDL_SendKeyboardKey(SDL_PRESSED, SDL_SCANCODE_RALT);
-            }
+    }
+
+    n = PS5_Keyboard_Missing(curr->scankey, prev->scankey, keys);
+    for (int i = 0; i < n; i++) {
+        SDL_SendKeyboardKey(SDL_PRESSED, (SDL_Scancode)keys[i]);
+    }
+}
+
+static void PS5_Keyboard_Apply(const keyboard_state_t *curr)
+{
+    if (!curr->available) {
+        return;
+    }
+
+    PS5_Keyboard_SendChanges(&g_prev_keyboard_state, curr);
+    memcpy(&g_prev_keyboard_state, curr, sizeof(*curr));
+}
+
+// Every state the keyboard queued since the last pump, oldest first, so
+// that keys pressed and released between two pumps aren't lost
+static int PS5_Keyboard_ReadBuffered(void)
+{
+    int n;
+
+    do {
+        n = sceKeyboardRead(g_keyboard_handle, g_keyboard_states, PS5_KEYBOARD_STATES);
+        if (n < 0) {
+            return SDL_SetError("sceKeyboardRead: 0x%08x", n);
         }
-        if (diff & 0x80) {
-            if (g_prev_keyboard_state.modifiers & 0x80) {
-                SDL_SendKeyboardKey(SDL_RELEASED, SDL_SCANCODE_RGUI);
-            } else {
-                SDL_SendKeyboardKey(SDL_PRESSED, SDL_SCANCODE_RGUI);
-            }
+        for (int i = 0; i < n; i++) {
+            PS5_Keyboard_Apply(&g_keyboard_states[i]);
         }
+    } while (n == PS5_KEYBOARD_STATES);
+
+    return 0;
+}
+
+int PS5_Keyboard_PumpEvents(void)
+{
+    keyboard_state_t curr;
+    int err;
+
+    PS5_ImeDialog_PumpEvents();
+
+    if (g_keyboard_handle <= 0) {
+        return 0;
     }
 
-    for (int i = 0; i < 16; i++) {
-        if (g_prev_keyboard_state.scankey[i] == curr.scankey[i]) {
-            continue;
-        }
+    if (g_keyboard_buffered) {
+        return PS5_Keyboard_ReadBuffered();
+    }
 
-        if (g_prev_keyboard_state.scankey[i] == 0) {
-            SDL_SendKeyboardKey(SDL_PRESSED, curr.scankey[i]);
-        } else {
-            SDL_SendKeyboardKey(SDL_RELEASED, g_prev_keyboard_state.scankey[i]);
-        }
+    err = sceKeyboardReadState(g_keyboard_handle, &curr);
+    if (err != 0) {
+        return SDL_SetError("sceKeyboardReadState: 0x%08x", err);
     }
 
-    memcpy(&g_prev_keyboard_state, &curr, sizeof(curr));
+    PS5_Keyboard_Apply(&curr);
 
     return 0;
 }
@@ -362,6 +313,6 @@ SDL_bool PS5_IsScreenKeyboardShown(_THIS, SDL_Window *window)
     return SDL_FALSE;
 }
 
-#endif /* SDL_VIDEO_DRIVER_PS5 */
+#endif /* SDL_VIDEO_DRIVER_PS5 || SDL_PS5_HOST_TEST */
 
 /* vi: set ts=4 sw=4 expandtab: */
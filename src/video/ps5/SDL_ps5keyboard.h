@@ -23,6 +23,9 @@
 #ifndef SDL_ps5keyboard_h_
 #define SDL_ps5keyboard_h_
 
+#include <stdint.h>
+#include <wchar.h>
+
 #include "../SDL_sysvideo.h"
 
 int PS5_Keyboard_Init(void);
@@ -37,6 +40,93 @@ void PS5_ShowScreenKeyboard(_THIS, SDL_Window *window);
 void PS5_HideScreenKeyboard(_THIS, SDL_Window *window);
 
 
+typedef struct keyboard_state
+{
+    uint64_t junk0[2];
+    uint8_t available;
+    uint32_t junk1[2];
+    uint32_t modifiers;
+    uint16_t scankey[16];
+    uint64_t junk3[4];
+} keyboard_state_t;
+
+typedef enum SceImeDialogStatus
+{
+    SCE_IME_DIALOG_STATUS_NONE,
+    SCE_IME_DIALOG_STATUS_RUNNING,
+    SCE_IME_DIALOG_STATUS_FINISHED
+} SceImeDialogStatus;
+
+typedef int (*SceImeTextFilter)(wchar_t*, uint32_t*, const wchar_t*, uint32_t);
+
+typedef struct SceImeDialogParam
+{
+    int userId;
+    enum {
+	SCE_IME_TYPE_DEFAULT,
+	SCE_IME_TYPE_BASIC_LATIN,
+	SCE_IME_TYPE_URL,
+	SCE_IME_TYPE_MAIL,
+	SCE_IME_TYPE_NUMBER
+    } type;
+    uint64_t supportedLanguages;
+    enum {
+	SCE_IME_ENTER_LABEL_DEFAULT,
+	SCE_IME_ENTER_LABEL_SEND,
+	SCE_IME_ENTER_LABEL_SEARCH,
+	SCE_IME_ENTER_LABEL_GO,
+    } enterLabel;
+    enum {
+	SCE_IME_INPUT_METHOD_DEFAULT
+    } inputMethod;
+    SceImeTextFilter filter;
+    uint32_t option;
+    uint32_t maxTextLength;
+    wchar_t *inputTextBuffer;
+    float posx;
+    float posy;
+    enum {
+	SCE_IME_HALIGN_LEFT,
+	SCE_IME_HALIGN_CENTER,
+	SCE_IME_HALIGN_RIGHT
+    } halign;
+    enum {
+	SCE_IME_VALIGN_TOP,
+	SCE_IME_VALIGN_CENTER,
+	SCE_IME_VALIGN_BOTTOM
+    } valign;
+    const wchar_t *placeholder;
+    const wchar_t *title;
+    int8_t reserved[16];
+} SceImeDialogParam;
+
+typedef struct SceImeDialogResult
+{
+    enum {
+	SCE_IME_DIALOG_END_STATUS_OK,
+	SCE_IME_DIALOG_END_STATUS_USER_CANCELED,
+	SCE_IME_DIALOG_END_STATUS_ABORTED,
+    } outcome;
+    int8_t reserved[12];
+} SceImeDialogResult;
+
+
+int sceKeyboardInit(void);
+int sceKeyboardOpen(int, int, int, void *);
+int sceKeyboardReadState(int, keyboard_state_t *);
+int sceKeyboardRead(int, keyboard_state_t *, int);
+int sceKeyboardClose(int);
+
+int sceUserServiceInitialize(void *);
+int sceUserServiceGetForegroundUser(int *);
+
+int sceImeDialogInit(const SceImeDialogParam*, void*);
+int sceImeDialogGetResult(SceImeDialogResult*);
+int sceImeDialogTerm(void);
+
+SceImeDialogStatus sceImeDialogGetStatus(void);
+
+
 #endif /* SDL_ps5keyboard_h_ */
 
 /* vi: set ts=4 sw=4 expandtab: */
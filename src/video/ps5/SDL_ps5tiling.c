@@ -0,0 +1,1070 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include "../../SDL_internal.h"
+
+#if defined(SDL_VIDEO_DRIVER_PS5) || defined(SDL_PS5_HOST_TEST)
+
+#if defined(__FreeBSD__) || (defined(__LINUX__) && !defined(__ANDROID__))
+#include <pthread.h>
+#ifdef HAVE_PTHREAD_NP_H
+#include <pthread_np.h>
+#endif
+#endif
+
+#include "SDL_atomic.h"
+#include "SDL_cpuinfo.h"
+#include "SDL_mutex.h"
+#include "SDL_thread.h"
+
+#include "SDL_ps5tiling.h"
+
+#ifdef __SSE2__
+#define HAVE_SSE2_INTRINSICS
+#endif
+
+#if defined(__AVX2__)
+#define HAVE_AVX2_INTRINSICS
+#define PS5_TARGET_AVX2
+#elif (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__) && defined(HAVE_IMMINTRIN_H)
+#define HAVE_AVX2_INTRINSICS
+#define PS5_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+
+/* Draws the whole micro-blocks [bx0, bx1) of the 8 pixel high band 'by',
+   'src' points to the first source row of the band */
+typedef void (*PS5_DrawBandFunc)(const PS5_TileJob *job, const Uint8 *src,
+                                 int by, int bx0, int bx1);
+
+typedef struct PS5_TileWorker
+{
+    PS5_TilePool *pool;
+    SDL_Thread *thread;
+    SDL_sem *wake;
+    int index;
+    int core;
+} PS5_TileWorker;
+
+struct PS5_TilePool
+{
+    int num_threads;
+    int num_workers;
+    SDL_atomic_t quit;
+    SDL_sem *done;
+    const PS5_TileJob *job;
+    PS5_DrawBandFunc draw_band;
+    Uint32 *scratch;     /* for each thread, kept from frame to frame */
+    size_t scratch_size; /* per thread, in pixels */
+    PS5_TileWorker workers[PS5_TILE_THREAD_COUNT - 1];
+};
+
+static void PS5_PinCurrentThread(int core)
+{
+#if defined(__FreeBSD__) && defined(HAVE_PTHREAD_NP_H)
+    cpuset_t set;
+
+    CPU_ZERO(&set);
+    CPU_SET(core, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#elif defined(__LINUX__) && !defined(__ANDROID__)
+    cpu_set_t set;
+
+    CPU_ZERO(&set);
+    CPU_SET(core, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+    (void)core;
+#endif
+}
+
+/* The scan-out layout is made of 8x8 pixel micro-blocks, each stored as 64
+   contiguous pixels: eight rows of the left four pixels followed by eight
+   rows of the right four. Inside a 512x128 tile, the offset of a micro-block
+   is the XOR of a column term and a row term, which replaces the per-pixel
+   lookup into the 128 KB table in SDL_ps5tilemap.inc. */
+#define PS5_BLOCK_SHIFT 3
+#define PS5_BLOCK_SIZE  (1 << PS5_BLOCK_SHIFT)
+
+/* Rows of scratch space each thread needs to draw a scaled band */
+#define PS5_SCALE_LINES (PS5_BLOCK_SIZE + 2)
+
+#define PS5_IsNativeFormat(format) \
+    ((format) == SDL_PIXELFORMAT_ABGR8888 || (format) == SDL_PIXELFORMAT_XBGR8888)
+
+static const Uint16 PS5_tile_block_x[PS5_TILE_WIDTH / PS5_BLOCK_SIZE] = {
+        0,    64,  2176,  2240,   512,   576,  2688,  2752,
+     8448,  8512, 10624, 10688,  8960,  9024, 11136, 11200,
+    16384, 16448, 18560, 18624, 16896, 16960, 19072, 19136,
+    24832, 24896, 27008, 27072, 25344, 25408, 27520, 27584,
+    32768, 32832, 34944, 35008, 33280, 33344, 35456, 35520,
+    41216, 41280, 43392, 43456, 41728, 41792, 43904, 43968,
+    49152, 49216, 51328, 51392, 49664, 49728, 51840, 51904,
+    57600, 57664, 59776, 59840, 58112, 58176, 60288, 60352,
+};
+
+static const Uint16 PS5_tile_block_y[PS5_TILE_HEIGHT / PS5_BLOCK_SIZE] = {
+        0,  1088,   128,  1216,   256,  1344,   384,  1472,
+     4608,  5696,  4736,  5824,  4864,  5952,  4992,  6080,
+};
+
+static SDL_INLINE size_t PS5_TileBlockOffset(int bx, int by, int width)
+{
+    const int bw = PS5_TILE_WIDTH / PS5_BLOCK_SIZE;
+    const int bh = PS5_TILE_HEIGHT / PS5_BLOCK_SIZE;
+
+    return (size_t)(by / bh) * width * PS5_TILE_HEIGHT +
+           (size_t)(bx / bw) * PS5_TILE_SIZE +
+           (PS5_tile_block_x[bx % bw] ^ PS5_tile_block_y[by % bh]);
+}
+
+static SDL_INLINE size_t PS5_TilePixelOffset(int x, int y, int width)
+{
+    return PS5_TileBlockOffset(x >> PS5_BLOCK_SHIFT, y >> PS5_BLOCK_SHIFT, width) +
+           (x & 3) + ((y & 7) << 2) + ((x & 4) << 3);
+}
+
+/* Convert 'n' pixels of a source row to the scan-out format */
+static void PS5_ConvertPixels(const PS5_TileJob *job, const Uint8 *src,
+                              Uint32 *dst, int n)
+{
+    switch (job->format) {
+    case SDL_PIXELFORMAT_ARGB8888:
+    case SDL_PIXELFORMAT_XRGB8888: {
+        const Uint32 *row = (const Uint32 *)src;
+        const Uint32 alpha = (job->format == SDL_PIXELFORMAT_XRGB8888) ? 0xFF000000 : 0;
+
+        for (int x = 0; x < n; x++) {
+            const Uint32 p = row[x];
+
+            dst[x] = (p & 0xFF00FF00) | ((p >> 16) & 0xFF) | ((p & 0xFF) << 16) | alpha;
+        }
+        break;
+    }
+    case SDL_PIXELFORMAT_RGB565: {
+        const Uint16 *row = (const Uint16 *)src;
+
+        /* Channels are expanded like SDL_GetRGB does, to v * 255 / 31 and
+           v * 255 / 63 rounded down, without dividing */
+        for (int x = 0; x < n; x++) {
+            const Uint32 p = row[x];
+            const Uint32 r = (((p >> 11) & 0x1F) * 1053) >> 7;
+            const Uint32 g = (((p >> 5) & 0x3F) * 259 + 3) >> 6;
+            const Uint32 b = ((p & 0x1F) * 1053) >> 7;
+
+            dst[x] = 0xFF000000 | (b << 16) | (g << 8) | r;
+        }
+        break;
+    }
+    case SDL_PIXELFORMAT_INDEX8: {
+        const Uint32 *palette = job->palette;
+
+        for (int x = 0; x < n; x++) {
+            dst[x] = palette[src[x]];
+        }
+        break;
+    }
+    default:
+        SDL_memcpy(dst, src, n * sizeof(Uint32));
+        break;
+    }
+}
+
+/* Draw the pixels of a rectangle one by one, for the parts of the frame
+   that don't cover a whole micro-block. 'src' points to row 'y0'. */
+static void PS5_DrawPixels(const PS5_TileJob *job, const Uint8 *src,
+                           int x0, int y0, int x1, int y1)
+{
+    const int bpp = SDL_BYTESPERPIXEL(job->format);
+    Uint32 pixels[PS5_BLOCK_SIZE];
+
+    for (int y = y0; y < y1; y++) {
+        const Uint8 *row = src + (size_t)(y - y0) * job->src_pitch;
+
+        for (int x = x0; x < x1; x += PS5_BLOCK_SIZE) {
+            const int n = SDL_min(PS5_BLOCK_SIZE, x1 - x);
+
+            PS5_ConvertPixels(job, row + x * bpp, pixels, n);
+            for (int i = 0; i < n; i++) {
+                job->dst[PS5_TilePixelOffset(x + i, y, job->width)] = pixels[i];
+            }
+        }
+    }
+}
+
+static void PS5_DrawBand_Scalar(const PS5_TileJob *job, const Uint8 *src,
+                                int by, int bx0, int bx1)
+{
+    for (int bx = bx0; bx < bx1; bx++) {
+        Uint32 *dst = job->dst + PS5_TileBlockOffset(bx, by, job->width);
+
+        for (int r = 0; r < PS5_BLOCK_SIZE; r++) {
+            const Uint32 *row = (const Uint32 *)(src + r * job->src_pitch) +
+                                bx * PS5_BLOCK_SIZE;
+
+            SDL_memcpy(dst + r * 4, row, 4 * sizeof(Uint32));
+            SDL_memcpy(dst + 32 + r * 4, row + 4, 4 * sizeof(Uint32));
+        }
+    }
+}
+
+/* Same for sources in another format, each row of a micro-block is
+   converted on its way to the scan-out buffer */
+static void PS5_DrawBand_Convert(const PS5_TileJob *job, const Uint8 *src,
+                                 int by, int bx0, int bx1)
+{
+    const int bpp = SDL_BYTESPERPIXEL(job->format);
+    Uint32 pixels[PS5_BLOCK_SIZE];
+
+    for (int bx = bx0; bx < bx1; bx++) {
+        Uint32 *dst = job->dst + PS5_TileBlockOffset(bx, by, job->width);
+
+        for (int r = 0; r < PS5_BLOCK_SIZE; r++) {
+            PS5_ConvertPixels(job, src + r * job->src_pitch + bx * PS5_BLOCK_SIZE * bpp,
+                              pixels, PS5_BLOCK_SIZE);
+            SDL_memcpy(dst + r * 4, pixels, 4 * sizeof(Uint32));
+            SDL_memcpy(dst + 32 + r * 4, pixels + 4, 4 * sizeof(Uint32));
+        }
+    }
+}
+
+#ifdef HAVE_SSE2_INTRINSICS
+static void PS5_DrawBand_SSE2(const PS5_TileJob *job, const Uint8 *src,
+                              int by, int bx0, int bx1)
+{
+    for (int bx = bx0; bx < bx1; bx++) {
+        __m128i *dst = (__m128i *)(job->dst + PS5_TileBlockOffset(bx, by, job->width));
+
+        for (int r = 0; r < PS5_BLOCK_SIZE; r++) {
+            const __m128i *row = (const __m128i *)((const Uint32 *)(src + r * job->src_pitch) +
+                                                   bx * PS5_BLOCK_SIZE);
+
+            _mm_storeu_si128(dst + r, _mm_loadu_si128(row));
+            _mm_storeu_si128(dst + 8 + r, _mm_loadu_si128(row + 1));
+        }
+    }
+}
+
+/* Swap the red and blue channels of 4 ARGB8888 pixels */
+static SDL_INLINE __m128i PS5_SwapRB_SSE2(__m128i p, __m128i alpha)
+{
+    const __m128i ag = _mm_set1_epi32((int)0xFF00FF00);
+    __m128i rb = _mm_andnot_si128(ag, p);
+
+    rb = _mm_shufflehi_epi16(_mm_shufflelo_epi16(rb, 0xB1), 0xB1);
+    return _mm_or_si128(_mm_or_si128(_mm_and_si128(p, ag), rb), alpha);
+}
+
+static void PS5_DrawBandARGB_SSE2(const PS5_TileJob *job, const Uint8 *src,
+                                  int by, int bx0, int bx1)
+{
+    const __m128i alpha = _mm_set1_epi32(job->format == SDL_PIXELFORMAT_XRGB8888 ?
+                                         (int)0xFF000000 : 0);
+
+    for (int bx = bx0; bx < bx1; bx++) {
+        __m128i *dst = (__m128i *)(job->dst + PS5_TileBlockOffset(bx, by, job->width));
+
+        for (int r = 0; r < PS5_BLOCK_SIZE; r++) {
+            const __m128i *row = (const __m128i *)((const Uint32 *)(src + r * job->src_pitch) +
+                                                   bx * PS5_BLOCK_SIZE);
+
+            _mm_storeu_si128(dst + r, PS5_SwapRB_SSE2(_mm_loadu_si128(row), alpha));
+            _mm_storeu_si128(dst + 8 + r, PS5_SwapRB_SSE2(_mm_loadu_si128(row + 1), alpha));
+        }
+    }
+}
+
+/* Palette lookups don't vectorize, but are gathered so that the scan-out
+   buffer still sees full 16 byte stores */
+static void PS5_DrawBandIndex8_SSE2(const PS5_TileJob *job, const Uint8 *src,
+                                    int by, int bx0, int bx1)
+{
+    const Uint32 *palette = job->palette;
+
+    for (int bx = bx0; bx < bx1; bx++) {
+        __m128i *dst = (__m128i *)(job->dst + PS5_TileBlockOffset(bx, by, job->width));
+
+        for (int r = 0; r < PS5_BLOCK_SIZE; r++) {
+            const Uint8 *row = src + r * job->src_pitch + bx * PS5_BLOCK_SIZE;
+
+            _mm_storeu_si128(dst + r, _mm_setr_epi32(palette[row[0]], palette[row[1]],
+                                                     palette[row[2]], palette[row[3]]));
+            _mm_storeu_si128(dst + 8 + r, _mm_setr_epi32(palette[row[4]], palette[row[5]],
+                                                         palette[row[6]], palette[row[7]]));
+        }
+    }
+}
+
+/* A micro-block row of RGB565 is a single load, expanded in 16 bit lanes
+   like PS5_ConvertPixels does, then interleaved into the left and right
+   halves of the row */
+static void PS5_DrawBand565_SSE2(const PS5_TileJob *job, const Uint8 *src,
+                                 int by, int bx0, int bx1)
+{
+    const __m128i mask5 = _mm_set1_epi16(0x1F);
+    const __m128i mask6 = _mm_set1_epi16(0x3F);
+    const __m128i mul5 = _mm_set1_epi16(1053);
+    const __m128i mul6 = _mm_set1_epi16(259);
+    const __m128i round6 = _mm_set1_epi16(3);
+    const __m128i alpha = _mm_set1_epi16((short)0xFF00);
+
+    for (int bx = bx0; bx < bx1; bx++) {
+        __m128i *dst = (__m128i *)(job->dst + PS5_TileBlockOffset(bx, by, job->width));
+
+        for (int r = 0; r < PS5_BLOCK_SIZE; r++) {
+            const __m128i p = _mm_loadu_si128((const __m128i *)((const Uint16 *)(src + r * job->src_pitch) +
+                                                                bx * PS5_BLOCK_SIZE));
+            const __m128i red = _mm_srli_epi16(_mm_mullo_epi16(_mm_srli_epi16(p, 11), mul5), 7);
+            const __m128i green = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(_mm_and_si128(_mm_srli_epi16(p, 5), mask6), mul6),
+                                                               round6), 6);
+            const __m128i blue = _mm_srli_epi16(_mm_mullo_epi16(_mm_and_si128(p, mask5), mul5), 7);
+            const __m128i rg = _mm_or_si128(red, _mm_slli_epi16(green, 8));
+            const __m128i ba = _mm_or_si128(blue, alpha);
+
+            _mm_storeu_si128(dst + r, _mm_unpacklo_epi16(rg, ba));
+            _mm_storeu_si128(dst + 8 + r, _mm_unpackhi_epi16(rg, ba));
+        }
+    }
+}
+#endif
+
+#ifdef HAVE_AVX2_INTRINSICS
+/* Two vertically adjacent 4 pixel runs are contiguous in the tiled layout,
+   so each pair of source rows turns into two 32 byte stores. */
+static void PS5_TARGET_AVX2 PS5_DrawBand_AVX2(const PS5_TileJob *job,
+                                               const Uint8 *src, int by,
+                                               int bx0, int bx1)
+{
+    for (int bx = bx0; bx < bx1; bx++) {
+        __m256i *dst = (__m256i *)(job->dst + PS5_TileBlockOffset(bx, by, job->width));
+
+        for (int r = 0; r < PS5_BLOCK_SIZE; r += 2) {
+            const __m256i *row0 = (const __m256i *)((const Uint32 *)(src + r * job->src_pitch) +
+                                                    bx * PS5_BLOCK_SIZE);
+            const __m256i *row1 = (const __m256i *)((const Uint32 *)(src + (r + 1) * job->src_pitch) +
+                                                    bx * PS5_BLOCK_SIZE);
+            __m256i a = _mm256_loadu_si256(row0);
+            __m256i b = _mm256_loadu_si256(row1);
+
+            _mm256_storeu_si256(dst + r / 2, _mm256_permute2x128_si256(a, b, 0x20));
+            _mm256_storeu_si256(dst + 4 + r / 2, _mm256_permute2x128_si256(a, b, 0x31));
+        }
+    }
+}
+#endif
+
+/* Kernel for sources in 'format' */
+static PS5_DrawBandFunc PS5_GetDrawBandFunc(Uint32 format)
+{
+    if (!PS5_IsNativeFormat(format)) {
+#ifdef HAVE_SSE2_INTRINSICS
+        if (SDL_HasSSE2() && format == SDL_PIXELFORMAT_INDEX8) {
+            return PS5_DrawBandIndex8_SSE2;
+        }
+        if (SDL_HasSSE2() && format == SDL_PIXELFORMAT_RGB565) {
+            return PS5_DrawBand565_SSE2;
+        }
+        if (SDL_HasSSE2() && (format == SDL_PIXELFORMAT_ARGB8888 ||
+                              format == SDL_PIXELFORMAT_XRGB8888)) {
+            return PS5_DrawBandARGB_SSE2;
+        }
+#endif
+        return PS5_DrawBand_Convert;
+    }
+#ifdef HAVE_AVX2_INTRINSICS
+    if (SDL_HasAVX2()) {
+        return PS5_DrawBand_AVX2;
+    }
+#endif
+#ifdef HAVE_SSE2_INTRINSICS
+    if (SDL_HasSSE2()) {
+        return PS5_DrawBand_SSE2;
+    }
+#endif
+    return PS5_DrawBand_Scalar;
+}
+
+/* Draw the micro-blocks [bx0, bx1) of band 'by', including the pixels on the
+   right and bottom edges that don't fill a whole micro-block. 'src' points
+   to the first source row of the band. */
+static void PS5_DrawBlocks(const PS5_TileJob *job, PS5_DrawBandFunc draw_band,
+                           const Uint8 *src, int by, int bx0, int bx1)
+{
+    const int nbx = job->width >> PS5_BLOCK_SHIFT;
+    const int x0 = bx0 << PS5_BLOCK_SHIFT;
+    const int x1 = SDL_min(bx1 << PS5_BLOCK_SHIFT, job->width);
+    const int y0 = by << PS5_BLOCK_SHIFT;
+    const int y1 = SDL_min(y0 + PS5_BLOCK_SIZE, job->height);
+
+    if (y1 - y0 < PS5_BLOCK_SIZE) {
+        PS5_DrawPixels(job, src, x0, y0, x1, y1);
+        return;
+    }
+
+    if (bx0 < SDL_min(bx1, nbx)) {
+        draw_band(job, src, by, bx0, SDL_min(bx1, nbx));
+    }
+    if (bx1 > nbx) {
+        PS5_DrawPixels(job, src, SDL_max(x0, nbx << PS5_BLOCK_SHIFT), y0, x1, y1);
+    }
+}
+
+/* Source row 'sy' in the scan-out format, valid at least for the columns
+   [sx0, sx1]. Rows that need converting are converted into 'convert'. */
+static const Uint32 *PS5_GetSourceRow(const PS5_TileJob *job, int sy,
+                                      Uint32 *convert, int sx0, int sx1)
+{
+    const Uint8 *row = (const Uint8 *)job->src + (size_t)sy * job->src_pitch;
+
+    if (PS5_IsNativeFormat(job->format)) {
+        return (const Uint32 *)row;
+    }
+    if (sx0 <= sx1) {
+        PS5_ConvertPixels(job, row + sx0 * SDL_BYTESPERPIXEL(job->format),
+                          convert + sx0, sx1 - sx0 + 1);
+    }
+    return convert;
+}
+
+/* Swizzle band 'by' from the rows prepared in 'lines' */
+static void PS5_DrawLines(const PS5_TileJob *job, PS5_DrawBandFunc draw_band,
+                          const Uint32 *lines, int by, int bx0, int bx1)
+{
+    PS5_TileJob band = *job;
+
+    band.src = lines;
+    band.src_pitch = job->width * sizeof(Uint32);
+    band.format = SDL_PIXELFORMAT_ABGR8888;
+    band.scale = NULL;
+    PS5_DrawBlocks(&band, draw_band, (const Uint8 *)lines, by, bx0, bx1);
+}
+
+/* Blend two pixels, two channels at a time, with 'f' out of 256 of 'b' */
+static SDL_INLINE Uint32 PS5_Lerp(Uint32 a, Uint32 b, Uint32 f)
+{
+    const Uint32 rb = (((a & 0xFF00FF) * (256 - f) +
+                        (b & 0xFF00FF) * f) >> 8) & 0xFF00FF;
+    const Uint32 ag = (((a >> 8) & 0xFF00FF) * (256 - f) +
+                       ((b >> 8) & 0xFF00FF) * f) & 0xFF00FF00;
+
+    return rb | ag;
+}
+
+static void PS5_ScaleRowNearest(const PS5_TileScale *scale, const Uint32 *src,
+                                Uint32 *dst, int x0, int x1)
+{
+    for (int x = x0; x < x1; x++) {
+        const Sint32 sx = scale->x_map[x];
+
+        dst[x] = sx >= 0 ? src[sx] : 0;
+    }
+}
+
+static void PS5_ScaleRowLinear(const PS5_TileScale *scale, const Uint32 *src,
+                               Uint32 *dst, int x0, int x1)
+{
+    for (int x = x0; x < x1; x++) {
+        const Sint32 sx = scale->x_map[x];
+
+        dst[x] = sx >= 0 ? PS5_Lerp(src[sx], src[scale->x_next[x]],
+                                    scale->x_frac[x]) : 0;
+    }
+}
+
+/* Draw the micro-blocks [bx0, bx1) of band 'by' from a scaled source. The
+   rows of the band are resampled into 'lines', which stays in cache, and
+   swizzled from there by the regular kernels, so every pixel of the
+   scan-out buffer is still written once. */
+static void PS5_DrawScaledBlocks(const PS5_TileJob *job, PS5_DrawBandFunc draw_band,
+                                 Uint32 *lines, int by, int bx0, int bx1)
+{
+    const PS5_TileScale *scale = job->scale;
+    const int x0 = bx0 << PS5_BLOCK_SHIFT;
+    const int x1 = SDL_min(bx1 << PS5_BLOCK_SHIFT, job->width);
+    const int y0 = by << PS5_BLOCK_SHIFT;
+    const int rows = SDL_min(PS5_BLOCK_SIZE, job->height - y0);
+    Uint32 *filtered[2];
+    Sint32 filtered_row[2] = { -1, -1 };
+    Uint32 *convert = lines + PS5_SCALE_LINES * job->width;
+    int first = x0, last = x1 - 1;
+    int sx0 = 0, sx1 = -1;
+
+    filtered[0] = lines + PS5_BLOCK_SIZE * job->width;
+    filtered[1] = filtered[0] + job->width;
+
+    /* Source columns the run samples, the maps only ever go forward */
+    while (first <= last && scale->x_map[first] < 0) {
+        first++;
+    }
+    while (last >= first && scale->x_map[last] < 0) {
+        last--;
+    }
+    if (first <= last) {
+        sx0 = scale->x_map[first];
+        sx1 = scale->x_next[last];
+    }
+
+    for (int r = 0; r < rows; r++) {
+        const int y = y0 + r;
+        const Sint32 sy = scale->y_map[y];
+        const Sint32 sy1 = scale->y_next[y];
+        Uint32 *line = lines + r * job->width;
+        Uint32 *top, *bottom;
+
+        if (sy < 0) {
+            SDL_memset(line + x0, 0, (x1 - x0) * sizeof(Uint32));
+            continue;
+        }
+
+        /* Upscaling repeats rows */
+        if (r > 0 && sy == scale->y_map[y - 1] && sy1 == scale->y_next[y - 1] &&
+            scale->y_frac[y] == scale->y_frac[y - 1]) {
+            SDL_memcpy(line + x0, line - job->width + x0, (x1 - x0) * sizeof(Uint32));
+            continue;
+        }
+
+        if (scale->mode != PS5_TILE_SCALE_LINEAR) {
+            PS5_ScaleRowNearest(scale, PS5_GetSourceRow(job, sy, convert, sx0, sx1),
+                                line, x0, x1);
+            continue;
+        }
+
+        /* Consecutive rows mostly blend the same two source rows, so keep
+           them filtered horizontally */
+        for (int k = 0; k < 2; k++) {
+            const Sint32 want = k ? sy1 : sy;
+            int slot;
+
+            if (filtered_row[0] == want || filtered_row[1] == want) {
+                continue;
+            }
+            slot = (filtered_row[0] == sy || filtered_row[0] == sy1) ? 1 : 0;
+            PS5_ScaleRowLinear(scale, PS5_GetSourceRow(job, want, convert, sx0, sx1),
+                               filtered[slot], x0, x1);
+            filtered_row[slot] = want;
+        }
+        top = filtered[filtered_row[0] == sy ? 0 : 1];
+        bottom = filtered[filtered_row[0] == sy1 ? 0 : 1];
+        for (int x = x0; x < x1; x++) {
+            line[x] = PS5_Lerp(top[x], bottom[x], scale->y_frac[y]);
+        }
+    }
+
+    PS5_DrawLines(job, draw_band, lines, by, bx0, bx1);
+}
+
+/* Scratch space each thread needs for 'job', in pixels */
+static size_t PS5_GetScratchSize(const PS5_TileJob *job)
+{
+    size_t size = 0;
+
+    if (job->scale) {
+        size = (size_t)PS5_SCALE_LINES * job->width;
+        if (!PS5_IsNativeFormat(job->format)) {
+            size += job->scale->src_width;
+        }
+    }
+
+    return size;
+}
+
+static void PS5_DrawRun(const PS5_TileJob *job, PS5_DrawBandFunc draw_band,
+                        Uint32 *scratch, int by, int bx0, int bx1)
+{
+    if (job->scale) {
+        PS5_DrawScaledBlocks(job, draw_band, scratch, by, bx0, bx1);
+    } else {
+        PS5_DrawBlocks(job, draw_band,
+                       (const Uint8 *)job->src + (size_t)by * PS5_BLOCK_SIZE * job->src_pitch,
+                       by, bx0, bx1);
+    }
+}
+
+static void PS5_DrawSlice(const PS5_TileJob *job, PS5_DrawBandFunc draw_band,
+                          Uint32 *scratch, int slice, int num_slices)
+{
+    const int num_bands = (job->height + PS5_BLOCK_SIZE - 1) >> PS5_BLOCK_SHIFT;
+    const int num_blocks = (job->width + PS5_BLOCK_SIZE - 1) >> PS5_BLOCK_SHIFT;
+    const int cols = PS5_TILE_CELL_COLS(job->width);
+    const int blocks_per_cell = PS5_TILE_CELL_SIZE / PS5_BLOCK_SIZE;
+    int by0 = (int)((Sint64)num_bands * slice / num_slices);
+    int by1 = (int)((Sint64)num_bands * (slice + 1) / num_slices);
+
+    for (int by = by0; by < by1; by++) {
+        const Uint8 *cells;
+        int cx = 0;
+
+        if (!job->cells) {
+            PS5_DrawRun(job, draw_band, scratch, by, 0, num_blocks);
+            continue;
+        }
+
+        /* Draw each run of consecutive stale cells in one go */
+        cells = job->cells + (by / blocks_per_cell) * cols;
+        while (cx < cols) {
+            int start;
+
+            if (!cells[cx]) {
+                cx++;
+                continue;
+            }
+            start = cx;
+            while (cx < cols && cells[cx]) {
+                cx++;
+            }
+            PS5_DrawRun(job, draw_band, scratch, by, start * blocks_per_cell,
+                        SDL_min(cx * blocks_per_cell, num_blocks));
+        }
+    }
+}
+
+static int SDLCALL PS5_TileWorkerMain(void *data)
+{
+    PS5_TileWorker *worker = (PS5_TileWorker *)data;
+    PS5_TilePool *pool = worker->pool;
+
+    PS5_PinCurrentThread(worker->core);
+
+    for (;;) {
+        SDL_SemWait(worker->wake);
+        if (SDL_AtomicGet(&pool->quit)) {
+            break;
+        }
+        PS5_DrawSlice(pool->job, pool->draw_band,
+                      pool->scratch + (size_t)worker->index * pool->scratch_size,
+                      worker->index, pool->num_threads);
+        SDL_SemPost(pool->done);
+    }
+
+    return 0;
+}
+
+PS5_TilePool *PS5_CreateTilePool(int num_threads)
+{
+    PS5_TilePool *pool;
+    int num_cpus = SDL_GetCPUCount();
+
+    num_threads = SDL_clamp(num_threads, 1, PS5_TILE_THREAD_COUNT);
+
+    pool = (PS5_TilePool *)SDL_calloc(1, sizeof(*pool));
+    if (!pool) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+
+    pool->num_threads = 1;
+    pool->done = SDL_CreateSemaphore(0);
+    if (!pool->done) {
+        SDL_free(pool);
+        return NULL;
+    }
+
+    /* The calling thread draws slice 0, worker i draws slice i + 1 */
+    for (int i = 0; i < num_threads - 1; i++) {
+        PS5_TileWorker *worker = &pool->workers[i];
+        char name[32];
+
+        worker->pool = pool;
+        worker->index = i + 1;
+        worker->core = (i + 1) % SDL_max(num_cpus, 1);
+        worker->wake = SDL_CreateSemaphore(0);
+        if (!worker->wake) {
+            break;
+        }
+
+        SDL_snprintf(name, sizeof(name), "SDLPS5Tile%d", i);
+        worker->thread = SDL_CreateThread(PS5_TileWorkerMain, name, worker);
+        if (!worker->thread) {
+            SDL_DestroySemaphore(worker->wake);
+            worker->wake = NULL;
+            break;
+        }
+
+        pool->num_workers++;
+        pool->num_threads++;
+    }
+
+    return pool;
+}
+
+void PS5_DestroyTilePool(PS5_TilePool *pool)
+{
+    if (!pool) {
+        return;
+    }
+
+    SDL_AtomicSet(&pool->quit, 1);
+    for (int i = 0; i < pool->num_workers; i++) {
+        SDL_SemPost(pool->workers[i].wake);
+    }
+    for (int i = 0; i < pool->num_workers; i++) {
+        SDL_WaitThread(pool->workers[i].thread, NULL);
+        SDL_DestroySemaphore(pool->workers[i].wake);
+    }
+
+    SDL_DestroySemaphore(pool->done);
+    SDL_free(pool->scratch);
+    SDL_free(pool);
+}
+
+static int PS5_DrawTilesWith(PS5_TilePool *pool, const PS5_TileJob *job,
+                             PS5_DrawBandFunc draw_band)
+{
+    const size_t scratch_size = PS5_GetScratchSize(job);
+    Uint32 *scratch = NULL;
+
+    if (!pool) {
+        if (scratch_size > 0) {
+            scratch = (Uint32 *)SDL_malloc(scratch_size * sizeof(Uint32));
+            if (!scratch) {
+                return SDL_OutOfMemory();
+            }
+        }
+        PS5_DrawSlice(job, draw_band, scratch, 0, 1);
+        SDL_free(scratch);
+        return 0;
+    }
+
+    if (scratch_size > pool->scratch_size) {
+        scratch = (Uint32 *)SDL_realloc(pool->scratch, (size_t)pool->num_threads *
+                                        scratch_size * sizeof(Uint32));
+        if (!scratch) {
+            return SDL_OutOfMemory();
+        }
+        pool->scratch = scratch;
+        pool->scratch_size = scratch_size;
+    }
+
+    if (pool->num_workers == 0) {
+        PS5_DrawSlice(job, draw_band, pool->scratch, 0, 1);
+        return 0;
+    }
+
+    pool->job = job;
+    pool->draw_band = draw_band;
+    for (int i = 0; i < pool->num_workers; i++) {
+        SDL_SemPost(pool->workers[i].wake);
+    }
+
+    PS5_DrawSlice(job, draw_band, pool->scratch, 0, pool->num_threads);
+
+    for (int i = 0; i < pool->num_workers; i++) {
+        SDL_SemWait(pool->done);
+    }
+    pool->job = NULL;
+
+    return 0;
+}
+
+int PS5_DrawTiles(PS5_TilePool *pool, const PS5_TileJob *job)
+{
+    /* Scaled frames are converted before they are resampled, the kernel
+       then reads lines that are already in the scan-out format */
+    const Uint32 format = job->scale ? SDL_PIXELFORMAT_ABGR8888 : job->format;
+
+    return PS5_DrawTilesWith(pool, job, PS5_GetDrawBandFunc(format));
+}
+
+SDL_bool PS5_IsTileFormatSupported(Uint32 format)
+{
+    switch (format) {
+    case SDL_PIXELFORMAT_ABGR8888:
+    case SDL_PIXELFORMAT_XBGR8888:
+    case SDL_PIXELFORMAT_ARGB8888:
+    case SDL_PIXELFORMAT_XRGB8888:
+    case SDL_PIXELFORMAT_RGB565:
+    case SDL_PIXELFORMAT_INDEX8:
+        return SDL_TRUE;
+    default:
+        return SDL_FALSE;
+    }
+}
+
+/* A row of a micro-block is split in two halves of four pixels, which are
+   the longest runs of a tiled row that are contiguous in memory */
+void PS5_ReadTileSpan(const Uint32 *tiled, int width, int x, int y,
+                      Uint32 *pixels, int count)
+{
+    while (count > 0) {
+        const int n = SDL_min(4 - (x & 3), count);
+
+        SDL_memcpy(pixels, tiled + PS5_TilePixelOffset(x, y, width),
+                   n * sizeof(Uint32));
+        pixels += n;
+        x += n;
+        count -= n;
+    }
+}
+
+void PS5_WriteTileSpan(Uint32 *tiled, int width, int x, int y,
+                       const Uint32 *pixels, int count)
+{
+    while (count > 0) {
+        const int n = SDL_min(4 - (x & 3), count);
+
+        SDL_memcpy(tiled + PS5_TilePixelOffset(x, y, width), pixels,
+                   n * sizeof(Uint32));
+        pixels += n;
+        x += n;
+        count -= n;
+    }
+}
+
+static void PS5_FillTilePixels(Uint32 *tiled, int width, int x0, int y0,
+                               int x1, int y1, Uint32 color)
+{
+    for (int y = y0; y < y1; y++) {
+        for (int x = x0; x < x1; x++) {
+            tiled[PS5_TilePixelOffset(x, y, width)] = color;
+        }
+    }
+}
+
+void PS5_FillTileRect(Uint32 *tiled, int width, const SDL_Rect *rect,
+                      Uint32 color)
+{
+    const int x0 = rect->x, y0 = rect->y;
+    const int x1 = rect->x + rect->w, y1 = rect->y + rect->h;
+    /* Micro-blocks covered in full, each is 64 contiguous pixels */
+    const int bx0 = (x0 + PS5_BLOCK_SIZE - 1) >> PS5_BLOCK_SHIFT;
+    const int by0 = (y0 + PS5_BLOCK_SIZE - 1) >> PS5_BLOCK_SHIFT;
+    const int bx1 = x1 >> PS5_BLOCK_SHIFT;
+    const int by1 = y1 >> PS5_BLOCK_SHIFT;
+
+    if (rect->w <= 0 || rect->h <= 0) {
+        return;
+    }
+    if (bx0 >= bx1 || by0 >= by1) {
+        PS5_FillTilePixels(tiled, width, x0, y0, x1, y1, color);
+        return;
+    }
+
+    for (int by = by0; by < by1; by++) {
+        for (int bx = bx0; bx < bx1; bx++) {
+            Uint32 *dst = tiled + PS5_TileBlockOffset(bx, by, width);
+
+            for (int i = 0; i < PS5_BLOCK_SIZE * PS5_BLOCK_SIZE; i++) {
+                dst[i] = color;
+            }
+        }
+    }
+
+    /* The partial blocks around them */
+    PS5_FillTilePixels(tiled, width, x0, y0, x1, by0 << PS5_BLOCK_SHIFT, color);
+    PS5_FillTilePixels(tiled, width, x0, by1 << PS5_BLOCK_SHIFT, x1, y1, color);
+    PS5_FillTilePixels(tiled, width, x0, by0 << PS5_BLOCK_SHIFT,
+                       bx0 << PS5_BLOCK_SHIFT, by1 << PS5_BLOCK_SHIFT, color);
+    PS5_FillTilePixels(tiled, width, bx1 << PS5_BLOCK_SHIFT, by0 << PS5_BLOCK_SHIFT,
+                       x1, by1 << PS5_BLOCK_SHIFT, color);
+}
+
+/* Fill the map of one axis. Linear sampling happens at pixel centers, in
+   16.16 fixed point. */
+static void PS5_InitScaleMap(Sint32 *map, Sint32 *next, Uint8 *frac, int size,
+                             int offset, int length, int src_size,
+                             SDL_bool linear)
+{
+    for (int i = 0; i < size; i++) {
+        const int d = i - offset;
+        Sint64 pos;
+
+        if (d < 0 || d >= length) {
+            map[i] = next[i] = -1;
+            frac[i] = 0;
+        } else if (!linear) {
+            map[i] = next[i] = (Sint32)((Sint64)d * src_size / length);
+            frac[i] = 0;
+        } else {
+            pos = (Sint64)(2 * d + 1) * src_size * 65536 / (2 * length) - 32768;
+            pos = SDL_max(pos, 0);
+            map[i] = (Sint32)(pos >> 16);
+            next[i] = SDL_min(map[i] + 1, src_size - 1);
+            frac[i] = (Uint8)(pos >> 8);
+        }
+    }
+}
+
+int PS5_InitTileScale(PS5_TileScale *scale, PS5_TileScaleMode mode,
+                      int src_width, int src_height, int width, int height)
+{
+    SDL_Rect *rect = &scale->rect;
+    const SDL_bool linear = (mode == PS5_TILE_SCALE_LINEAR);
+    int factor;
+
+    PS5_FreeTileScale(scale);
+
+    if (src_width <= 0 || src_height <= 0 || width <= 0 || height <= 0) {
+        return SDL_InvalidParamError("size");
+    }
+
+    scale->mode = mode;
+    scale->src_width = src_width;
+    scale->src_height = src_height;
+
+    factor = SDL_min(width / src_width, height / src_height);
+    if (mode == PS5_TILE_SCALE_INTEGER && factor > 0) {
+        rect->w = src_width * factor;
+        rect->h = src_height * factor;
+    } else if ((Sint64)src_width * height > (Sint64)src_height * width) {
+        rect->w = width;
+        rect->h = (int)((Sint64)src_height * width / src_width);
+    } else {
+        rect->w = (int)((Sint64)src_width * height / src_height);
+        rect->h = height;
+    }
+    rect->x = (width - rect->w) / 2;
+    rect->y = (height - rect->h) / 2;
+
+    scale->x_map = (Sint32 *)SDL_malloc(width * sizeof(Sint32));
+    scale->x_next = (Sint32 *)SDL_malloc(width * sizeof(Sint32));
+    scale->x_frac = (Uint8 *)SDL_malloc(width);
+    scale->y_map = (Sint32 *)SDL_malloc(height * sizeof(Sint32));
+    scale->y_next = (Sint32 *)SDL_malloc(height * sizeof(Sint32));
+    scale->y_frac = (Uint8 *)SDL_malloc(height);
+    if (!scale->x_map || !scale->x_next || !scale->x_frac ||
+        !scale->y_map || !scale->y_next || !scale->y_frac) {
+        PS5_FreeTileScale(scale);
+        return SDL_OutOfMemory();
+    }
+
+    PS5_InitScaleMap(scale->x_map, scale->x_next, scale->x_frac, width,
+                     rect->x, rect->w, src_width, linear);
+    PS5_InitScaleMap(scale->y_map, scale->y_next, scale->y_frac, height,
+                     rect->y, rect->h, src_height, linear);
+
+    return 0;
+}
+
+void PS5_FreeTileScale(PS5_TileScale *scale)
+{
+    SDL_free(scale->x_map);
+    SDL_free(scale->x_next);
+    SDL_free(scale->x_frac);
+    SDL_free(scale->y_map);
+    SDL_free(scale->y_next);
+    SDL_free(scale->y_frac);
+    SDL_zerop(scale);
+}
+
+void PS5_ScaleTileRect(const PS5_TileScale *scale, const SDL_Rect *src,
+                       SDL_Rect *dst)
+{
+    const SDL_Rect *rect = &scale->rect;
+    Sint64 x0 = src->x, y0 = src->y;
+    Sint64 x1 = (Sint64)src->x + src->w, y1 = (Sint64)src->y + src->h;
+
+    /* Filtered pixels also depend on their neighbors */
+    if (scale->mode == PS5_TILE_SCALE_LINEAR) {
+        x0--;
+        y0--;
+        x1++;
+        y1++;
+    }
+    x0 = SDL_clamp(x0, 0, scale->src_width);
+    y0 = SDL_clamp(y0, 0, scale->src_height);
+    x1 = SDL_clamp(x1, 0, scale->src_width);
+    y1 = SDL_clamp(y1, 0, scale->src_height);
+
+    x0 = x0 * rect->w / scale->src_width;
+    y0 = y0 * rect->h / scale->src_height;
+    x1 = (x1 * rect->w + scale->src_width - 1) / scale->src_width;
+    y1 = (y1 * rect->h + scale->src_height - 1) / scale->src_height;
+
+    dst->x = rect->x + (int)x0;
+    dst->y = rect->y + (int)y0;
+    dst->w = (int)(x1 - x0);
+    dst->h = (int)(y1 - y0);
+}
+
+int PS5_InitTileDamage(PS5_TileDamage *damage, int width, int height,
+                       int num_buffers)
+{
+    size_t size;
+
+    PS5_FreeTileDamage(damage);
+
+    damage->cols = PS5_TILE_CELL_COLS(width);
+    damage->rows = PS5_TILE_CELL_ROWS(height);
+    damage->num_buffers = num_buffers;
+    size = (size_t)damage->cols * damage->rows;
+
+    damage->cells = (Uint8 *)SDL_malloc(size * num_buffers);
+    if (!damage->cells) {
+        SDL_zerop(damage);
+        return SDL_OutOfMemory();
+    }
+
+    /* Nothing has been drawn into any of the buffers yet */
+    SDL_memset(damage->cells, 1, size * num_buffers);
+
+    return 0;
+}
+
+void PS5_FreeTileDamage(PS5_TileDamage *damage)
+{
+    SDL_free(damage->cells);
+    SDL_zerop(damage);
+}
+
+void PS5_AddTileDamage(PS5_TileDamage *damage, const SDL_Rect *rects,
+                       int numrects)
+{
+    const size_t size = (size_t)damage->cols * damage->rows;
+
+    for (int i = 0; i < numrects; i++) {
+        int cx0 = SDL_max(rects[i].x, 0) / PS5_TILE_CELL_SIZE;
+        int cy0 = SDL_max(rects[i].y, 0) / PS5_TILE_CELL_SIZE;
+        int cx1, cy1;
+
+        if (rects[i].w <= 0 || rects[i].h <= 0) {
+            continue;
+        }
+        cx1 = (rects[i].x + rects[i].w + PS5_TILE_CELL_SIZE - 1) / PS5_TILE_CELL_SIZE;
+        cy1 = (rects[i].y + rects[i].h + PS5_TILE_CELL_SIZE - 1) / PS5_TILE_CELL_SIZE;
+        cx1 = SDL_min(cx1, damage->cols);
+        cy1 = SDL_min(cy1, damage->rows);
+
+        for (int b = 0; b < damage->num_buffers; b++) {
+            Uint8 *cells = damage->cells + b * size;
+
+            for (int cy = cy0; cy < cy1; cy++) {
+                if (cx0 < cx1) {
+                    SDL_memset(cells + cy * damage->cols + cx0, 1, cx1 - cx0);
+                }
+            }
+        }
+    }
+}
+
+const Uint8 *PS5_GetTileDamage(PS5_TileDamage *damage, int buffer)
+{
+    return damage->cells + (size_t)buffer * damage->cols * damage->rows;
+}
+
+void PS5_ClearTileDamage(PS5_TileDamage *damage, int buffer)
+{
+    const size_t size = (size_t)damage->cols * damage->rows;
+
+    SDL_memset(damage->cells + buffer * size, 0, size);
+}
+
+#endif /* SDL_VIDEO_DRIVER_PS5 || SDL_PS5_HOST_TEST */
+
+/* vi: set ts=4 sw=4 expandtab: */
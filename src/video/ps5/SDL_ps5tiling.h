@@ -0,0 +1,146 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../../SDL_internal.h"
+
+#ifndef SDL_ps5tiling_h_
+#define SDL_ps5tiling_h_
+
+/* The tiling code does not depend on any SCE library, so that it can be
+   built and benchmarked on the host (see test/testps5tiling.c). */
+
+#include "SDL_stdinc.h"
+#include "SDL_pixels.h"
+#include "SDL_rect.h"
+
+#define PS5_TILE_WIDTH  512
+#define PS5_TILE_HEIGHT 128
+#define PS5_TILE_SIZE   (PS5_TILE_WIDTH * PS5_TILE_HEIGHT)
+
+/* Granularity of partial updates, in pixels */
+#define PS5_TILE_CELL_SIZE 64
+#define PS5_TILE_CELL_COLS(w) (((w) + PS5_TILE_CELL_SIZE - 1) / PS5_TILE_CELL_SIZE)
+#define PS5_TILE_CELL_ROWS(h) (((h) + PS5_TILE_CELL_SIZE - 1) / PS5_TILE_CELL_SIZE)
+
+/* Total number of threads drawing a frame, including the calling thread */
+#define PS5_TILE_THREAD_COUNT 12
+
+typedef enum PS5_TileScaleMode
+{
+    PS5_TILE_SCALE_NEAREST, /* fit the display, keeping the aspect ratio */
+    PS5_TILE_SCALE_INTEGER, /* largest whole factor that fits */
+    PS5_TILE_SCALE_LINEAR   /* like NEAREST, with bilinear filtering */
+} PS5_TileScaleMode;
+
+/* Maps each pixel of the scan-out buffer to the source it is sampled
+   from, so that scaling happens in the same pass as the swizzle. Pixels
+   outside of 'rect' are black. */
+typedef struct PS5_TileScale
+{
+    PS5_TileScaleMode mode;
+    int src_width;
+    int src_height;
+    SDL_Rect rect; /* where the source lands in the scan-out buffer */
+    Sint32 *x_map; /* per column: first source column, -1 outside 'rect' */
+    Sint32 *x_next; /* LINEAR: second source column */
+    Uint8 *x_frac;  /* LINEAR: weight of the second column, out of 256 */
+    Sint32 *y_map;  /* same for rows */
+    Sint32 *y_next;
+    Uint8 *y_frac;
+} PS5_TileScale;
+
+typedef struct PS5_TileJob
+{
+    const void *src;
+    int src_pitch; /* in bytes */
+    Uint32 format; /* of the source, see PS5_IsTileFormatSupported */
+    const Uint32 *palette; /* INDEX8: the 256 colors in ABGR8888 */
+    Uint32 *dst;   /* tiled scan-out buffer */
+    int width;     /* of both the source and the scan-out buffer, unless */
+    int height;    /* the source is scaled */
+    const Uint8 *cells; /* cells to draw, see PS5_TileDamage, NULL for all */
+    const PS5_TileScale *scale; /* NULL to draw the source as is */
+} PS5_TileJob;
+
+/* Tracks, for each scan-out buffer, the cells that don't hold the latest
+   frame anymore. Only those have to be swizzled again when the buffer is
+   reused, everything else is still valid from an earlier frame. */
+typedef struct PS5_TileDamage
+{
+    int cols;
+    int rows;
+    int num_buffers;
+    Uint8 *cells; /* num_buffers * rows * cols, non-zero when stale */
+} PS5_TileDamage;
+
+typedef struct PS5_TilePool PS5_TilePool;
+
+/* Create a pool of persistent worker threads, each pinned to its own core.
+   'num_threads' includes the calling thread. */
+PS5_TilePool *PS5_CreateTilePool(int num_threads);
+void PS5_DestroyTilePool(PS5_TilePool *pool);
+
+/* Swizzle a linear frame into the tiled layout, splitting the work across
+   the pool. Blocks until the whole frame has been written. A NULL pool
+   draws everything on the calling thread. Returns -1 if there wasn't
+   enough memory for the scratch space of a scaled or converted frame. */
+int PS5_DrawTiles(PS5_TilePool *pool, const PS5_TileJob *job);
+
+/* Whether frames in 'format' can be drawn. The scan-out buffers are
+   ABGR8888, other formats are converted on the way. */
+SDL_bool PS5_IsTileFormatSupported(Uint32 format);
+
+/* Copy 'count' pixels of row 'y' of a tiled buffer, starting at column
+   'x', from or to a linear array */
+void PS5_ReadTileSpan(const Uint32 *tiled, int width, int x, int y,
+                      Uint32 *pixels, int count);
+void PS5_WriteTileSpan(Uint32 *tiled, int width, int x, int y,
+                       const Uint32 *pixels, int count);
+
+/* Set every pixel of 'rect' in a tiled buffer to 'color' */
+void PS5_FillTileRect(Uint32 *tiled, int width, const SDL_Rect *rect,
+                      Uint32 color);
+
+/* Prepare to scale a 'src_width' x 'src_height' source to a 'width' x
+   'height' scan-out buffer */
+int PS5_InitTileScale(PS5_TileScale *scale, PS5_TileScaleMode mode,
+                      int src_width, int src_height, int width, int height);
+void PS5_FreeTileScale(PS5_TileScale *scale);
+
+/* Area of the scan-out buffer affected by a change of the source in 'src' */
+void PS5_ScaleTileRect(const PS5_TileScale *scale, const SDL_Rect *src,
+                       SDL_Rect *dst);
+
+/* Start tracking damage with every buffer stale */
+int PS5_InitTileDamage(PS5_TileDamage *damage, int width, int height,
+                       int num_buffers);
+void PS5_FreeTileDamage(PS5_TileDamage *damage);
+
+/* Mark the cells covered by 'rects' stale in every buffer */
+void PS5_AddTileDamage(PS5_TileDamage *damage, const SDL_Rect *rects,
+                       int numrects);
+
+/* Cells to draw into 'buffer', clear them once they have been drawn */
+const Uint8 *PS5_GetTileDamage(PS5_TileDamage *damage, int buffer);
+void PS5_ClearTileDamage(PS5_TileDamage *damage, int buffer);
+
+#endif /* SDL_ps5tiling_h_ */
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -23,86 +23,139 @@
 
 #if SDL_VIDEO_DRIVER_PS5
 
-#include <errno.h>
-#include <pthread.h>
+#include "SDL_hints.h"
+#include "SDL_system.h"
 
-#include "SDL_ps5tilemap.inc"
 #include "SDL_ps5video.h"
 #include "SDL_ps5keyboard.h"
 
 #define PS5_SURFACE "_PS5_Surface"
 
-#define PS5_THREAD_COUNT 12
-
-
-static void* PS5_DrawTileThread(void* arg) {
-    const PS5_DrawChunk* chunk = (PS5_DrawChunk*)arg;
-
-    for (int ind = chunk->src_start; ind < chunk->src_end; ind++) {
-        int x = ind % chunk->frame_width;
-        int y = ind / chunk->frame_width;
-        int ty = y / PS5_TILE_HEIGHT;
-        int tx = x / PS5_TILE_WIDTH;
+/* Window surface formats, anything but ABGR8888 is converted while it is
+   swizzled into the scan-out buffer */
+static const Uint32 PS5_surface_formats[] = {
+    SDL_PIXELFORMAT_ABGR8888,
+    SDL_PIXELFORMAT_ARGB8888,
+    SDL_PIXELFORMAT_XRGB8888,
+    SDL_PIXELFORMAT_RGB565,
+    SDL_PIXELFORMAT_INDEX8,
+};
+
+void PS5_UpdateSwapInterval(PS5_DeviceData *device_data)
+{
+    int interval = device_data->swap_interval;
 
-        int t = (int)(PS5_TILE_SIZE * (tx + ty * ((double)chunk->frame_width /
-                                                  PS5_TILE_WIDTH)));
-        int i = PS5_tilemap[y % PS5_TILE_HEIGHT][x % PS5_TILE_WIDTH];
-        chunk->dst[t + i] = chunk->src[ind];
+    if (!device_data->has_swap_interval) {
+        interval = device_data->vsync ? 1 : 0;
+    }
+    if (PS5_VideoOutSetSwapInterval(&device_data->video_out, interval) < 0) {
+        SDL_LogWarn(SDL_LOG_CATEGORY_VIDEO, "%s", SDL_GetError());
     }
-    return 0;
 }
 
-static void PS5_DrawPixelsAsTiles(uint32_t *src, uint32_t *dst,
-                                  int frame_width, int frame_height)
+static void SDLCALL PS5_SwapIntervalChanged(void *userdata, const char *name,
+                                            const char *oldValue,
+                                            const char *hint)
 {
-    int chunk_size = frame_width * frame_height / PS5_THREAD_COUNT;
-    PS5_DrawChunk chunks[PS5_THREAD_COUNT];
-    pthread_t threads[PS5_THREAD_COUNT];
-
-    for (int i=0; i<PS5_THREAD_COUNT; i++) {
-        chunks[i].src = src;
-        chunks[i].dst = dst;
-        chunks[i].src_start = i * chunk_size;
-        chunks[i].src_end = (i + 1) * chunk_size;
-        chunks[i].frame_width = frame_width;
-        chunks[i].frame_height = frame_height;
-
-        if(i == PS5_THREAD_COUNT - 1) {
-            chunks[i].src_end = frame_width * frame_height;
-        }
-
-        pthread_create(&threads[i], 0, &PS5_DrawTileThread, &chunks[i]);
-    }
+    PS5_DeviceData *device_data = (PS5_DeviceData *)userdata;
 
-    for (int i=0; i<PS5_THREAD_COUNT; i++) {
-        pthread_join(threads[i], 0);
+    device_data->has_swap_interval = (hint && *hint) ? SDL_TRUE : SDL_FALSE;
+    if (device_data->has_swap_interval) {
+        device_data->swap_interval = SDL_atoi(hint);
     }
+    PS5_UpdateSwapInterval(device_data);
 }
 
 static void PS5_DestroyWindowFramebuffer(_THIS, SDL_Window *window)
 {
+    PS5_DeviceData *device_data = (PS5_DeviceData *)_this->driverdata;
     SDL_Surface *surface;
 
     surface = (SDL_Surface *)SDL_SetWindowData(window, PS5_SURFACE, NULL);
     SDL_FreeSurface(surface);
+    PS5_FreeTileDamage(&device_data->damage);
+    PS5_FreeTileScale(&device_data->scale);
+    device_data->tiled_width = device_data->tiled_height = 0;
+}
+
+/* Prepare the swizzle pass for the current scan-out size. A surface of
+   another size is scaled on the way. */
+static int PS5_SetupTiling(PS5_DeviceData *device_data,
+                           const SDL_Surface *surface)
+{
+    PS5_VideoOut *vo = &device_data->video_out;
+
+    PS5_FreeTileScale(&device_data->scale);
+    if ((surface->w != vo->width || surface->h != vo->height) &&
+        PS5_InitTileScale(&device_data->scale, device_data->scale_mode,
+                          surface->w, surface->h, vo->width, vo->height) < 0) {
+        return -1;
+    }
+
+    if (PS5_InitTileDamage(&device_data->damage, vo->width, vo->height,
+                           vo->num_buffers) < 0) {
+        PS5_FreeTileScale(&device_data->scale);
+        return -1;
+    }
+
+    device_data->tiled_width = vo->width;
+    device_data->tiled_height = vo->height;
+
+    return 0;
+}
+
+/* The format of the window's display mode, if the swizzle pass can
+   convert from it */
+static Uint32 PS5_GetSurfaceFormat(PS5_DeviceData *device_data,
+                                   SDL_Window *window)
+{
+    SDL_DisplayMode mode;
+
+    /* Linear buffers are filled without converting */
+    if (device_data->video_out.linear) {
+        return SDL_PIXELFORMAT_ABGR8888;
+    }
+    if (SDL_GetWindowDisplayMode(window, &mode) == 0 &&
+        PS5_IsTileFormatSupported(mode.format)) {
+        return mode.format;
+    }
+    return SDL_PIXELFORMAT_ABGR8888;
 }
 
 static int PS5_CreateWindowFramebuffer(_THIS, SDL_Window *window,
                                        Uint32 *format, void **pixels,
                                        int *pitch)
 {
-    const Uint32 surface_format = SDL_PIXELFORMAT_ABGR8888;
+    PS5_DeviceData *device_data = (PS5_DeviceData *)_this->driverdata;
+    PS5_VideoOut *vo = &device_data->video_out;
+    const Uint32 surface_format = PS5_GetSurfaceFormat(device_data, window);
     SDL_Surface *surface;
     int w, h;
 
     PS5_DestroyWindowFramebuffer(_this, window);
+    device_data->palette_src = NULL;
+
+    /* Set by the software renderer from SDL_RENDERER_PRESENTVSYNC */
+    device_data->vsync = SDL_GetHintBoolean(SDL_HINT_RENDER_VSYNC, SDL_TRUE);
+    PS5_UpdateSwapInterval(device_data);
 
     SDL_GetWindowSizeInPixels(window, &w, &h);
-    surface = SDL_CreateRGBSurfaceWithFormat(0, w, h, 0, surface_format);
+    if (vo->linear && w == vo->width && h == vo->height) {
+        /* Render straight into the scan-out buffer */
+        surface = SDL_CreateRGBSurfaceWithFormatFrom(vo->vbuf[0].data, w, h, 0,
+                                                     w * 4, surface_format);
+    } else {
+        surface = SDL_CreateRGBSurfaceWithFormat(0, w, h, 0, surface_format);
+    }
     if (!surface) {
         return -1;
     }
 
+    if (!vo->linear && PS5_SetupTiling(device_data, surface) < 0) {
+        SDL_FreeSurface(surface);
+        return -1;
+    }
+
     SDL_SetWindowData(window, PS5_SURFACE, surface);
     *format = surface_format;
     *pixels = surface->pixels;
@@ -111,85 +164,192 @@ static int PS5_CreateWindowFramebuffer(_THIS, SDL_Window *window,
     return 0;
 }
 
+static void PS5_CopyPixelsLinear(const SDL_Surface *surface, PS5_VideoOut *vo)
+{
+    const int w = SDL_min(surface->w, vo->width);
+    const int h = SDL_min(surface->h, vo->height);
+
+    for (int y = 0; y < h; y++) {
+        SDL_memcpy((Uint32 *)vo->vbuf[0].data + (size_t)y * vo->width,
+                   (const Uint8 *)surface->pixels + (size_t)y * surface->pitch,
+                   w * sizeof(Uint32));
+    }
+}
+
+/* Convert the palette of an INDEX8 window surface when it changes. The
+   whole frame is drawn again then, whatever the update rects are. */
+static void PS5_UpdatePalette(PS5_DeviceData *device_data, SDL_Window *window)
+{
+    const SDL_Palette *palette;
+    SDL_Rect all;
+
+    /* The surface the app draws into wraps ours, and holds the palette */
+    if (!window->surface || !window->surface->format->palette) {
+        return;
+    }
+    palette = window->surface->format->palette;
+    if (palette == device_data->palette_src &&
+        palette->version == device_data->palette_version) {
+        return;
+    }
+
+    SDL_memset(device_data->palette, 0, sizeof(device_data->palette));
+    for (int i = 0; i < SDL_min(palette->ncolors, 256); i++) {
+        const SDL_Color *c = &palette->colors[i];
+
+        device_data->palette[i] = ((Uint32)c->a << 24) | ((Uint32)c->b << 16) |
+                                  ((Uint32)c->g << 8) | c->r;
+    }
+    device_data->palette_src = palette;
+    device_data->palette_version = palette->version;
+
+    all.x = all.y = 0;
+    all.w = device_data->video_out.width;
+    all.h = device_data->video_out.height;
+    PS5_AddTileDamage(&device_data->damage, &all, 1);
+}
+
 static int PS5_UpdateWindowFramebuffer(_THIS, SDL_Window *window,
                                        const SDL_Rect *rects, int numrects)
 {
     PS5_DeviceData *device_data = (PS5_DeviceData *)_this->driverdata;
-    static uint32_t frame_id = 0;
-    uint8_t idx = frame_id % 2;
+    PS5_VideoOut *vo = &device_data->video_out;
     SDL_Surface *surface;
-    struct kevent evt;
-    int junk;
+    PS5_TileJob job;
+    int idx;
 
     surface = (SDL_Surface *)SDL_GetWindowData(window, PS5_SURFACE);
     if (!surface) {
         return SDL_SetError("Couldn't find surface for window");
     }
 
-    PS5_DrawPixelsAsTiles(surface->pixels, device_data->vbuf[idx].data,
-                          surface->w, surface->h);
+    idx = PS5_VideoOutAcquire(vo);
+    if (idx < 0) {
+        return -1;
+    }
+
+    if (vo->linear) {
+        if (surface->pixels != vo->vbuf[0].data) {
+            PS5_CopyPixelsLinear(surface, vo);
+        }
+    } else {
+        /* The display mode changed under the window */
+        if (device_data->tiled_width != vo->width ||
+            device_data->tiled_height != vo->height) {
+            if (PS5_SetupTiling(device_data, surface) < 0) {
+                return -1;
+            }
+        }
 
-    if (sceVideoOutSubmitFlip(device_data->handle, idx, 1, frame_id)) {
-        return SDL_SetError("sceVideoOutSubmitFlip: %s", strerror(errno));
+        /* Only swizzle what changed since this buffer was last drawn: the
+           rects of this update plus those that went to the other buffers */
+        if (device_data->scale.x_map) {
+            for (int i = 0; i < numrects; i++) {
+                SDL_Rect rect;
+
+                PS5_ScaleTileRect(&device_data->scale, &rects[i], &rect);
+                PS5_AddTileDamage(&device_data->damage, &rect, 1);
+            }
+        } else {
+            PS5_AddTileDamage(&device_data->damage, rects, numrects);
+        }
+        if (surface->format->format == SDL_PIXELFORMAT_INDEX8) {
+            PS5_UpdatePalette(device_data, window);
+        }
+
+        job.src = surface->pixels;
+        job.src_pitch = surface->pitch;
+        job.format = surface->format->format;
+        job.palette = device_data->palette;
+        job.dst = vo->vbuf[idx].data;
+        job.width = vo->width;
+        job.height = vo->height;
+        job.cells = PS5_GetTileDamage(&device_data->damage, idx);
+        job.scale = device_data->scale.x_map ? &device_data->scale : NULL;
+        if (PS5_DrawTiles(device_data->tile_pool, &job) < 0) {
+            return -1;
+        }
+        PS5_ClearTileDamage(&device_data->damage, idx);
     }
 
-    if (sceKernelWaitEqueue(device_data->evt_queue, &evt, 1, &junk, 0)) {
-        return SDL_SetError("sceKernelWaitEqueue: %s", strerror(errno));
+    return PS5_VideoOutSubmit(vo, idx);
+}
+
+/* Give a window surface that is drawn straight into the linear scan-out
+   buffer memory of its own, before that buffer goes away. The app may still
+   draw into it until it handles the resize and fetches the new one. */
+static int PS5_DetachWindowSurface(SDL_Window *window, PS5_VideoOut *vo)
+{
+    SDL_Surface *surface = (SDL_Surface *)SDL_GetWindowData(window, PS5_SURFACE);
+    void *pixels;
+
+    if (!vo->linear || !surface || surface->pixels != vo->vbuf[0].data) {
+        return 0;
+    }
+
+    pixels = SDL_malloc((size_t)surface->h * surface->pitch);
+    if (!pixels) {
+        return SDL_OutOfMemory();
+    }
+    SDL_memcpy(pixels, surface->pixels, (size_t)surface->h * surface->pitch);
+
+    /* The surface SDL hands out wraps ours, and is freed before it */
+    if (window->surface && window->surface->pixels == surface->pixels) {
+        window->surface->pixels = pixels;
     }
-    frame_id++;
+    surface->pixels = pixels;
+    surface->flags &= ~SDL_PREALLOC;
 
     return 0;
 }
 
 static void PS5_GetDisplayModes(_THIS, SDL_VideoDisplay * display)
 {
+    static const int sizes[][2] = { { 1920, 1080 }, { 3840, 2160 } };
     SDL_DisplayMode mode;
 
-    SDL_zero(mode);
-    mode.format = SDL_PIXELFORMAT_ABGR8888;
-    mode.w = 3840;
-    mode.h = 2160;
-    mode.refresh_rate = 60;
-
-    SDL_AddDisplayMode(display, &display->current_mode);
-    SDL_AddDisplayMode(display, &mode);
+    /* Every size is offered in each surface format, so that the format
+       asked for survives SDL_GetClosestDisplayMode */
+    for (int i = 0; i < SDL_arraysize(PS5_surface_formats); i++) {
+        for (int j = 0; j < SDL_arraysize(sizes); j++) {
+            mode = display->current_mode;
+            mode.format = PS5_surface_formats[i];
+            mode.w = sizes[j][0];
+            mode.h = sizes[j][1];
+            SDL_AddDisplayMode(display, &mode);
+        }
+    }
 }
 
 static int PS5_SetDisplayMode(_THIS, SDL_VideoDisplay * display,
                               SDL_DisplayMode * mode)
 {
     PS5_DeviceData *device_data = (PS5_DeviceData *)_this->driverdata;
-    PS5_VideoAttr vattr = {0};
-
-    if(device_data->evt_queue) {
-        sceVideoOutDeleteFlipEvent(device_data->evt_queue, device_data->handle);
-        sceKernelDeleteEqueue(device_data->evt_queue);
-    }
+    PS5_VideoOut *vo = &device_data->video_out;
+    SDL_Window *window;
 
-    if(device_data->handle >= 0) {
-        sceVideoOutClose(device_data->handle);
-    }
-    device_data->handle = sceVideoOutOpen(0xff, 0, 0, NULL);
+    /* The new buffers have to be drawn in full */
+    device_data->tiled_width = device_data->tiled_height = 0;
 
-    if (sceKernelCreateEqueue(&device_data->evt_queue, "flip queue")) {
-        return SDL_SetError("sceKernelCreateEqueue: %s", strerror(errno));
-    }
-    if (sceVideoOutAddFlipEvent(device_data->evt_queue, device_data->handle, 0)) {
-        return SDL_SetError("sceVideoOutAddFlipEvent: %s", strerror(errno));
-    }
-    if (sceVideoOutSetFlipRate(device_data->handle, 0)) {
-        return SDL_SetError("sceVideoOutSetFlipRate: %s", strerror(errno));
+    /* Only the format changed, the window surface is created again in
+       the new one and the scan-out buffers stay as they are */
+    if (mode->w == vo->width && mode->h == vo->height && vo->num_buffers > 0) {
+        return 0;
     }
 
-    sceVideoOutSetBufferAttribute2(&vattr, 0x8000000022000000UL, 0,
-                                   mode->w, mode->h, 0, 0, 0);
-
-    if (sceVideoOutRegisterBuffers2(device_data->handle, 0, 0,
-                                    device_data->vbuf, 2, &vattr, 0, NULL)) {
-        return SDL_SetError("sceVideoOutRegisterBuffers2: %s", strerror(errno));
+    for (window = _this->windows; window; window = window->next) {
+        if (PS5_DetachWindowSurface(window, vo) < 0) {
+            return -1;
+        }
     }
 
-    return 0;
+    /* The scan-out buffers are reallocated for the new size, and the
+       previous mode is kept if that fails. SDL then sends a resize event,
+       which makes the app fetch a new window surface and brings us back to
+       PS5_CreateWindowFramebuffer. */
+    return PS5_VideoOutSetMode(vo, mode->w, mode->h,
+                               device_data->want_buffers,
+                               device_data->want_linear);
 }
 
 static int PS5_VideoInit(_THIS)
@@ -197,8 +357,7 @@ static int PS5_VideoInit(_THIS)
     PS5_DeviceData *device_data = (PS5_DeviceData *)_this->driverdata;
     SDL_VideoDisplay display;
     SDL_DisplayMode mode;
-    PS5_VideoAttr vattr;
-    void *vaddr = 0;
+    const char *hint;
 
     SDL_zero(mode);
     mode.format = SDL_PIXELFORMAT_ABGR8888;
@@ -206,47 +365,40 @@ static int PS5_VideoInit(_THIS)
     mode.h = 1080;
     mode.refresh_rate = 60;
 
-    memset(device_data->vbuf, 0, sizeof(device_data->vbuf));
-    memset(&vattr, 0, sizeof(vattr));
-
     sceSystemServiceHideSplashScreen();
-    device_data->handle = sceVideoOutOpen(0xff, 0, 0, NULL);
-    if (device_data->handle < 0) {
-        return SDL_SetError("sceVideoOutOpen: %s", strerror(errno));
-    }
-    device_data->memsize = 0x20000000;
-    if (sceKernelAllocateMainDirectMemory(device_data->memsize, 0x20000, 3,
-                                          &device_data->paddr)) {
-        return SDL_SetError("sceKernelAllocateMainDirectMemory: %s",
-                            strerror(errno));
-    }
-
-    if (sceKernelMapDirectMemory(&vaddr, device_data->memsize, 0x33, 0,
-                                 device_data->paddr, 0x20000)) {
-        return SDL_SetError("sceKernelMapDirectMemory: %s", strerror(errno));
-    }
 
-    device_data->vbuf[0].data = vaddr;
-    device_data->vbuf[1].data = vaddr + (device_data->memsize / 2);
-
-    if (sceKernelCreateEqueue(&device_data->evt_queue, "flip queue")) {
-        return SDL_SetError("sceKernelCreateEqueue: %s", strerror(errno));
+    if (PS5_VideoOutOpen(&device_data->video_out) < 0) {
+        return -1;
     }
 
-    if (sceVideoOutAddFlipEvent(device_data->evt_queue, device_data->handle, 0)) {
-        return SDL_SetError("sceVideoOutAddFlipEvent: %s", strerror(errno));
+    device_data->want_linear = SDL_GetHintBoolean(SDL_HINT_PS5_LINEAR_FRAMEBUFFER,
+                                                  SDL_FALSE);
+    hint = SDL_GetHint(SDL_HINT_PS5_FRAMEBUFFER_COUNT);
+    device_data->want_buffers = (hint && SDL_atoi(hint) >= 3) ? 3 : 2;
+
+    hint = SDL_GetHint(SDL_HINT_PS5_WINDOW_SCALING);
+    device_data->scale_windows = SDL_TRUE;
+    if (hint && SDL_strcasecmp(hint, "integer") == 0) {
+        device_data->scale_mode = PS5_TILE_SCALE_INTEGER;
+    } else if (hint && SDL_strcasecmp(hint, "linear") == 0) {
+        device_data->scale_mode = PS5_TILE_SCALE_LINEAR;
+    } else {
+        device_data->scale_mode = PS5_TILE_SCALE_NEAREST;
+        device_data->scale_windows = (hint && SDL_strcasecmp(hint, "nearest") == 0);
     }
-    if (sceVideoOutSetFlipRate(device_data->handle, 0)) {
-        return SDL_SetError("sceVideoOutSetFlipRate: %s", strerror(errno));
+    if (PS5_VideoOutSetMode(&device_data->video_out, mode.w, mode.h,
+                            device_data->want_buffers,
+                            device_data->want_linear) < 0) {
+        PS5_VideoOutClose(&device_data->video_out);
+        return -1;
     }
 
-    sceVideoOutSetBufferAttribute2(&vattr, 0x8000000022000000UL, 0,
-                                   mode.w, mode.h, 0, 0, 0);
+    device_data->vsync = SDL_TRUE;
+    SDL_AddHintCallback(SDL_HINT_PS5_SWAP_INTERVAL, PS5_SwapIntervalChanged,
+                        device_data);
 
-    if (sceVideoOutRegisterBuffers2(device_data->handle, 0, 0,
-                                    device_data->vbuf, 2, &vattr, 0, NULL)) {
-        return SDL_SetError("sceVideoOutRegisterBuffers2: %s", strerror(errno));
-    }
+    /* A missing pool is not fatal, the frame is then drawn on one thread */
+    device_data->tile_pool = PS5_CreateTilePool(PS5_TILE_THREAD_COUNT);
 
     SDL_zero(display);
     display.desktop_mode = mode;
@@ -261,24 +413,24 @@ static void PS5_VideoQuit(_THIS)
 {
     PS5_DeviceData *device_data = (PS5_DeviceData *)_this->driverdata;
 
-    if (device_data->handle != 0) {
-        sceVideoOutClose(device_data->handle);
-        device_data->handle = 0;
-    }
+    SDL_DelHintCallback(SDL_HINT_PS5_SWAP_INTERVAL, PS5_SwapIntervalChanged,
+                        device_data);
 
-    if (device_data->paddr) {
-        sceKernelReleaseDirectMemory(device_data->paddr, device_data->memsize);
-        device_data->paddr = 0;
-        device_data->memsize = 0;
-    }
-    if (device_data->evt_queue) {
-        sceKernelDeleteEqueue(device_data->evt_queue);
-    }
+    PS5_DestroyTilePool(device_data->tile_pool);
+    device_data->tile_pool = NULL;
+    PS5_FreeTileDamage(&device_data->damage);
+    PS5_FreeTileScale(&device_data->scale);
+
+    PS5_VideoOutClose(&device_data->video_out);
 }
 
 static int PS5_CreateWindow(_THIS, SDL_Window *window)
 {
-    if (window) {
+    PS5_DeviceData *device_data = (PS5_DeviceData *)_this->driverdata;
+
+    /* Scaled windows keep their size, their surface is stretched over the
+       whole display when presented */
+    if (window && !device_data->scale_windows) {
         SDL_SetWindowFullscreen(window, SDL_WINDOW_FULLSCREEN);
     }
 
@@ -342,6 +494,68 @@ static SDL_VideoDevice *PS5_CreateDevice(void)
 VideoBootStrap PS5_bootstrap = { "PS5", "Sony PS5 Video Driver",
                                  PS5_CreateDevice };
 
+int SDL_PS5GetFlipStats(SDL_PS5FlipStats *stats, SDL_bool reset)
+{
+    SDL_VideoDevice *_this = SDL_GetVideoDevice();
+    PS5_DeviceData *device_data;
+    PS5_VideoFlipStats vstats;
+
+    if (!stats) {
+        return SDL_InvalidParamError("stats");
+    }
+    if (!_this || SDL_strcmp(_this->name, PS5_bootstrap.name) != 0) {
+        return SDL_SetError("PS5 video driver is not initialized");
+    }
+
+    device_data = (PS5_DeviceData *)_this->driverdata;
+    PS5_VideoOutGetStats(&device_data->video_out, &vstats);
+    if (reset) {
+        PS5_VideoOutResetStats(&device_data->video_out);
+    }
+
+    SDL_zerop(stats);
+    stats->frames_submitted = vstats.submitted;
+    stats->frames_flipped = vstats.flipped;
+    stats->missed_vblanks = vstats.missed_vblanks;
+    stats->last_latency_us = vstats.latency_last;
+    stats->max_latency_us = vstats.latency_max;
+    if (vstats.latency_samples > 0) {
+        stats->avg_latency_us = (Uint32)(vstats.latency_total /
+                                         vstats.latency_samples);
+    }
+    stats->num_buffers = device_data->video_out.num_buffers;
+
+    return 0;
+}
+
+size_t SDL_PS5GetVideoMemoryUsage(void)
+{
+    SDL_VideoDevice *_this = SDL_GetVideoDevice();
+    PS5_DeviceData *device_data;
+
+    if (!_this || SDL_strcmp(_this->name, PS5_bootstrap.name) != 0) {
+        return 0;
+    }
+
+    device_data = (PS5_DeviceData *)_this->driverdata;
+    return device_data->video_out.memsize;
+}
+
+#elif defined(__PROSPERO__) || defined(SDL_PS5_HOST_EMULATION)
+
+#include "SDL_error.h"
+#include "SDL_system.h"
+
+int SDL_PS5GetFlipStats(SDL_PS5FlipStats *stats, SDL_bool reset)
+{
+    return SDL_Unsupported();
+}
+
+size_t SDL_PS5GetVideoMemoryUsage(void)
+{
+    return 0;
+}
+
 #endif /* SDL_VIDEO_DRIVER_PS5 */
 
 /* vi: set ts=4 sw=4 expandtab: */
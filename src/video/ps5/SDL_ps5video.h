@@ -23,64 +23,35 @@
 #ifndef SDL_ps5video_h_
 #define SDL_ps5video_h_
 
-#include <sys/event.h>
-
 #include "../SDL_sysvideo.h"
-
-typedef struct PS5_VideoBuf {
-    void *data;
-    uint64_t junk0[3];
-} PS5_VideoBuf;
-
-
-typedef struct PS5_VideoAttr {
-    uint8_t junk0[80];
-} PS5_VideoAttr;
+#include "SDL_ps5tiling.h"
+#include "SDL_ps5videoout.h"
 
 typedef struct PS5_DeviceData
 {
-    int handle;
-    PS5_VideoBuf vbuf[2];
-    struct kevent *evt_queue;
-    intptr_t paddr;
-    size_t memsize;
+    PS5_VideoOut video_out;
+    PS5_TilePool *tile_pool;
+    PS5_TileDamage damage;
+    PS5_TileScale scale;       /* when the window surface isn't display sized */
+    int tiled_width;           /* scan-out size 'damage' and 'scale' are for */
+    int tiled_height;
+    SDL_bool scale_windows;    /* SDL_HINT_PS5_WINDOW_SCALING is set */
+    PS5_TileScaleMode scale_mode;
+    SDL_bool want_linear;
+    int want_buffers;
+    SDL_bool has_swap_interval; /* SDL_HINT_PS5_SWAP_INTERVAL is set */
+    int swap_interval;
+    SDL_bool vsync;             /* requested by the renderer */
+    Uint32 palette[256];        /* of INDEX8 window surfaces, as ABGR8888 */
+    const SDL_Palette *palette_src;
+    Uint32 palette_version;     /* of 'palette_src' when it was converted */
 } PS5_DeviceData;
 
-typedef struct PS5_DrawChunk {
-    uint32_t *src;
-    uint32_t *dst;
-
-    uint16_t frame_width;
-    uint16_t frame_height;
-
-    size_t src_start;
-    size_t src_end;
-} PS5_DrawChunk;
-
+/* Apply SDL_HINT_PS5_SWAP_INTERVAL, or 'vsync' when it isn't set */
+void PS5_UpdateSwapInterval(PS5_DeviceData *device_data);
 
 int sceSystemServiceHideSplashScreen(void);
 
-int sceKernelAllocateMainDirectMemory(size_t, size_t, int, intptr_t*);
-int sceKernelMapDirectMemory(void**, size_t, int, int, intptr_t, size_t);
-int sceKernelReleaseDirectMemory(intptr_t, size_t);
-
-int sceKernelCreateEqueue(struct kevent **, const char *);
-int sceKernelWaitEqueue(struct kevent*, struct kevent*, int, int*, uint*);
-int sceKernelDeleteEqueue(struct kevent*);
-
-int sceVideoOutOpen(int, int, int, const void*);
-void sceVideoOutClose(int);
-
-int sceVideoOutAddFlipEvent(struct kevent*, int, void*);
-int sceVideoOutSetFlipRate(int, int);
-int sceVideoOutSubmitFlip(int, int, uint32_t, int64_t);
-int sceVideoOutDeleteFlipEvent(struct kevent*, int);
-
-void sceVideoOutSetBufferAttribute2(PS5_VideoAttr*, uint64_t, uint32_t, uint32_t,
-                                    uint32_t, uint64_t, uint32_t, uint64_t);
-int sceVideoOutRegisterBuffers2(int, int, int, PS5_VideoBuf*, int, PS5_VideoAttr*,
-                                int, void*);
-
 #endif /* SDL_ps5video_h_ */
 
 /* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,420 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include "../../SDL_internal.h"
+
+#if defined(SDL_VIDEO_DRIVER_PS5) || defined(SDL_PS5_HOST_TEST)
+
+#include <errno.h>
+#include <string.h>
+
+#include "SDL_error.h"
+
+#include "SDL_ps5videoout.h"
+
+static int PS5_VideoOutOpenPort(PS5_VideoOut *vo)
+{
+    vo->handle = sceVideoOutOpen(0xff, 0, 0, NULL);
+    if (vo->handle < 0) {
+        return SDL_SetError("sceVideoOutOpen: %s", strerror(errno));
+    }
+
+    if (sceKernelCreateEqueue(&vo->flip_queue, "flip queue")) {
+        vo->flip_queue = NULL;
+        return SDL_SetError("sceKernelCreateEqueue: %s", strerror(errno));
+    }
+    if (sceVideoOutAddFlipEvent(vo->flip_queue, vo->handle, 0)) {
+        return SDL_SetError("sceVideoOutAddFlipEvent: %s", strerror(errno));
+    }
+
+    return PS5_VideoOutSetSwapInterval(vo, vo->swap_interval);
+}
+
+static void PS5_VideoOutClosePort(PS5_VideoOut *vo)
+{
+    if (vo->flip_queue) {
+        sceVideoOutDeleteFlipEvent(vo->flip_queue, vo->handle);
+        sceKernelDeleteEqueue(vo->flip_queue);
+        vo->flip_queue = NULL;
+    }
+
+    if (vo->handle >= 0) {
+        sceVideoOutClose(vo->handle);
+        vo->handle = -1;
+    }
+}
+
+static int PS5_VideoOutRegister(PS5_VideoOut *vo, int width, int height,
+                                uint32_t tiling_mode, int num_buffers)
+{
+    PS5_VideoAttr vattr;
+
+    SDL_zero(vattr);
+    sceVideoOutSetBufferAttribute2(&vattr, PS5_VIDEO_OUT_PIXEL_FORMAT_A8B8G8R8,
+                                   tiling_mode, width, height, 0, 0, 0);
+
+    return sceVideoOutRegisterBuffers2(vo->handle, 0, 0, vo->vbuf,
+                                       num_buffers, &vattr, 0, NULL);
+}
+
+/* Scan-out buffers start on 128 KB boundaries, and direct memory is
+   allocated in 2 MB pages */
+#define PS5_VIDEO_OUT_BUFFER_ALIGN 0x20000
+#define PS5_VIDEO_OUT_MEMORY_ALIGN 0x200000
+#define PS5_VIDEO_OUT_ALIGN(x, a)  (((x) + (a) - 1) & ~(size_t)((a) - 1))
+
+static void PS5_VideoOutFreeMemory(PS5_VideoOut *vo)
+{
+    if (vo->vaddr) {
+        sceKernelMunmap(vo->vaddr, vo->memsize);
+        vo->vaddr = NULL;
+    }
+    if (vo->paddr) {
+        sceKernelReleaseDirectMemory(vo->paddr, vo->memsize);
+        vo->paddr = 0;
+    }
+    vo->memsize = 0;
+    SDL_zeroa(vo->vbuf);
+}
+
+/* Make room for 'num_buffers' buffers of 'size' bytes. Must not be called
+   while buffers are registered. The memory of the previous mode, 'prev',
+   is taken over if it has the right size and is left alone otherwise, the
+   caller releases it once the new buffers are registered. */
+static int PS5_VideoOutAllocate(PS5_VideoOut *vo, PS5_VideoOut *prev,
+                                size_t size, int num_buffers)
+{
+    const size_t stride = PS5_VIDEO_OUT_ALIGN(size, PS5_VIDEO_OUT_BUFFER_ALIGN);
+    const size_t memsize = PS5_VIDEO_OUT_ALIGN(stride * num_buffers,
+                                               PS5_VIDEO_OUT_MEMORY_ALIGN);
+
+    if (memsize != vo->memsize) {
+        if (vo->vaddr == prev->vaddr) {
+            vo->paddr = 0;
+            vo->vaddr = NULL;
+            vo->memsize = 0;
+        } else {
+            PS5_VideoOutFreeMemory(vo);
+        }
+    }
+
+    if (memsize != vo->memsize && memsize == prev->memsize) {
+        vo->paddr = prev->paddr;
+        vo->vaddr = prev->vaddr;
+        vo->memsize = prev->memsize;
+    } else if (memsize != vo->memsize) {
+        if (sceKernelAllocateMainDirectMemory(memsize, PS5_VIDEO_OUT_MEMORY_ALIGN,
+                                              3, &vo->paddr)) {
+            vo->paddr = 0;
+            return SDL_SetError("sceKernelAllocateMainDirectMemory: %s",
+                                strerror(errno));
+        }
+        vo->memsize = memsize;
+
+        if (sceKernelMapDirectMemory(&vo->vaddr, memsize, 0x33, 0, vo->paddr,
+                                     PS5_VIDEO_OUT_MEMORY_ALIGN)) {
+            vo->vaddr = NULL;
+            PS5_VideoOutFreeMemory(vo);
+            return SDL_SetError("sceKernelMapDirectMemory: %s", strerror(errno));
+        }
+    }
+
+    SDL_zeroa(vo->vbuf);
+    for (int i = 0; i < num_buffers; i++) {
+        vo->vbuf[i].data = (Uint8 *)vo->vaddr + i * stride;
+    }
+
+    return 0;
+}
+
+size_t PS5_VideoOutBufferSize(int width, int height, SDL_bool linear)
+{
+    /* Tiled buffers are made of whole 512x128 tiles */
+    if (!linear) {
+        width = (int)PS5_VIDEO_OUT_ALIGN(width, 512);
+        height = (int)PS5_VIDEO_OUT_ALIGN(height, 128);
+    }
+    return (size_t)width * height * 4;
+}
+
+int PS5_VideoOutOpen(PS5_VideoOut *vo)
+{
+    SDL_zerop(vo);
+    vo->handle = -1;
+    vo->swap_interval = 1;
+
+    if (PS5_VideoOutOpenPort(vo) < 0) {
+        PS5_VideoOutClose(vo);
+        return -1;
+    }
+
+    vo->tsc_frequency = sceKernelGetTscFrequency();
+
+    return 0;
+}
+
+void PS5_VideoOutClose(PS5_VideoOut *vo)
+{
+    PS5_VideoOutClosePort(vo);
+    PS5_VideoOutFreeMemory(vo);
+    vo->num_buffers = 0;
+}
+
+/* Register the buffers for 'width' x 'height', on a fresh port if some
+   were registered on this one */
+static int PS5_VideoOutSetModeBuffers(PS5_VideoOut *vo, PS5_VideoOut *prev,
+                                      int width, int height, int num_buffers,
+                                      SDL_bool linear)
+{
+    /* Buffers can only be registered once per port */
+    if (vo->num_buffers > 0) {
+        PS5_VideoOutClosePort(vo);
+        vo->num_buffers = 0;
+        if (PS5_VideoOutOpenPort(vo) < 0) {
+            return -1;
+        }
+    }
+
+    vo->linear = SDL_FALSE;
+    vo->submitted = 0;
+    vo->shown_arg = 0;
+    vo->shown_time = 0;
+    vo->late = SDL_FALSE;
+    SDL_zeroa(vo->buf_arg);
+    SDL_zero(vo->stats);
+
+    if (linear) {
+        if (PS5_VideoOutAllocate(vo, prev, PS5_VideoOutBufferSize(width, height,
+                                                                  SDL_TRUE), 1) < 0) {
+            return -1;
+        }
+        if (PS5_VideoOutRegister(vo, width, height,
+                                 PS5_VIDEO_OUT_TILING_MODE_LINEAR, 1) == 0) {
+            vo->linear = SDL_TRUE;
+            vo->num_buffers = 1;
+        } else {
+            /* Not accepted, fall back to tiled buffers on a fresh port */
+            PS5_VideoOutClosePort(vo);
+            if (PS5_VideoOutOpenPort(vo) < 0) {
+                return -1;
+            }
+        }
+    }
+
+    if (!vo->linear) {
+        if (PS5_VideoOutAllocate(vo, prev, PS5_VideoOutBufferSize(width, height,
+                                                                  SDL_FALSE),
+                                 num_buffers) < 0) {
+            return -1;
+        }
+        if (PS5_VideoOutRegister(vo, width, height,
+                                 PS5_VIDEO_OUT_TILING_MODE_TILE,
+                                 num_buffers)) {
+            return SDL_SetError("sceVideoOutRegisterBuffers2: %s",
+                                strerror(errno));
+        }
+        vo->num_buffers = num_buffers;
+    }
+
+    vo->width = width;
+    vo->height = height;
+
+    return 0;
+}
+
+int PS5_VideoOutSetMode(PS5_VideoOut *vo, int width, int height,
+                        int num_buffers, SDL_bool linear)
+{
+    /* The buffers of the previous mode may still be drawn into, and are
+       only released once the new ones are on screen */
+    PS5_VideoOut prev = *vo;
+    char error[256];
+
+    num_buffers = SDL_clamp(num_buffers, 1, PS5_VIDEO_OUT_MAX_BUFFERS);
+
+    if (PS5_VideoOutSetModeBuffers(vo, &prev, width, height, num_buffers,
+                                   linear) == 0) {
+        if (prev.vaddr != vo->vaddr) {
+            PS5_VideoOutFreeMemory(&prev);
+        }
+        return 0;
+    }
+
+    /* Keep showing the previous mode */
+    SDL_strlcpy(error, SDL_GetError(), sizeof(error));
+    if (vo->vaddr != prev.vaddr) {
+        PS5_VideoOutFreeMemory(vo);
+    }
+    vo->paddr = prev.paddr;
+    vo->vaddr = prev.vaddr;
+    vo->memsize = prev.memsize;
+    SDL_memcpy(vo->vbuf, prev.vbuf, sizeof(vo->vbuf));
+    if (prev.num_buffers > 0) {
+        PS5_VideoOutClosePort(vo);
+        vo->num_buffers = 0;
+        if (PS5_VideoOutOpenPort(vo) == 0 &&
+            PS5_VideoOutRegister(vo, prev.width, prev.height,
+                                 prev.linear ? PS5_VIDEO_OUT_TILING_MODE_LINEAR
+                                             : PS5_VIDEO_OUT_TILING_MODE_TILE,
+                                 prev.num_buffers) == 0) {
+            vo->num_buffers = prev.num_buffers;
+            vo->linear = prev.linear;
+            vo->width = prev.width;
+            vo->height = prev.height;
+        }
+    }
+    return SDL_SetError("%s", error);
+}
+
+/* Account for the flips that happened since the last call */
+static int PS5_VideoOutPoll(PS5_VideoOut *vo)
+{
+    PS5_VideoFlipStatus status;
+    Sint64 frames;
+
+    SDL_zero(status);
+    if (sceVideoOutGetFlipStatus(vo->handle, &status)) {
+        return SDL_SetError("sceVideoOutGetFlipStatus: %s", strerror(errno));
+    }
+    if (status.count == 0 || status.flip_arg <= vo->shown_arg ||
+        status.flip_arg > vo->submitted) {
+        return 0;
+    }
+
+    /* Every vblank in between that didn't bring a new frame was missed */
+    frames = status.flip_arg - vo->shown_arg;
+    if (vo->shown_arg > 0 && vo->flip_interval > 0 &&
+        status.process_time > vo->shown_time) {
+        Uint64 vblanks = status.process_time - vo->shown_time;
+
+        vblanks = (vblanks + vo->flip_interval / 2) / vo->flip_interval;
+        vo->late = vblanks > (Uint64)frames;
+        if (vo->late) {
+            vo->stats.missed_vblanks += vblanks - frames;
+        }
+    }
+
+    /* Only the last flip carries timestamps */
+    if (vo->tsc_frequency > 0 && status.tsc >= status.submit_tsc) {
+        Uint32 latency = (Uint32)((status.tsc - status.submit_tsc) * 1000000 /
+                                  vo->tsc_frequency);
+
+        vo->stats.latency_samples++;
+        vo->stats.latency_total += latency;
+        vo->stats.latency_last = latency;
+        vo->stats.latency_max = SDL_max(vo->stats.latency_max, latency);
+    }
+
+    vo->stats.flipped += frames;
+    vo->shown_arg = status.flip_arg;
+    vo->shown_time = status.process_time;
+
+    return 0;
+}
+
+int PS5_VideoOutAcquire(PS5_VideoOut *vo)
+{
+    PS5_KernelEvent evt;
+    Sint64 busy_until;
+    int index, junk;
+
+    if (vo->num_buffers <= 0) {
+        return SDL_SetError("No scan-out buffers registered");
+    }
+
+    /* A single buffer is drawn into while on screen, there is nothing
+       else to show, but not while its previous flip is still queued */
+    index = (int)(vo->submitted % vo->num_buffers);
+    busy_until = vo->buf_arg[index];
+    if (vo->num_buffers == 1) {
+        busy_until--;
+    }
+
+    for (;;) {
+        if (PS5_VideoOutPoll(vo) < 0) {
+            return -1;
+        }
+        if (vo->buf_arg[index] == 0 || vo->shown_arg > busy_until) {
+            return index;
+        }
+        if (sceKernelWaitEqueue(vo->flip_queue, &evt, 1, &junk, NULL)) {
+            return SDL_SetError("sceKernelWaitEqueue: %s", strerror(errno));
+        }
+    }
+}
+
+int PS5_VideoOutSubmit(PS5_VideoOut *vo, int index)
+{
+    const Sint64 flip_arg = vo->submitted + 1;
+    uint32_t flip_mode = PS5_VIDEO_OUT_FLIP_MODE_VSYNC;
+
+    /* Adaptive sync tears rather than missing another vblank */
+    if (vo->swap_interval == 0 || (vo->swap_interval < 0 && vo->late)) {
+        flip_mode = PS5_VIDEO_OUT_FLIP_MODE_HSYNC;
+    }
+
+    if (sceVideoOutSubmitFlip(vo->handle, index, flip_mode, flip_arg)) {
+        return SDL_SetError("sceVideoOutSubmitFlip: %s", strerror(errno));
+    }
+
+    vo->submitted = flip_arg;
+    vo->buf_arg[index] = flip_arg;
+    vo->stats.submitted++;
+
+    return 0;
+}
+
+int PS5_VideoOutSetSwapInterval(PS5_VideoOut *vo, int interval)
+{
+    const int rate = SDL_clamp(SDL_abs(interval), 1,
+                               PS5_VIDEO_OUT_MAX_SWAP_INTERVAL) - 1;
+
+    if (interval < -1 || interval > PS5_VIDEO_OUT_MAX_SWAP_INTERVAL) {
+        return SDL_SetError("Unsupported swap interval %d", interval);
+    }
+
+    if (vo->handle >= 0 && sceVideoOutSetFlipRate(vo->handle, rate)) {
+        return SDL_SetError("sceVideoOutSetFlipRate: %s", strerror(errno));
+    }
+
+    vo->swap_interval = interval;
+    vo->flip_interval = 1000000 * (rate + 1) / 60;
+    vo->late = SDL_FALSE;
+
+    return 0;
+}
+
+void PS5_VideoOutGetStats(PS5_VideoOut *vo, PS5_VideoFlipStats *stats)
+{
+    if (vo->num_buffers > 0) {
+        PS5_VideoOutPoll(vo);
+    }
+    *stats = vo->stats;
+}
+
+void PS5_VideoOutResetStats(PS5_VideoOut *vo)
+{
+    SDL_zero(vo->stats);
+}
+
+#endif /* SDL_VIDEO_DRIVER_PS5 || SDL_PS5_HOST_TEST */
+
+/* vi: set ts=4 sw=4 expandtab: */
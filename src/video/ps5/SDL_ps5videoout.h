@@ -0,0 +1,179 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../../SDL_internal.h"
+
+#ifndef SDL_ps5videoout_h_
+#define SDL_ps5videoout_h_
+
+/* Scan-out buffer management on top of sceVideoOut. Only the SCE functions
+   declared below are used, so the logic can be exercised on the host
+   against a mock of them (see test/testps5videoout.c). */
+
+#include "SDL_stdinc.h"
+
+#define PS5_VIDEO_OUT_MAX_BUFFERS 3
+
+#define PS5_VIDEO_OUT_PIXEL_FORMAT_A8B8G8R8 0x8000000022000000UL
+
+#define PS5_VIDEO_OUT_TILING_MODE_TILE   0
+#define PS5_VIDEO_OUT_TILING_MODE_LINEAR 1
+
+#define PS5_VIDEO_OUT_FLIP_MODE_VSYNC 1
+#define PS5_VIDEO_OUT_FLIP_MODE_HSYNC 2 /* as soon as possible, may tear */
+
+/* Longest swap interval, flip rates go down to a third of the refresh */
+#define PS5_VIDEO_OUT_MAX_SWAP_INTERVAL 3
+
+typedef struct PS5_VideoBuf {
+    void *data;
+    uint64_t junk0[3];
+} PS5_VideoBuf;
+
+typedef struct PS5_VideoAttr {
+    uint8_t junk0[80];
+} PS5_VideoAttr;
+
+/* Same layout as the kernel's struct kevent */
+typedef struct PS5_KernelEvent {
+    uintptr_t ident;
+    short filter;
+    unsigned short flags;
+    unsigned int fflags;
+    intptr_t data;
+    void *udata;
+    uint64_t ext[4];
+} PS5_KernelEvent;
+
+typedef struct PS5_KernelEqueue PS5_KernelEqueue;
+
+typedef struct PS5_VideoFlipStatus {
+    uint64_t count;
+    uint64_t process_time; /* of the last flip, in microseconds */
+    uint64_t tsc;          /* of the last flip */
+    int64_t flip_arg;      /* of the last flip */
+    uint64_t submit_tsc;   /* of the last flip */
+    uint64_t reserved0;
+    int32_t gc_queue_num;
+    int32_t flip_pending_num;
+    int32_t current_buffer;
+    uint32_t reserved1;
+} PS5_VideoFlipStatus;
+
+typedef struct PS5_VideoFlipStats
+{
+    Uint64 submitted;
+    Uint64 flipped;
+    Uint64 missed_vblanks;  /* vblanks that showed the same frame again */
+    Uint64 latency_samples;
+    Uint64 latency_total;   /* submit-to-flip time, in microseconds */
+    Uint32 latency_last;
+    Uint32 latency_max;
+} PS5_VideoFlipStats;
+
+typedef struct PS5_VideoOut
+{
+    int handle;
+    PS5_KernelEqueue *flip_queue;
+    intptr_t paddr;
+    size_t memsize; /* of direct memory, sized for the current mode */
+    void *vaddr;
+    PS5_VideoBuf vbuf[PS5_VIDEO_OUT_MAX_BUFFERS];
+    int num_buffers;
+    int width;
+    int height;
+    SDL_bool linear; /* buffers were registered with the linear layout */
+
+    /* Flips are identified by the number of frames submitted before them,
+       plus one. Buffers are used in turn, so the one to draw into next is
+       always the one that has been queued the longest ago. */
+    Sint64 submitted;
+    Sint64 buf_arg[PS5_VIDEO_OUT_MAX_BUFFERS]; /* last flip queued, 0 if none */
+    Sint64 shown_arg;   /* last flip that reached the screen, 0 if none */
+    Uint64 shown_time;  /* process time of that flip */
+    SDL_bool late;      /* that flip missed a vblank */
+    int swap_interval;  /* see PS5_VideoOutSetSwapInterval */
+    Uint32 flip_interval; /* between two vblanks at the flip rate, in us */
+    Uint64 tsc_frequency;
+    PS5_VideoFlipStats stats;
+} PS5_VideoOut;
+
+/* Open the video output, memory is allocated once a mode is set */
+int PS5_VideoOutOpen(PS5_VideoOut *vo);
+void PS5_VideoOutClose(PS5_VideoOut *vo);
+
+/* Bytes needed for one scan-out buffer */
+size_t PS5_VideoOutBufferSize(int width, int height, SDL_bool linear);
+
+/* Register 'num_buffers' scan-out buffers for a 'width' x 'height' mode,
+   reallocating their memory if the size changed. When 'linear' is set, a
+   single buffer with the linear layout is tried first, and tiled buffers
+   are registered if it isn't accepted. The memory of the previous mode is
+   only released once the new buffers are registered, and the previous mode
+   is registered again if the switch fails. */
+int PS5_VideoOutSetMode(PS5_VideoOut *vo, int width, int height,
+                        int num_buffers, SDL_bool linear);
+
+/* Index of the buffer to draw the next frame into. Only blocks while that
+   buffer is still waiting to be shown or, when there is more than one, is
+   still on screen. Returns -1 on error. */
+int PS5_VideoOutAcquire(PS5_VideoOut *vo);
+
+/* Queue buffer 'index' to be shown at the next vblank, without waiting */
+int PS5_VideoOutSubmit(PS5_VideoOut *vo, int index);
+
+/* Choose when queued frames are shown, with the meaning of
+   SDL_GL_SetSwapInterval: 0 flips immediately, 1 to 3 flip on vblank at
+   60, 30 or 20 Hz, and -1 flips on vblank unless the frame is late. */
+int PS5_VideoOutSetSwapInterval(PS5_VideoOut *vo, int interval);
+
+/* Statistics about the flips that happened so far */
+void PS5_VideoOutGetStats(PS5_VideoOut *vo, PS5_VideoFlipStats *stats);
+void PS5_VideoOutResetStats(PS5_VideoOut *vo);
+
+
+int sceKernelAllocateMainDirectMemory(size_t, size_t, int, intptr_t*);
+int sceKernelMapDirectMemory(void**, size_t, int, int, intptr_t, size_t);
+int sceKernelReleaseDirectMemory(intptr_t, size_t);
+int sceKernelMunmap(void*, size_t);
+
+int sceKernelCreateEqueue(PS5_KernelEqueue **, const char *);
+int sceKernelWaitEqueue(PS5_KernelEqueue *, PS5_KernelEvent *, int, int *,
+                        unsigned int *);
+int sceKernelDeleteEqueue(PS5_KernelEqueue *);
+uint64_t sceKernelGetTscFrequency(void);
+
+int sceVideoOutOpen(int, int, int, const void*);
+void sceVideoOutClose(int);
+
+int sceVideoOutAddFlipEvent(PS5_KernelEqueue *, int, void*);
+int sceVideoOutSetFlipRate(int, int);
+int sceVideoOutSubmitFlip(int, int, uint32_t, int64_t);
+int sceVideoOutDeleteFlipEvent(PS5_KernelEqueue *, int);
+int sceVideoOutGetFlipStatus(int, PS5_VideoFlipStatus *);
+
+void sceVideoOutSetBufferAttribute2(PS5_VideoAttr*, uint64_t, uint32_t, uint32_t,
+                                    uint32_t, uint64_t, uint32_t, uint64_t);
+int sceVideoOutRegisterBuffers2(int, int, int, PS5_VideoBuf*, int, PS5_VideoAttr*,
+                                int, void*);
+
+#endif /* SDL_ps5videoout_h_ */
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -24,6 +24,8 @@
 const char *RWopsReadTestFilename = "rwops_read";
 const char *RWopsWriteTestFilename = "rwops_write";
 const char *RWopsAlphabetFilename = "rwops_alphabet";
+const char *RWopsMappedFilename = "rwops_mapped";
+const char *RWopsWaveFilename = "rwops_bench.wav";
 
 static const char RWopsHelloWorldTestString[] = "Hello World!";
 static const char RWopsHelloWorldCompString[] = "Hello World!";
@@ -707,6 +709,357 @@ int rwops_testFileWriteReadEndian(void)
     return TEST_COMPLETED;
 }
 
+static Sint64 SDLCALL _rwopsSizeZero(SDL_RWops *context)
+{
+    return 0;
+}
+
+/**
+ * @brief Tests loading streams that are longer than their size says.
+ *
+ * \sa
+ * http://wiki.libsdl.org/SDL_LoadFile_RW
+ */
+int rwops_testLoadFileShortSize(void)
+{
+    SDL_RWops *rw;
+    size_t dataSize;
+    char *data;
+
+    /* Like the files in /proc, which report a size of 0 */
+    rw = SDL_RWFromConstMem(RWopsHelloWorldTestString, sizeof(RWopsHelloWorldTestString) - 1);
+    SDLTest_AssertCheck(rw != NULL, "Verify opening memory with SDL_RWFromConstMem does not return NULL");
+    if (rw == NULL) {
+        return TEST_ABORTED;
+    }
+    rw->size = _rwopsSizeZero;
+
+    data = (char *)SDL_LoadFile_RW(rw, &dataSize, 1);
+    SDLTest_AssertPass("Call to SDL_LoadFile_RW() succeeded");
+    SDLTest_AssertCheck(data != NULL, "Verify SDL_LoadFile_RW does not return NULL");
+    if (data != NULL) {
+        SDLTest_AssertCheck(
+            dataSize == sizeof(RWopsHelloWorldTestString) - 1,
+            "Verify loaded size, expected %i, got %i", (int)(sizeof(RWopsHelloWorldTestString) - 1), (int)dataSize);
+        SDLTest_AssertCheck(
+            SDL_strcmp(data, RWopsHelloWorldTestString) == 0,
+            "Verify loaded data, expected '%s', got '%s'", RWopsHelloWorldTestString, data);
+        SDL_free(data);
+    }
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests reading a file through a memory mapping.
+ *
+ * \sa
+ * http://wiki.libsdl.org/SDL_RWFromMappedFile
+ * http://wiki.libsdl.org/SDL_RWFromFile
+ * http://wiki.libsdl.org/SDL_LoadFile
+ */
+int rwops_testMappedFile(void)
+{
+    const int fileSize = 200000;
+    const int offset = 12345;
+    Uint8 *content, buf[1000];
+    SDL_RWops *rw;
+    FILE *handle;
+    size_t s, dataSize;
+    Sint64 i;
+    void *data;
+    int result;
+
+    /* Small files can be mapped explicitly */
+    rw = SDL_RWFromMappedFile(RWopsReadTestFilename);
+    SDLTest_AssertPass("Call to SDL_RWFromMappedFile() succeeded");
+    if (rw == NULL) {
+        SDLTest_Log("Files can't be mapped here: %s", SDL_GetError());
+        return TEST_SKIPPED;
+    }
+    SDLTest_AssertCheck(
+        rw->type == SDL_RWOPS_MEMORY_RO,
+        "Verify RWops type is SDL_RWOPS_MEMORY_RO; expected: %d, got: %" SDL_PRIu32, SDL_RWOPS_MEMORY_RO, rw->type);
+    _testGenericRWopsValidations(rw, 0);
+    result = SDL_RWclose(rw);
+    SDLTest_AssertCheck(result == 0, "Verify result value is 0; got: %d", result);
+
+    /* Create a file large enough to be mapped by SDL_RWFromFile() */
+    content = (Uint8 *)SDL_malloc(fileSize);
+    SDLTest_AssertCheck(content != NULL, "Verify allocation of the file content");
+    if (content == NULL) {
+        return TEST_ABORTED;
+    }
+    for (i = 0; i < fileSize; i++) {
+        content[i] = (Uint8)(i * 7);
+    }
+    handle = fopen(RWopsMappedFilename, "wb");
+    SDLTest_AssertCheck(handle != NULL, "Verify creation of file '%s' returned non NULL handle", RWopsMappedFilename);
+    if (handle == NULL) {
+        SDL_free(content);
+        return TEST_ABORTED;
+    }
+    s = fwrite(content, 1, fileSize, handle);
+    SDLTest_AssertCheck(s == (size_t)fileSize, "Verify number of written bytes, expected %i, got %i", fileSize, (int)s);
+    fclose(handle);
+
+    rw = SDL_RWFromFile(RWopsMappedFilename, "rb");
+    SDLTest_AssertCheck(rw != NULL, "Verify opening file with SDL_RWFromFile in read mode does not return NULL");
+    if (rw != NULL) {
+        SDLTest_AssertCheck(
+            rw->type == SDL_RWOPS_MEMORY_RO,
+            "Verify RWops type is SDL_RWOPS_MEMORY_RO; expected: %d, got: %" SDL_PRIu32, SDL_RWOPS_MEMORY_RO, rw->type);
+        i = SDL_RWsize(rw);
+        SDLTest_AssertCheck(i == (Sint64)fileSize, "Verify size, expected %i, got %" SDL_PRIs64, fileSize, i);
+        i = SDL_RWseek(rw, offset, RW_SEEK_SET);
+        SDLTest_AssertCheck(i == (Sint64)offset, "Verify seek to %i, got %" SDL_PRIs64, offset, i);
+        s = SDL_RWread(rw, buf, 1, sizeof(buf));
+        SDLTest_AssertCheck(s == sizeof(buf), "Verify result from SDL_RWread, expected %i, got %i", (int)sizeof(buf), (int)s);
+        SDLTest_AssertCheck(SDL_memcmp(buf, content + offset, sizeof(buf)) == 0, "Verify read bytes match the file");
+        i = SDL_RWseek(rw, -10, RW_SEEK_END);
+        s = SDL_RWread(rw, buf, 1, sizeof(buf));
+        SDLTest_AssertCheck(s == 10, "Verify short read at the end of the file, expected 10, got %i", (int)s);
+        s = SDL_RWwrite(rw, buf, 1, 1);
+        SDLTest_AssertCheck(s == 0, "Verify writing to a mapped file fails, got %i", (int)s);
+        SDL_RWclose(rw);
+    }
+
+    /* Files opened for writing, or with the hint off, go through stdio */
+    rw = SDL_RWFromFile(RWopsMappedFilename, "r+b");
+    SDLTest_AssertCheck(rw != NULL && rw->type == SDL_RWOPS_STDFILE, "Verify a file opened for update isn't mapped");
+    if (rw != NULL) {
+        SDL_RWclose(rw);
+    }
+    SDL_SetHint(SDL_HINT_RWOPS_FILE_MAPPING, "0");
+    rw = SDL_RWFromFile(RWopsMappedFilename, "rb");
+    SDLTest_AssertCheck(rw != NULL && rw->type == SDL_RWOPS_STDFILE, "Verify files aren't mapped with SDL_HINT_RWOPS_FILE_MAPPING=0");
+    if (rw != NULL) {
+        SDL_RWclose(rw);
+    }
+    SDL_ResetHint(SDL_HINT_RWOPS_FILE_MAPPING);
+
+    data = SDL_LoadFile(RWopsMappedFilename, &dataSize);
+    SDLTest_AssertCheck(data != NULL, "Verify SDL_LoadFile of a mapped file does not return NULL");
+    if (data != NULL) {
+        SDLTest_AssertCheck(dataSize == (size_t)fileSize, "Verify loaded size, expected %i, got %i", fileSize, (int)dataSize);
+        SDLTest_AssertCheck(SDL_memcmp(data, content, fileSize) == 0, "Verify loaded bytes match the file");
+        SDLTest_AssertCheck(((char *)data)[dataSize] == '\0', "Verify loaded data is null-terminated");
+        SDL_free(data);
+    }
+
+    SDL_free(content);
+    (void)remove(RWopsMappedFilename);
+
+    return TEST_COMPLETED;
+}
+
+static size_t SDLCALL _rwopsReadOnes(SDL_RWops *context, void *ptr, size_t size, size_t maxnum)
+{
+    SDL_memset(ptr, 0x01, size * maxnum);
+    return maxnum;
+}
+
+/**
+ * @brief Tests reading ahead of another stream.
+ *
+ * \sa
+ * http://wiki.libsdl.org/SDL_RWFromBuffered
+ * http://wiki.libsdl.org/SDL_ReadLE32
+ */
+int rwops_testBuffered(void)
+{
+    const Uint8 bytes[] = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A };
+    char mem[sizeof(RWopsHelloWorldTestString)];
+    char area[64];
+    SDL_RWops *rw;
+    size_t s;
+    Uint32 value32;
+    Uint16 value16;
+    Sint64 i;
+    int result;
+
+    rw = SDL_RWFromBuffered(NULL, 0);
+    SDLTest_AssertCheck(rw == NULL, "Verify SDL_RWFromBuffered(NULL) returns NULL");
+
+    /* Generic checks, with a buffer smaller than the reads */
+    rw = SDL_RWFromBuffered(SDL_RWFromMem(mem, sizeof(RWopsHelloWorldTestString) - 1), 5);
+    SDLTest_AssertPass("Call to SDL_RWFromBuffered() succeeded");
+    SDLTest_AssertCheck(rw != NULL, "Verify SDL_RWFromBuffered does not return NULL");
+    if (rw == NULL) {
+        return TEST_ABORTED;
+    }
+    SDLTest_AssertCheck(
+        rw->type == SDL_RWOPS_BUFFERED,
+        "Verify RWops type is SDL_RWOPS_BUFFERED; expected: %d, got: %" SDL_PRIu32, SDL_RWOPS_BUFFERED, rw->type);
+    _testGenericRWopsValidations(rw, 1);
+    result = SDL_RWclose(rw);
+    SDLTest_AssertCheck(result == 0, "Verify result value is 0; got: %d", result);
+
+    /* Values that straddle the end of the buffer */
+    rw = SDL_RWFromBuffered(SDL_RWFromConstMem(bytes, sizeof(bytes)), 3);
+    SDLTest_AssertCheck(rw != NULL, "Verify SDL_RWFromBuffered does not return NULL");
+    if (rw == NULL) {
+        return TEST_ABORTED;
+    }
+    value16 = SDL_ReadLE16(rw);
+    SDLTest_AssertCheck(value16 == 0x0201, "Verify SDL_ReadLE16, expected 0x0201, got 0x%04x", value16);
+    value32 = SDL_ReadBE32(rw);
+    SDLTest_AssertCheck(value32 == 0x03040506, "Verify SDL_ReadBE32, expected 0x03040506, got 0x%08" SDL_PRIx32, value32);
+    i = SDL_RWtell(rw);
+    SDLTest_AssertCheck(i == 6, "Verify SDL_RWtell, expected 6, got %" SDL_PRIs64, i);
+    i = SDL_RWseek(rw, -1, RW_SEEK_CUR);
+    SDLTest_AssertCheck(i == 5, "Verify seek back within the buffer, expected 5, got %" SDL_PRIs64, i);
+    value32 = SDL_ReadLE32(rw);
+    SDLTest_AssertCheck(value32 == 0x09080706, "Verify SDL_ReadLE32, expected 0x09080706, got 0x%08" SDL_PRIx32, value32);
+    i = (Sint64)SDL_RWread(rw, &value32, sizeof(value32), 1);
+    SDLTest_AssertCheck(i == 0, "Verify a read past the end returns 0, got %" SDL_PRIs64, i);
+    i = SDL_RWsize(rw);
+    SDLTest_AssertCheck(i == (Sint64)sizeof(bytes), "Verify SDL_RWsize, expected %i, got %" SDL_PRIs64, (int)sizeof(bytes), i);
+    result = SDL_RWclose(rw);
+    SDLTest_AssertCheck(result == 0, "Verify result value is 0; got: %d", result);
+
+    /* Streams of the app's own go through their read function, whatever
+       their type says */
+    rw = SDL_AllocRW();
+    SDLTest_AssertCheck(rw != NULL, "Verify SDL_AllocRW does not return NULL");
+    if (rw == NULL) {
+        return TEST_ABORTED;
+    }
+    rw->read = _rwopsReadOnes;
+    rw->type = SDL_RWOPS_BUFFERED;
+    rw->hidden.unknown.data1 = area;
+    value16 = SDL_ReadLE16(rw);
+    SDLTest_AssertCheck(value16 == 0x0101, "Verify SDL_ReadLE16 used the read function, expected 0x0101, got 0x%04x", value16);
+    SDL_FreeRW(rw);
+
+    /* Writes go where the reader is, not where the read-ahead stopped */
+    SDL_memset(area, 'a', sizeof(area));
+    rw = SDL_RWFromBuffered(SDL_RWFromMem(area, sizeof(area)), 16);
+    SDLTest_AssertCheck(rw != NULL, "Verify SDL_RWFromBuffered does not return NULL");
+    if (rw == NULL) {
+        return TEST_ABORTED;
+    }
+    s = SDL_RWread(rw, mem, 1, 4);
+    SDLTest_AssertCheck(s == 4, "Verify result from SDL_RWread, expected 4, got %i", (int)s);
+    s = SDL_RWwrite(rw, "XY", 1, 2);
+    SDLTest_AssertCheck(s == 2, "Verify result from SDL_RWwrite, expected 2, got %i", (int)s);
+    i = SDL_RWtell(rw);
+    SDLTest_AssertCheck(i == 6, "Verify SDL_RWtell after the write, expected 6, got %" SDL_PRIs64, i);
+    SDLTest_AssertCheck(SDL_memcmp(area, "aaaaXYaa", 8) == 0, "Verify the write landed at offset 4");
+    SDLTest_AssertCheck(area[16] == 'a' && area[17] == 'a', "Verify nothing was written at offset 16");
+    s = SDL_RWread(rw, mem, 1, 2);
+    SDLTest_AssertCheck(s == 2 && SDL_memcmp(mem, "aa", 2) == 0, "Verify reading on after the write");
+    i = SDL_RWtell(rw);
+    SDLTest_AssertCheck(i == 8, "Verify SDL_RWtell after reading on, expected 8, got %" SDL_PRIs64, i);
+    result = SDL_RWclose(rw);
+    SDLTest_AssertCheck(result == 0, "Verify result value is 0; got: %d", result);
+
+    return TEST_COMPLETED;
+}
+
+/* Parse a 16-bit PCM WAV file and sum its samples, one at a time */
+static Uint64 _sumWaveSamples(SDL_RWops *rw)
+{
+    Uint64 sum = 0;
+    Uint32 id, length;
+
+    SDL_ReadLE32(rw); /* RIFF */
+    SDL_ReadLE32(rw);
+    SDL_ReadLE32(rw); /* WAVE */
+    for (;;) {
+        id = SDL_ReadLE32(rw);
+        length = SDL_ReadLE32(rw);
+        if (id == 0 || id == 0x61746164 /* data */) {
+            break;
+        }
+        SDL_RWseek(rw, length, RW_SEEK_CUR);
+    }
+    for (length /= 2; length > 0; length--) {
+        sum += SDL_ReadLE16(rw);
+    }
+    return sum;
+}
+
+/**
+ * @brief Benchmarks parsing a 100 MB WAV file with and without read-ahead.
+ *
+ * \sa
+ * http://wiki.libsdl.org/SDL_RWFromBuffered
+ * http://wiki.libsdl.org/SDL_ReadLE16
+ */
+int rwops_testBufferedBenchmark(void)
+{
+    const Uint32 dataSize = 100 * 1024 * 1024;
+    const char *names[] = { "stdio", "buffered stdio", "mapped" };
+    Uint64 expected = 0, sum, start;
+    double elapsed[SDL_arraysize(names)];
+    Uint16 *block;
+    SDL_RWops *rw;
+    Uint32 i, j;
+
+    /* A 16-bit stereo PCM file, written with stdio */
+    block = (Uint16 *)SDL_malloc(65536 * sizeof(Uint16));
+    SDLTest_AssertCheck(block != NULL, "Verify allocation of the sample block");
+    if (block == NULL) {
+        return TEST_ABORTED;
+    }
+    rw = SDL_RWFromFile(RWopsWaveFilename, "wb");
+    SDLTest_AssertCheck(rw != NULL, "Verify creation of file '%s' returned non NULL handle", RWopsWaveFilename);
+    if (rw == NULL) {
+        SDL_free(block);
+        return TEST_ABORTED;
+    }
+    SDL_RWwrite(rw, "RIFF", 4, 1);
+    SDL_WriteLE32(rw, 36 + dataSize);
+    SDL_RWwrite(rw, "WAVEfmt ", 8, 1);
+    SDL_WriteLE32(rw, 16);
+    SDL_WriteLE16(rw, 1);          /* PCM */
+    SDL_WriteLE16(rw, 2);          /* channels */
+    SDL_WriteLE32(rw, 44100);      /* frequency */
+    SDL_WriteLE32(rw, 44100 * 4);  /* byte rate */
+    SDL_WriteLE16(rw, 4);          /* block align */
+    SDL_WriteLE16(rw, 16);         /* bits per sample */
+    SDL_RWwrite(rw, "data", 4, 1);
+    SDL_WriteLE32(rw, dataSize);
+    for (i = 0; i < dataSize / 2; i += 65536) {
+        for (j = 0; j < 65536; j++) {
+            const Uint16 sample = (Uint16)((i + j) * 31);
+            block[j] = SDL_SwapLE16(sample);
+            expected += sample;
+        }
+        SDL_RWwrite(rw, block, sizeof(Uint16), 65536);
+    }
+    SDL_free(block);
+    SDLTest_AssertCheck(SDL_RWclose(rw) == 0, "Verify the file was written");
+
+    for (i = 0; i < SDL_arraysize(names); i++) {
+        SDL_SetHint(SDL_HINT_RWOPS_FILE_MAPPING, i == 2 ? "1" : "0");
+        rw = SDL_RWFromFile(RWopsWaveFilename, "rb");
+        SDLTest_AssertCheck(rw != NULL, "Verify opening '%s' does not return NULL", RWopsWaveFilename);
+        if (rw == NULL) {
+            continue;
+        }
+        if (i == 1) {
+            rw = SDL_RWFromBuffered(rw, 0);
+            SDLTest_AssertCheck(rw != NULL, "Verify SDL_RWFromBuffered does not return NULL");
+            if (rw == NULL) {
+                continue;
+            }
+        }
+        start = SDL_GetPerformanceCounter();
+        sum = _sumWaveSamples(rw);
+        elapsed[i] = (double)(SDL_GetPerformanceCounter() - start) / SDL_GetPerformanceFrequency();
+        SDL_RWclose(rw);
+
+        SDLTest_AssertCheck(sum == expected, "Verify the samples read through %s, expected %" SDL_PRIu64 ", got %" SDL_PRIu64, names[i], expected, sum);
+        SDLTest_Log("%s: %.3f s, %.1f MB/s", names[i], elapsed[i], dataSize / elapsed[i] / (1024 * 1024));
+    }
+    SDL_ResetHint(SDL_HINT_RWOPS_FILE_MAPPING);
+    (void)remove(RWopsWaveFilename);
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* RWops test cases */
@@ -745,10 +1098,22 @@ static const SDLTest_TestCaseReference rwopsTest9 =
 static const SDLTest_TestCaseReference rwopsTest10 =
         { (SDLTest_TestCaseFp)rwops_testCompareRWFromMemWithRWFromFile, "rwops_testCompareRWFromMemWithRWFromFile", "Compare RWFromMem and RWFromFile RWops for read and seek", TEST_ENABLED };
 
+static const SDLTest_TestCaseReference rwopsTest11 =
+        { (SDLTest_TestCaseFp)rwops_testMappedFile, "rwops_testMappedFile", "Test reading a file through a memory mapping", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference rwopsTest12 =
+        { (SDLTest_TestCaseFp)rwops_testBuffered, "rwops_testBuffered", "Test reading ahead of another stream", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference rwopsTest13 =
+        { (SDLTest_TestCaseFp)rwops_testBufferedBenchmark, "rwops_testBufferedBenchmark", "Benchmark parsing a 100 MB WAV file with and without read-ahead", TEST_DISABLED };
+
+static const SDLTest_TestCaseReference rwopsTest14 =
+        { (SDLTest_TestCaseFp)rwops_testLoadFileShortSize, "rwops_testLoadFileShortSize", "Test loading streams that are longer than their size says", TEST_ENABLED };
+
 /* Sequence of RWops test cases */
 static const SDLTest_TestCaseReference *rwopsTests[] = {
     &rwopsTest1, &rwopsTest2, &rwopsTest3, &rwopsTest4, &rwopsTest5, &rwopsTest6,
-    &rwopsTest7, &rwopsTest8, &rwopsTest9, &rwopsTest10, NULL
+    &rwopsTest7, &rwopsTest8, &rwopsTest9, &rwopsTest10, &rwopsTest11, &rwopsTest12, &rwopsTest13, &rwopsTest14, NULL
 };
 
 /* RWops test suite (global) */
@@ -0,0 +1,282 @@
+/*
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Benchmark of SDL_UpdateWindowSurface, end to end, with the video drivers
+   that present a window framebuffer. Each frame is drawn into an ARGB8888
+   surface (fill), blitted to the window surface in its own format
+   (convert), then presented, which covers the driver's
+   UpdateWindowFramebuffer with its tiling and flip wait (present). */
+
+#include "SDL.h"
+
+#define NUM_DIRTY_RECTS 4
+
+enum
+{
+    STAGE_FILL,
+    STAGE_CONVERT,
+    STAGE_PRESENT,
+    NUM_STAGES
+};
+
+static const char *stage_names[NUM_STAGES] = { "fill", "convert", "present" };
+
+static const char *drivers[] = { "dummy", "offscreen", "ps5" };
+
+static const struct
+{
+    const char *name;
+    int w, h;
+} sizes[] = {
+    { "720p", 1280, 720 },
+    { "1080p", 1920, 1080 },
+    { "4k", 3840, 2160 },
+};
+
+static int frames = 60;
+
+static int SDLCALL compare_ticks(const void *a, const void *b)
+{
+    const Uint64 ta = *(const Uint64 *)a;
+    const Uint64 tb = *(const Uint64 *)b;
+
+    return (ta < tb) ? -1 : (ta > tb);
+}
+
+static double ticks_to_ms(Uint64 ticks)
+{
+    return (double)ticks * 1000.0 / SDL_GetPerformanceFrequency();
+}
+
+/* The rects drawn in a frame: the whole window, or a few small ones that
+   move across it */
+static int get_rects(SDL_Rect *rects, int w, int h, SDL_bool dirty, int frame)
+{
+    if (!dirty) {
+        rects[0].x = rects[0].y = 0;
+        rects[0].w = w;
+        rects[0].h = h;
+        return 1;
+    }
+
+    for (int i = 0; i < NUM_DIRTY_RECTS; i++) {
+        rects[i].w = w / 8;
+        rects[i].h = h / 8;
+        rects[i].x = (frame * 16 + i * w / NUM_DIRTY_RECTS) % (w - rects[i].w);
+        rects[i].y = (frame * 9 + i * h / NUM_DIRTY_RECTS) % (h - rects[i].h);
+    }
+    return NUM_DIRTY_RECTS;
+}
+
+/* Log the flips since the last call, if the driver keeps count of them */
+static void report_flips(const char *driver, SDL_bool show)
+{
+#if defined(__PROSPERO__) || defined(SDL_PS5_HOST_EMULATION)
+    SDL_PS5FlipStats stats;
+
+    if (SDL_strcasecmp(driver, "ps5") == 0 && SDL_PS5GetFlipStats(&stats, SDL_TRUE) == 0 &&
+        show) {
+        SDL_Log("    flips: %d/%d shown, %d missed vblanks, latency avg %.3f ms, max %.3f ms",
+                (int)stats.frames_flipped, (int)stats.frames_submitted,
+                (int)stats.missed_vblanks, stats.avg_latency_us / 1000.0,
+                stats.max_latency_us / 1000.0);
+    }
+#endif
+}
+
+static int run(const char *driver, const char *size_name, int w, int h,
+               SDL_bool dirty)
+{
+    SDL_Window *window;
+    SDL_Surface *screen, *src;
+    SDL_Rect rects[NUM_DIRTY_RECTS];
+    Uint64 *ticks[NUM_STAGES];
+    Uint64 total[NUM_STAGES];
+    size_t bytes = 0;
+    int result = -1;
+    int i, n;
+
+    SDL_zeroa(ticks);
+    SDL_zeroa(total);
+
+    window = SDL_CreateWindow("testpresentbench", SDL_WINDOWPOS_UNDEFINED,
+                              SDL_WINDOWPOS_UNDEFINED, w, h, 0);
+    if (!window) {
+        SDL_Log("%s %s: SDL_CreateWindow: %s", driver, size_name, SDL_GetError());
+        return -1;
+    }
+    screen = SDL_GetWindowSurface(window);
+    if (!screen) {
+        SDL_Log("%s %s: SDL_GetWindowSurface: %s", driver, size_name, SDL_GetError());
+        SDL_DestroyWindow(window);
+        return -1;
+    }
+    w = screen->w;
+    h = screen->h;
+
+    src = SDL_CreateRGBSurfaceWithFormat(0, w, h, 0, SDL_PIXELFORMAT_ARGB8888);
+    if (!src) {
+        SDL_Log("%s %s: SDL_CreateRGBSurfaceWithFormat: %s", driver, size_name, SDL_GetError());
+        SDL_DestroyWindow(window);
+        return -1;
+    }
+    SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_NONE);
+
+    for (i = 0; i < NUM_STAGES; i++) {
+        ticks[i] = (Uint64 *)SDL_malloc(frames * sizeof(Uint64));
+        if (!ticks[i]) {
+            SDL_Log("Out of memory");
+            goto done;
+        }
+    }
+
+    report_flips(driver, SDL_FALSE);
+
+    for (int frame = 0; frame < frames; frame++) {
+        const Uint32 color = 0xFF000000 | (frame * 0x00010305);
+        Uint64 start, now;
+
+        n = get_rects(rects, w, h, dirty, frame);
+
+        start = SDL_GetPerformanceCounter();
+        for (i = 0; i < n; i++) {
+            SDL_FillRect(src, &rects[i], color);
+        }
+        now = SDL_GetPerformanceCounter();
+        ticks[STAGE_FILL][frame] = now - start;
+
+        start = now;
+        for (i = 0; i < n; i++) {
+            SDL_Rect dst = rects[i];
+
+            if (SDL_BlitSurface(src, &rects[i], screen, &dst) < 0) {
+                SDL_Log("%s %s: SDL_BlitSurface: %s", driver, size_name, SDL_GetError());
+                goto done;
+            }
+        }
+        now = SDL_GetPerformanceCounter();
+        ticks[STAGE_CONVERT][frame] = now - start;
+
+        start = now;
+        if (SDL_UpdateWindowSurfaceRects(window, rects, n) < 0) {
+            SDL_Log("%s %s: SDL_UpdateWindowSurfaceRects: %s", driver, size_name, SDL_GetError());
+            goto done;
+        }
+        now = SDL_GetPerformanceCounter();
+        ticks[STAGE_PRESENT][frame] = now - start;
+
+        if (frame == 0) {
+            for (i = 0; i < n; i++) {
+                bytes += (size_t)rects[i].w * rects[i].h * 4;
+            }
+        }
+    }
+
+    SDL_Log("%s %s (%dx%d, %s), %s update of %d KB, %d frames:", driver,
+            size_name, w, h, SDL_GetPixelFormatName(screen->format->format),
+            dirty ? "dirty-rect" : "full", (int)(bytes / 1024), frames);
+    for (i = 0; i < NUM_STAGES; i++) {
+        for (int frame = 0; frame < frames; frame++) {
+            total[i] += ticks[i][frame];
+        }
+        SDL_qsort(ticks[i], frames, sizeof(Uint64), compare_ticks);
+        SDL_Log("    %-8s p50 %8.3f ms  p99 %8.3f ms  %8.1f MB/s", stage_names[i],
+                ticks_to_ms(ticks[i][frames / 2]),
+                ticks_to_ms(ticks[i][(frames - 1) * 99 / 100]),
+                total[i] ? bytes * frames / (ticks_to_ms(total[i]) * 1000.0) : 0.0);
+    }
+    report_flips(driver, SDL_TRUE);
+    result = 0;
+
+done:
+    for (i = 0; i < NUM_STAGES; i++) {
+        SDL_free(ticks[i]);
+    }
+    SDL_FreeSurface(src);
+    SDL_DestroyWindow(window);
+    return result;
+}
+
+static SDL_bool driver_available(const char *name)
+{
+    for (int i = 0; i < SDL_GetNumVideoDrivers(); i++) {
+        if (SDL_strcasecmp(SDL_GetVideoDriver(i), name) == 0) {
+            return SDL_TRUE;
+        }
+    }
+    return SDL_FALSE;
+}
+
+int main(int argc, char *argv[])
+{
+    const char *only_driver = NULL;
+    const char *only_size = NULL;
+    SDL_bool vsync = SDL_FALSE;
+    int result = 0;
+    int i, j;
+
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    for (i = 1; i < argc; i++) {
+        if (SDL_strcmp(argv[i], "--frames") == 0 && argv[i + 1]) {
+            frames = SDL_atoi(argv[++i]);
+            frames = SDL_max(frames, 1);
+        } else if (SDL_strcmp(argv[i], "--driver") == 0 && argv[i + 1]) {
+            only_driver = argv[++i];
+        } else if (SDL_strcmp(argv[i], "--size") == 0 && argv[i + 1]) {
+            only_size = argv[++i];
+        } else if (SDL_strcmp(argv[i], "--vsync") == 0) {
+            vsync = SDL_TRUE;
+        } else {
+            SDL_Log("Usage: %s [--frames N] [--driver dummy|offscreen|ps5] [--size 720p|1080p|4k] [--vsync]", argv[0]);
+            return 1;
+        }
+    }
+
+    /* Measure the cost of presenting rather than the display rate, and keep
+       PS5 windows the size asked for, scaled to the display */
+    SDL_SetHint(SDL_HINT_RENDER_VSYNC, vsync ? "1" : "0");
+    SDL_SetHint(SDL_HINT_PS5_WINDOW_SCALING, "nearest");
+
+    for (i = 0; i < SDL_arraysize(drivers); i++) {
+        if (only_driver && SDL_strcasecmp(only_driver, drivers[i]) != 0) {
+            continue;
+        }
+        if (!driver_available(drivers[i])) {
+            SDL_Log("%s: not built in, skipped", drivers[i]);
+            continue;
+        }
+        /* The dummy driver only comes up when asked for with the hint */
+        SDL_SetHint(SDL_HINT_VIDEODRIVER, drivers[i]);
+        if (SDL_VideoInit(drivers[i]) < 0) {
+            SDL_Log("%s: SDL_VideoInit: %s", drivers[i], SDL_GetError());
+            result = 1;
+            continue;
+        }
+        for (j = 0; j < SDL_arraysize(sizes); j++) {
+            if (only_size && SDL_strcasecmp(only_size, sizes[j].name) != 0) {
+                continue;
+            }
+            if (run(drivers[i], sizes[j].name, sizes[j].w, sizes[j].h, SDL_FALSE) < 0 ||
+                run(drivers[i], sizes[j].name, sizes[j].w, sizes[j].h, SDL_TRUE) < 0) {
+                result = 1;
+            }
+        }
+        SDL_VideoQuit();
+    }
+
+    SDL_Quit();
+
+    return result;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,617 @@
+/*
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Host-side test of the PS5 audio driver, against a mock of the
+   sceAudioOut and sceAudioIn functions it uses, and of the latency the
+   audio core reports, measured with the disk and dummy drivers. */
+
+#include "../src/SDL_internal.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "SDL.h"
+
+#define SDL_PS5_HOST_TEST 1
+#include "../src/audio/ps5/SDL_ps5audio.c"
+
+#define RAW_FILE "testps5audio.raw"
+
+/* Capture times of the last grains the mock input port returned */
+#define GRAIN_TIMES 1024
+
+static struct
+{
+    int open_ports;
+    uint32_t len;
+    uint32_t freq;
+    uint32_t param;
+    int outputs;
+    const void *last_output;
+
+    int open_in_ports;
+    uint32_t in_type;
+    uint32_t in_len;
+    uint32_t in_freq;
+    uint32_t in_param;
+    SDL_bool in_fail;
+    Uint64 in_start;
+    /* Each frame captured holds the low bits of its number */
+    SDL_atomic_t in_frames;
+    Uint64 grain_times[GRAIN_TIMES];
+} mock;
+
+int32_t sceAudioOutInit(void)
+{
+    return 0;
+}
+
+int32_t sceAudioOutOpen(int32_t userId, int32_t type, int32_t index,
+                        uint32_t len, uint32_t freq, uint32_t param)
+{
+    mock.open_ports++;
+    mock.len = len;
+    mock.freq = freq;
+    mock.param = param;
+    return 1;
+}
+
+int32_t sceAudioOutOutput(int32_t handle, const void *p)
+{
+    if (p) {
+        mock.outputs++;
+        mock.last_output = p;
+    }
+    return 0;
+}
+
+int32_t sceAudioOutClose(int32_t handle)
+{
+    mock.open_ports--;
+    return 0;
+}
+
+int sceUserServiceInitialize(void *params)
+{
+    return 0;
+}
+
+int sceUserServiceGetForegroundUser(int *user_id)
+{
+    *user_id = 0x1234;
+    return 0;
+}
+
+int32_t sceAudioInOpen(int32_t userId, uint32_t type, uint32_t index,
+                       uint32_t len, uint32_t freq, uint32_t param)
+{
+    mock.open_in_ports++;
+    mock.in_type = type;
+    mock.in_len = len;
+    mock.in_freq = freq;
+    mock.in_param = param;
+    mock.in_start = SDL_GetPerformanceCounter();
+    SDL_AtomicSet(&mock.in_frames, 0);
+    return 2;
+}
+
+/* Returns each grain once the hardware would have captured all of it */
+int32_t sceAudioInInput(int32_t handle, void *dest)
+{
+    const int channels = (mock.in_param == PROSPERO_AUDIO_IN_PARAM_FORMAT_S16_MONO) ? 1 : 2;
+    const Uint32 first = (Uint32)SDL_AtomicGet(&mock.in_frames);
+    const Uint64 done = mock.in_start + (Uint64)(first + mock.in_len) * SDL_GetPerformanceFrequency() / mock.in_freq;
+    Sint16 *samples = (Sint16 *)dest;
+    Uint64 now;
+    uint32_t i;
+    int c;
+
+    if (mock.in_fail) {
+        return (int32_t)0x80260009;
+    }
+    while ((now = SDL_GetPerformanceCounter()) < done) {
+        SDL_Delay(1);
+    }
+    for (i = 0; i < mock.in_len; i++) {
+        for (c = 0; c < channels; c++) {
+            *samples++ = (Sint16)(first + i);
+        }
+    }
+    mock.grain_times[(first / mock.in_len) % GRAIN_TIMES] = now;
+    SDL_AtomicSet(&mock.in_frames, (int)(first + mock.in_len));
+    return (int32_t)mock.in_len;
+}
+
+int32_t sceAudioInClose(int32_t handle)
+{
+    mock.open_in_ports--;
+    return 0;
+}
+
+#define CHECK(cond)                                              \
+    if (!(cond)) {                                               \
+        SDL_Log("%s:%d: check failed: %s", __FILE__, __LINE__, #cond); \
+        return -1;                                               \
+    }
+
+static int open_ps5_at(SDL_AudioDevice *device, int freq, Uint16 samples)
+{
+    SDL_zerop(device);
+    device->spec.freq = freq;
+    device->spec.format = AUDIO_S16LSB;
+    device->spec.channels = 2;
+    device->spec.samples = samples;
+    return PS5AUDIO_OpenDevice(device, NULL);
+}
+
+static int open_ps5(SDL_AudioDevice *device, Uint16 samples)
+{
+    return open_ps5_at(device, 22050, samples);
+}
+
+static void close_ps5(SDL_AudioDevice *device)
+{
+    PS5AUDIO_CloseDevice(device);
+    SDL_free(device->hidden);
+}
+
+static int open_capture(SDL_AudioDevice *device, int freq, Uint8 channels)
+{
+    SDL_zerop(device);
+    device->iscapture = SDL_TRUE;
+    device->spec.freq = freq;
+    device->spec.format = AUDIO_F32SYS;
+    device->spec.channels = channels;
+    device->spec.samples = 4096;
+    return PS5AUDIO_OpenDevice(device, NULL);
+}
+
+/* Capture 'frames' frames, 'chunk' bytes at a time, and check that they
+   follow on from the frame numbered 'next', with none missing. Returns
+   the number of the frame after them, or -1 if there was a gap. */
+static Sint64 capture_frames(SDL_AudioDevice *device, Uint32 next, int frames, int chunk)
+{
+    const int channels = device->spec.channels;
+    const int frame_size = channels * (int)sizeof(Sint16);
+    Sint16 *buffer = (Sint16 *)SDL_malloc(chunk);
+    int got, i, c;
+
+    CHECK(buffer != NULL);
+    while (frames > 0) {
+        got = PS5AUDIO_CaptureFromDevice(device, buffer, SDL_min(chunk, frames * frame_size));
+        CHECK(got > 0 && got % frame_size == 0);
+        for (i = 0; i < got / frame_size; i++, next++) {
+            for (c = 0; c < channels; c++) {
+                if (buffer[i * channels + c] != (Sint16)next) {
+                    SDL_Log("frame %u: got %d", (unsigned)next, buffer[i * channels + c]);
+                    SDL_free(buffer);
+                    return -1;
+                }
+            }
+        }
+        frames -= got / frame_size;
+    }
+    SDL_free(buffer);
+    return next;
+}
+
+/* Low rates get a voice chat port, the others one at the hardware's rate */
+static int test_capture_spec(void)
+{
+    SDL_AudioDevice device;
+
+    CHECK(open_capture(&device, 8000, 2) == 0);
+    CHECK(device.spec.freq == 16000);
+    CHECK(device.spec.channels == 1);
+    CHECK(device.spec.format == AUDIO_S16LSB);
+    CHECK(device.spec.samples == PS5AUDIO_CAPTURE_GRAIN);
+    CHECK(mock.in_type == PROSPERO_AUDIO_IN_TYPE_VOICE_CHAT);
+    CHECK(mock.in_freq == 16000);
+    CHECK(mock.in_len == PS5AUDIO_CAPTURE_GRAIN);
+    CHECK(mock.in_param == PROSPERO_AUDIO_IN_PARAM_FORMAT_S16_MONO);
+    close_ps5(&device);
+
+    CHECK(open_capture(&device, 44100, 6) == 0);
+    CHECK(device.spec.freq == 48000);
+    CHECK(device.spec.channels == 2);
+    CHECK(device.spec.size == PS5AUDIO_CAPTURE_GRAIN * 4);
+    CHECK(mock.in_type == PROSPERO_AUDIO_IN_TYPE_GENERAL);
+    CHECK(mock.in_freq == 48000);
+    CHECK(mock.in_param == PROSPERO_AUDIO_IN_PARAM_FORMAT_S16_STEREO);
+    close_ps5(&device);
+    CHECK(mock.open_in_ports == 0);
+
+    return 0;
+}
+
+/* Every frame comes out once and in order, however it is read */
+static int test_capture_sequence(void)
+{
+    SDL_AudioDevice device;
+    Sint64 next = 0;
+    int chunk;
+
+    CHECK(open_capture(&device, 48000, 2) == 0);
+    for (chunk = 4; chunk <= 4096; chunk *= 4) {
+        next = capture_frames(&device, (Uint32)next, PS5AUDIO_CAPTURE_GRAIN * 8 + 100, chunk);
+        CHECK(next >= 0);
+    }
+    CHECK(SDL_AtomicGet(&device.hidden->overruns) == 0);
+    close_ps5(&device);
+
+    return 0;
+}
+
+/* A full ring keeps its grains and drops the new ones, a flush drops
+   everything captured up to then */
+static int test_capture_overrun(void)
+{
+    SDL_AudioDevice device;
+    const int grain_ms = PS5AUDIO_CAPTURE_GRAIN * 1000 / 48000;
+    Sint16 frame[2];
+    Uint32 flushed;
+
+    CHECK(open_capture(&device, 48000, 2) == 0);
+    SDL_Delay(grain_ms * (PS5AUDIO_CAPTURE_GRAINS + 4));
+    CHECK(SDL_AtomicGet(&device.hidden->overruns) > 0);
+    CHECK(capture_frames(&device, 0, PS5AUDIO_CAPTURE_GRAIN * PS5AUDIO_CAPTURE_GRAINS, 1024) >= 0);
+    CHECK(PS5AUDIO_CaptureFromDevice(&device, frame, sizeof(frame)) == sizeof(frame));
+    CHECK((Uint16)frame[0] > PS5AUDIO_CAPTURE_GRAIN * PS5AUDIO_CAPTURE_GRAINS);
+
+    /* The rest of the grain being read goes too */
+    SDL_Delay(grain_ms * 4);
+    flushed = (Uint32)SDL_AtomicGet(&mock.in_frames);
+    PS5AUDIO_FlushCapture(&device);
+    CHECK(device.hidden->grain_offset == 0);
+    CHECK(PS5AUDIO_CaptureFromDevice(&device, frame, sizeof(frame)) == sizeof(frame));
+    CHECK((Uint16)frame[0] == (Uint16)(flushed - PS5AUDIO_CAPTURE_GRAIN) || (Uint16)frame[0] >= (Uint16)flushed);
+    close_ps5(&device);
+
+    return 0;
+}
+
+/* A port that stops working ends the capture instead of hanging it, with
+   the error of the port, once what it captured before has been read */
+static int test_capture_failure(void)
+{
+    SDL_AudioDevice device;
+    Sint16 frame[2];
+
+    CHECK(open_capture(&device, 48000, 2) == 0);
+    mock.in_fail = SDL_TRUE;
+    while (PS5AUDIO_CaptureFromDevice(&device, frame, sizeof(frame)) > 0) {
+    }
+    CHECK(SDL_AtomicGet(&device.hidden->input_error) == (int)0x80260009);
+    CHECK(SDL_AtomicGet(&device.hidden->grains_written) == SDL_AtomicGet(&device.hidden->grains_read));
+    CHECK(SDL_strcmp(SDL_GetError(), "sceAudioInInput: 0x80260009") == 0);
+    CHECK(PS5AUDIO_CaptureFromDevice(&device, frame, sizeof(frame)) < 0);
+    close_ps5(&device);
+    mock.in_fail = SDL_FALSE;
+    CHECK(mock.open_in_ports == 0);
+
+    return 0;
+}
+
+/* Time from a grain being captured to it reaching the app, reading a
+   buffer at a time the way SDL_CaptureAudio does */
+static int benchmark_capture(int freq)
+{
+    SDL_AudioDevice device;
+    Uint8 *buffer;
+    Uint64 total = 0, worst = 0, latency;
+    Uint32 next = 0;
+    int buffers, got, pos, last;
+
+    CHECK(open_capture(&device, freq, 2) == 0);
+    buffer = (Uint8 *)SDL_malloc(device.spec.size);
+    CHECK(buffer != NULL);
+
+    buffers = device.spec.freq / device.spec.samples;
+    for (pos = 0; pos < buffers; pos++) {
+        for (got = 0; got < (int)device.spec.size;) {
+            last = PS5AUDIO_CaptureFromDevice(&device, buffer + got, device.spec.size - got);
+            CHECK(last > 0);
+            got += last;
+        }
+        next += device.spec.samples;
+        latency = SDL_GetPerformanceCounter() - mock.grain_times[((next - 1) / PS5AUDIO_CAPTURE_GRAIN) % GRAIN_TIMES];
+        total += latency;
+        worst = SDL_max(worst, latency);
+    }
+    CHECK(SDL_AtomicGet(&device.hidden->overruns) == 0);
+
+    SDL_Log("Capture at %d Hz: %.3f ms average, %.3f ms worst from capture to callback",
+            device.spec.freq, (double)total * 1000.0 / SDL_GetPerformanceFrequency() / buffers,
+            (double)worst * 1000.0 / SDL_GetPerformanceFrequency());
+    /* The audio thread never waits behind a grain that is ready */
+    CHECK(worst * 1000 / SDL_GetPerformanceFrequency() < 50);
+
+    SDL_free(buffer);
+    close_ps5(&device);
+    return 0;
+}
+
+/* The hint overrides the buffer size asked for */
+static int test_low_latency(void)
+{
+    SDL_AudioDevice device;
+
+    SDL_SetHint(SDL_HINT_PS5_AUDIO_LOW_LATENCY, "0");
+    CHECK(open_ps5(&device, 4096) == 0);
+    CHECK(device.spec.samples == 2048);
+    CHECK(mock.len == 2048);
+    CHECK(!device.hidden->low_latency);
+    close_ps5(&device);
+
+    SDL_SetHint(SDL_HINT_PS5_AUDIO_LOW_LATENCY, "1");
+    CHECK(open_ps5(&device, 4096) == 0);
+    CHECK(device.spec.samples == PS5AUDIO_MIN_SAMPLES);
+    CHECK(mock.len == PS5AUDIO_MIN_SAMPLES);
+    CHECK(device.spec.size == PS5AUDIO_MIN_SAMPLES * 4);
+    CHECK(device.hidden->low_latency);
+    close_ps5(&device);
+    CHECK(mock.open_ports == 0);
+
+    SDL_SetHint(SDL_HINT_PS5_AUDIO_LOW_LATENCY, NULL);
+    return 0;
+}
+
+/* Output slots of each channel of SDL's layouts in the 8 channel output,
+   FL FR FC LFE BL BR SL SR, -1 for the silent ones */
+static const struct
+{
+    Uint8 channels;
+    int channel_of_slot[8];
+} layouts[] = {
+    { 3, { 0, 1, -1, 2, -1, -1, -1, -1 } }, /* FL FR LFE */
+    { 6, { 0, 1, 2, 3, -1, -1, 4, 5 } },    /* FL FR FC LFE SL SR */
+    { 7, { 0, 1, 2, 3, 4, 4, 5, 6 } },      /* FL FR FC LFE BC SL SR */
+    { 8, { 0, 1, 2, 3, 4, 5, 6, 7 } },
+};
+
+/* Sample of channel 'c' of frame 'i' in test_channels() */
+#define CHANNEL_SAMPLE(i, c) ((i) * 16 + (c) + 1)
+
+/* 3 to 8 channels keep their spec, and each channel comes out in its slot
+   of the 8 channel output */
+static int test_channels(void)
+{
+    static const SDL_AudioFormat formats[] = { AUDIO_S16LSB, AUDIO_F32LSB };
+    SDL_AudioDevice device;
+    const int samples = 512;
+    int f, l, i, c, slot;
+
+    for (f = 0; f < SDL_arraysize(formats); f++) {
+        for (l = 0; l < SDL_arraysize(layouts); l++) {
+            const int channels = layouts[l].channels;
+            Uint8 *mixbuf;
+
+            SDL_zero(device);
+            device.spec.freq = 48000;
+            device.spec.format = formats[f];
+            device.spec.channels = channels;
+            device.spec.samples = samples;
+            CHECK(PS5AUDIO_OpenDevice(&device, NULL) == 0);
+            CHECK(device.spec.channels == channels);
+            CHECK(device.spec.format == formats[f]);
+            CHECK(mock.len == samples);
+            CHECK(mock.param == ((formats[f] == AUDIO_S16LSB) ? PROSPERO_AUDIO_OUT_PARAM_FORMAT_S16_8CH_STD
+                                                               : PROSPERO_AUDIO_OUT_PARAM_FORMAT_FLOAT_8CH_STD));
+
+            mixbuf = PS5AUDIO_GetDeviceBuf(&device);
+            for (i = 0; i < samples; i++) {
+                for (c = 0; c < channels; c++) {
+                    if (formats[f] == AUDIO_S16LSB) {
+                        ((Sint16 *)mixbuf)[i * channels + c] = (Sint16)CHANNEL_SAMPLE(i, c);
+                    } else {
+                        ((float *)mixbuf)[i * channels + c] = (float)CHANNEL_SAMPLE(i, c);
+                    }
+                }
+            }
+            PS5AUDIO_PlayDevice(&device);
+
+            for (i = 0; i < samples; i++) {
+                for (slot = 0; slot < 8; slot++) {
+                    const int channel = layouts[l].channel_of_slot[slot];
+                    const int expected = (channel < 0) ? 0 : CHANNEL_SAMPLE(i, channel);
+                    int actual;
+
+                    if (formats[f] == AUDIO_S16LSB) {
+                        actual = ((const Sint16 *)mock.last_output)[i * 8 + slot];
+                    } else {
+                        actual = (int)((const float *)mock.last_output)[i * 8 + slot];
+                    }
+                    if (actual != expected) {
+                        SDL_Log("%s, %d channels: frame %d slot %d is %d, not %d",
+                                (formats[f] == AUDIO_S16LSB) ? "S16" : "F32",
+                                channels, i, slot, actual, expected);
+                        close_ps5(&device);
+                        return -1;
+                    }
+                }
+            }
+            close_ps5(&device);
+        }
+    }
+    CHECK(mock.open_ports == 0);
+
+    return 0;
+}
+
+/* The buffer output last counts down as it plays */
+static int test_pending(void)
+{
+    SDL_AudioDevice device;
+    int pending;
+
+    CHECK(open_ps5(&device, 1024) == 0);
+    CHECK(PS5AUDIO_GetPendingFrames(&device) == 0);
+
+    PS5AUDIO_PlayDevice(&device);
+    CHECK(mock.outputs == 1);
+    pending = PS5AUDIO_GetPendingFrames(&device);
+    CHECK(pending > 0 && pending <= 1024);
+
+    SDL_Delay(10);
+    CHECK(PS5AUDIO_GetPendingFrames(&device) < pending);
+
+    SDL_Delay(1024 * 1000 / 48000);
+    CHECK(PS5AUDIO_GetPendingFrames(&device) == 0);
+
+    close_ps5(&device);
+    return 0;
+}
+
+/* 44.1 kHz stays in the device's spec, and comes out at 48 kHz */
+static int test_resample(void)
+{
+    SDL_AudioDevice device;
+    const int samples = 1024;
+    const int buffers = 147; /* that make 160 at 48 kHz */
+    const float amplitude = 16000.0f / 32768.0f;
+    const float *out;
+    float error = 0.0f;
+    int frame = 0;
+    int i, j, first;
+
+    mock.outputs = 0;
+    CHECK(open_ps5_at(&device, 44100, samples) == 0);
+    CHECK(device.spec.freq == 44100);
+    CHECK(device.spec.format == AUDIO_S16LSB);
+    CHECK(mock.freq == 48000);
+    CHECK(mock.param == PROSPERO_AUDIO_OUT_PARAM_FORMAT_FLOAT_STEREO);
+
+    /* A 1 kHz sine, both channels */
+    for (i = 0; i < buffers; i++) {
+        Sint16 *mixbuf = (Sint16 *)PS5AUDIO_GetDeviceBuf(&device);
+        for (j = 0; j < samples; j++, frame++) {
+            mixbuf[j * 2] = mixbuf[j * 2 + 1] = (Sint16)(16000.0 * SDL_sin(2.0 * M_PI * 1000.0 * frame / 44100.0));
+        }
+        PS5AUDIO_PlayDevice(&device);
+    }
+
+    /* The last few frames are held back until more input comes */
+    CHECK(mock.outputs == 159 || mock.outputs == 160);
+    CHECK(device.hidden->resampled_frames + mock.outputs * samples > 160 * samples - 64);
+    CHECK(PS5AUDIO_GetPendingFrames(&device) > 0);
+
+    out = (const float *)mock.last_output;
+    first = (mock.outputs - 1) * samples;
+    for (j = 0; j < samples; j++) {
+        const float expected = amplitude * (float)SDL_sin(2.0 * M_PI * 1000.0 * (first + j) / 48000.0);
+        CHECK(out[j * 2] == out[j * 2 + 1]);
+        error = SDL_max(error, SDL_fabsf(out[j * 2] - expected));
+    }
+    CHECK(error < 0.001f);
+
+    close_ps5(&device);
+    return 0;
+}
+
+/* Queued audio is reported in full while paused, then drains at the
+   rate of the device */
+static int test_queued(const char *driver)
+{
+    SDL_AudioSpec spec;
+    SDL_AudioDeviceID dev;
+    Sint16 *silence;
+    int latency, last;
+    Uint64 start;
+
+    SDL_setenv("SDL_DISKAUDIOFILE", RAW_FILE, 1);
+    CHECK(SDL_AudioInit(driver) == 0);
+
+    SDL_zero(spec);
+    spec.freq = 48000;
+    spec.format = AUDIO_S16SYS;
+    spec.channels = 2;
+    spec.samples = 1024;
+    dev = SDL_OpenAudioDevice(NULL, 0, &spec, NULL, 0);
+    CHECK(dev != 0);
+    CHECK(SDL_GetAudioDeviceQueuedFrames(dev) == 0);
+
+    silence = (Sint16 *)SDL_calloc(48000, 2 * sizeof(Sint16));
+    CHECK(silence != NULL);
+    CHECK(SDL_QueueAudio(dev, silence, 48000 * 2 * sizeof(Sint16)) == 0);
+    SDL_free(silence);
+    CHECK(SDL_GetAudioDeviceQueuedFrames(dev) == 48000);
+
+    SDL_PauseAudioDevice(dev, 0);
+    start = SDL_GetTicks64();
+    last = 48000;
+    do {
+        SDL_Delay(100);
+        latency = SDL_GetAudioDeviceQueuedFrames(dev);
+        CHECK(latency <= last);
+        last = latency;
+    } while (latency > 0 && SDL_GetTicks64() - start < 5000);
+    CHECK(latency == 0);
+    /* A second of audio can't be gone much sooner than a second */
+    CHECK(SDL_GetTicks64() - start >= 900);
+
+    SDL_CloseAudioDevice(dev);
+    CHECK(SDL_GetAudioDeviceQueuedFrames(dev) == -1);
+    SDL_AudioQuit();
+
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    int result = 0;
+
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    if (test_low_latency() < 0) {
+        result = 1;
+    }
+    if (test_pending() < 0) {
+        result = 1;
+    }
+    if (test_channels() < 0) {
+        result = 1;
+    }
+    if (test_resample() < 0) {
+        result = 1;
+    }
+    if (test_capture_spec() < 0) {
+        result = 1;
+    }
+    if (test_capture_sequence() < 0) {
+        result = 1;
+    }
+    if (test_capture_overrun() < 0) {
+        result = 1;
+    }
+    if (test_capture_failure() < 0) {
+        result = 1;
+    }
+    if (benchmark_capture(16000) < 0) {
+        result = 1;
+    }
+    if (benchmark_capture(48000) < 0) {
+        result = 1;
+    }
+    if (test_queued("disk") < 0) {
+        result = 1;
+    }
+    if (test_queued("dummy") < 0) {
+        result = 1;
+    }
+    remove(RAW_FILE);
+
+    SDL_Log("%s", result ? "FAILED" : "OK");
+
+    return result;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,822 @@
+/*
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Host-side test of the PS5 joystick driver, against a mock of the scePad
+   and sceUserService functions it uses. The mock pad's state is set by
+   the test, and read by the driver whenever it calls scePadReadState.
+   Users log in and out through a mock of the user service events. */
+
+#include "../src/SDL_internal.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "SDL.h"
+
+#define SDL_PS5_HOST_TEST 1
+#include "../src/joystick/ps5/SDL_ps5joystick.c"
+
+#define FRAME_MS 33 /* a 30 fps game */
+
+extern char SDL_joystick_magic;
+
+static struct
+{
+    SDL_SpinLock lock;
+    PS5_PadData pad;
+    int open_pads;
+    int motion;
+    SDL_atomic_t reads;
+    int vibrations;
+    PS5_PadVibrationParam vibration;
+    int lightbars;
+    PS5_PadLightBarParam lightbar;
+    int trigger_effects;
+    PS5_PadTriggerEffectParam trigger_effect;
+    int users[PS5_MAX_USERS];
+    int user_lists;
+    PS5_UserServiceEvent events[8];
+    int nevents;
+} mock;
+
+int scePadInit(void)
+{
+    return 0;
+}
+
+int scePadOpen(int user_id, int type, int index, void *param)
+{
+    mock.open_pads++;
+    return 0x100 + user_id;
+}
+
+int scePadReadState(int handle, PS5_PadData *data)
+{
+    SDL_AtomicLock(&mock.lock);
+    *data = mock.pad;
+    SDL_AtomicUnlock(&mock.lock);
+    SDL_AtomicIncRef(&mock.reads);
+    return 0;
+}
+
+int scePadSetMotionSensorState(int handle, uint8_t enable)
+{
+    mock.motion = enable;
+    return 0;
+}
+
+int scePadSetVibration(int handle, const PS5_PadVibrationParam *param)
+{
+    mock.vibrations++;
+    mock.vibration = *param;
+    return 0;
+}
+
+int scePadSetLightBar(int handle, const PS5_PadLightBarParam *param)
+{
+    mock.lightbars++;
+    mock.lightbar = *param;
+    return 0;
+}
+
+int scePadSetTriggerEffect(int handle, const PS5_PadTriggerEffectParam *param)
+{
+    mock.trigger_effects++;
+    mock.trigger_effect = *param;
+    return 0;
+}
+
+int scePadClose(int handle)
+{
+    mock.open_pads--;
+    return 0;
+}
+
+int sceUserServiceInitialize(void *params)
+{
+    return 0;
+}
+
+int sceUserServiceGetLoginUserIdList(int user_ids[4])
+{
+    SDL_memcpy(user_ids, mock.users, sizeof(mock.users));
+    mock.user_lists++;
+    return 0;
+}
+
+int sceUserServiceGetEvent(PS5_UserServiceEvent *event)
+{
+    if (mock.nevents == 0) {
+        return 0x80960007; /* no event */
+    }
+    *event = mock.events[0];
+    SDL_memmove(mock.events, mock.events + 1, --mock.nevents * sizeof(*event));
+    return 0;
+}
+
+#define CHECK(cond)                                              \
+    if (!(cond)) {                                               \
+        SDL_Log("%s:%d: check failed: %s", __FILE__, __LINE__, #cond); \
+        return -1;                                               \
+    }
+
+static void set_buttons(uint32_t buttons)
+{
+    SDL_AtomicLock(&mock.lock);
+    mock.pad.buttons = buttons;
+    mock.pad.leftStick.x = mock.pad.leftStick.y = 128;
+    mock.pad.rightStick.x = mock.pad.rightStick.y = 128;
+    SDL_AtomicUnlock(&mock.lock);
+}
+
+/* What SDL_JoystickOpen() would set up, without the driver list */
+static int open_pad(SDL_Joystick *joystick, SDL_bool threaded)
+{
+    SDL_SetHint(SDL_HINT_PS5_JOYSTICK_THREAD, threaded ? "1" : "0");
+    set_buttons(0);
+    if (SDL_PS5_JoystickDriver.Init() < 0) {
+        return -1;
+    }
+
+    SDL_zerop(joystick);
+    joystick->magic = &SDL_joystick_magic;
+    SDL_LockJoysticks();
+    if (SDL_PS5_JoystickDriver.Open(joystick, 0) < 0) {
+        SDL_UnlockJoysticks();
+        return -1;
+    }
+    SDL_UnlockJoysticks();
+    joystick->axes = (SDL_JoystickAxisInfo *)SDL_calloc(joystick->naxes, sizeof(*joystick->axes));
+    joystick->buttons = (Uint8 *)SDL_calloc(joystick->nbuttons, sizeof(*joystick->buttons));
+    joystick->hats = (Uint8 *)SDL_calloc(joystick->nhats, sizeof(*joystick->hats));
+    if (!joystick->axes || !joystick->buttons || !joystick->hats) {
+        return SDL_OutOfMemory();
+    }
+    SDL_FlushEvents(SDL_FIRSTEVENT, SDL_LASTEVENT);
+    return 0;
+}
+
+static void close_pad(SDL_Joystick *joystick)
+{
+    SDL_PS5_JoystickDriver.Close(joystick);
+    SDL_PS5_JoystickDriver.Quit();
+    SDL_free(joystick->axes);
+    SDL_free(joystick->buttons);
+    SDL_free(joystick->hats);
+    SDL_free(joystick->touchpads[0].fingers);
+    SDL_free(joystick->touchpads);
+    SDL_free(joystick->sensors);
+    SDL_SetHint(SDL_HINT_PS5_JOYSTICK_THREAD, NULL);
+}
+
+static void update_pad(SDL_Joystick *joystick)
+{
+    SDL_LockJoysticks();
+    SDL_PS5_JoystickDriver.Update(joystick);
+    SDL_UnlockJoysticks();
+}
+
+static void detect_pads(void)
+{
+    SDL_LockJoysticks();
+    SDL_PS5_JoystickDriver.Detect();
+    SDL_UnlockJoysticks();
+}
+
+/* A user logging in or out, and the event for it */
+static void set_user(int slot, int user_id, Sint32 type)
+{
+    const int previous = mock.users[slot];
+
+    mock.users[slot] = user_id;
+    mock.events[mock.nevents].eventType = type;
+    mock.events[mock.nevents].userId = (type == PS5_USER_SERVICE_EVENT_TYPE_LOGIN) ? user_id : previous;
+    mock.nevents++;
+}
+
+static void set_connected(uint8_t connected)
+{
+    SDL_AtomicLock(&mock.lock);
+    mock.pad.connected = connected;
+    SDL_AtomicUnlock(&mock.lock);
+}
+
+/* The instance of the last device removed since the last call, or -1 */
+static SDL_JoystickID removed_device(void)
+{
+    SDL_Event event;
+    SDL_JoystickID which = -1;
+
+    while (SDL_PeepEvents(&event, 1, SDL_GETEVENT, SDL_JOYDEVICEREMOVED, SDL_JOYDEVICEREMOVED) == 1) {
+        which = event.jdevice.which;
+    }
+    return which;
+}
+
+/* Count the presses and releases of 'button' since the last call */
+static int count_button_events(Uint8 button, int *down, int *up)
+{
+    SDL_Event event;
+
+    *down = *up = 0;
+    while (SDL_PeepEvents(&event, 1, SDL_GETEVENT, SDL_JOYBUTTONDOWN, SDL_JOYBUTTONUP) == 1) {
+        if (event.jbutton.button != button) {
+            continue;
+        }
+        if (event.type == SDL_JOYBUTTONDOWN) {
+            /* Every press is followed by its release */
+            CHECK(*down == *up);
+            ++*down;
+        } else {
+            CHECK(*down == *up + 1);
+            ++*up;
+        }
+    }
+    return 0;
+}
+
+/* Taps shorter than a frame, each starting at a different point of one */
+static int tap_per_frame(SDL_Joystick *joystick, int taps, int *caught)
+{
+    int down, up, i;
+
+    *caught = 0;
+    for (i = 0; i < taps; i++) {
+        const Uint32 offset = (i * 7) % (FRAME_MS - 10);
+
+        update_pad(joystick);
+        SDL_Delay(offset);
+        set_buttons(PS5_PAD_BUTTON_CROSS);
+        SDL_Delay(8);
+        set_buttons(0);
+        SDL_Delay(FRAME_MS - 8 - offset);
+        update_pad(joystick);
+
+        CHECK(count_button_events(0, &down, &up) == 0);
+        CHECK(down == up);
+        *caught += down;
+    }
+    return 0;
+}
+
+/* Polling sees the state of the pad at each update and nothing between */
+static int test_polling(void)
+{
+    SDL_Joystick joystick;
+    int down, up;
+
+    CHECK(open_pad(&joystick, SDL_FALSE) == 0);
+    CHECK(pad_thread == NULL);
+    CHECK(mock.open_pads == 1);
+
+    set_buttons(PS5_PAD_BUTTON_CROSS);
+    update_pad(&joystick);
+    CHECK(count_button_events(0, &down, &up) == 0);
+    CHECK(down == 1 && up == 0);
+    CHECK(joystick.buttons[0] == SDL_PRESSED);
+
+    /* Released and pressed again between updates */
+    set_buttons(0);
+    set_buttons(PS5_PAD_BUTTON_CROSS);
+    update_pad(&joystick);
+    CHECK(count_button_events(0, &down, &up) == 0);
+    CHECK(down == 0 && up == 0);
+
+    close_pad(&joystick);
+    CHECK(mock.open_pads == 0);
+    return 0;
+}
+
+/* The hat of the events since the last call, or -1 if there is none */
+static int last_hat(void)
+{
+    SDL_Event event;
+    int hat = -1;
+
+    while (SDL_PeepEvents(&event, 1, SDL_GETEVENT, SDL_JOYHATMOTION, SDL_JOYHATMOTION) == 1) {
+        hat = event.jhat.value;
+    }
+    return hat;
+}
+
+/* Every scePad button comes out as its SDL button, and the hat follows
+   the whole d-pad */
+static int test_buttons(void)
+{
+    SDL_Joystick joystick;
+    int down, up, i;
+
+    CHECK(open_pad(&joystick, SDL_FALSE) == 0);
+
+    for (i = 0; i < SDL_arraysize(btn_map); i++) {
+        if (!btn_map[i]) {
+            continue;
+        }
+        set_buttons(btn_map[i]);
+        update_pad(&joystick);
+        CHECK(joystick.buttons[i] == SDL_PRESSED);
+        set_buttons(0);
+        update_pad(&joystick);
+        CHECK(count_button_events((Uint8)i, &down, &up) == 0);
+        CHECK(down == 1 && up == 1);
+    }
+    SDL_FlushEvents(SDL_FIRSTEVENT, SDL_LASTEVENT);
+
+    set_buttons(PS5_PAD_BUTTON_UP);
+    update_pad(&joystick);
+    CHECK(last_hat() == SDL_HAT_UP);
+    set_buttons(PS5_PAD_BUTTON_UP | PS5_PAD_BUTTON_RIGHT);
+    update_pad(&joystick);
+    CHECK(last_hat() == SDL_HAT_RIGHTUP);
+    set_buttons(PS5_PAD_BUTTON_RIGHT);
+    update_pad(&joystick);
+    CHECK(last_hat() == SDL_HAT_RIGHT);
+
+    /* Other buttons leave the hat alone */
+    set_buttons(PS5_PAD_BUTTON_RIGHT | PS5_PAD_BUTTON_CROSS);
+    update_pad(&joystick);
+    CHECK(last_hat() == -1);
+    CHECK(joystick.hats[0] == SDL_HAT_RIGHT);
+
+    set_buttons(0);
+    update_pad(&joystick);
+    CHECK(last_hat() == SDL_HAT_CENTERED);
+
+    close_pad(&joystick);
+    return 0;
+}
+
+/* The input thread keeps every change for the next update, in order */
+static int test_thread(void)
+{
+    SDL_Joystick joystick;
+    int down, up, i;
+
+    CHECK(open_pad(&joystick, SDL_TRUE) == 0);
+    CHECK(pad_thread != NULL);
+
+    /* Only the state at the open differs from the one sent last */
+    SDL_Delay(PS5_PAD_SAMPLE_INTERVAL * 5);
+    CHECK(SDL_AtomicGet(&mock.reads) > 0);
+    CHECK(SDL_AtomicGet(&pad_ctx[0].ring_head) == 1);
+
+    for (i = 0; i < 3; i++) {
+        set_buttons(PS5_PAD_BUTTON_CROSS);
+        SDL_Delay(PS5_PAD_SAMPLE_INTERVAL * 5);
+        set_buttons(0);
+        SDL_Delay(PS5_PAD_SAMPLE_INTERVAL * 5);
+    }
+    update_pad(&joystick);
+    CHECK(count_button_events(0, &down, &up) == 0);
+    CHECK(down == 3 && up == 3);
+    CHECK(joystick.buttons[0] == SDL_RELEASED);
+    CHECK(joystick.axes[PS5_PAD_AXIS_LX].value == analog_map[128]);
+
+    /* Changes that don't fit are put off, the latest state isn't lost */
+    SDL_AtomicSet(&pad_ctx[0].overflows, 0);
+    for (i = 0; i < PS5_PAD_RING_SIZE * 2; i++) {
+        set_buttons((i & 1) ? 0 : PS5_PAD_BUTTON_SQUARE);
+        SDL_Delay(PS5_PAD_SAMPLE_INTERVAL * 3);
+    }
+    CHECK(SDL_AtomicGet(&pad_ctx[0].overflows) > 0);
+    update_pad(&joystick);
+    CHECK(count_button_events(2, &down, &up) == 0);
+    CHECK(down > 0 && down <= PS5_PAD_RING_SIZE / 2);
+    SDL_Delay(PS5_PAD_SAMPLE_INTERVAL * 5);
+    update_pad(&joystick);
+    CHECK(joystick.buttons[2] == SDL_RELEASED);
+
+    close_pad(&joystick);
+    CHECK(pad_thread == NULL);
+    CHECK(mock.open_pads == 0);
+    return 0;
+}
+
+/* Wait for the input thread to see the last change, if there is one */
+static void sample_pad(SDL_bool threaded)
+{
+    if (threaded) {
+        SDL_Delay(PS5_PAD_SAMPLE_INTERVAL * 5);
+    }
+}
+
+/* Pads come and go with their users, and with their connection, without
+   the login list being queried on every detect */
+static int test_hotplug(SDL_bool threaded)
+{
+    SDL_JoystickDriver *driver = &SDL_PS5_JoystickDriver;
+    SDL_Joystick joystick;
+    SDL_JoystickID first, second;
+    int lists, i;
+
+    CHECK(open_pad(&joystick, threaded) == 0);
+    CHECK(driver->GetCount() == 1);
+    first = driver->GetDeviceInstanceID(0);
+    CHECK(first == joystick.instance_id);
+    CHECK(SDL_strcmp(driver->GetDeviceName(0), "Sony DualSense") == 0);
+    lists = mock.user_lists;
+
+    set_user(1, 2, PS5_USER_SERVICE_EVENT_TYPE_LOGIN);
+    detect_pads();
+    CHECK(driver->GetCount() == 2);
+    CHECK(mock.open_pads == 2);
+    second = driver->GetDeviceInstanceID(1);
+    CHECK(second != first && second >= 0);
+
+    for (i = 0; i < 100; i++) {
+        detect_pads();
+    }
+    CHECK(mock.user_lists == lists);
+
+    set_user(1, -1, PS5_USER_SERVICE_EVENT_TYPE_LOGOUT);
+    detect_pads();
+    CHECK(driver->GetCount() == 1);
+    CHECK(driver->GetDeviceInstanceID(0) == first);
+    CHECK(removed_device() == second);
+    CHECK(mock.open_pads == 1);
+
+    /* The open pad is unplugged, and comes back as a new device */
+    set_connected(0);
+    sample_pad(threaded);
+    update_pad(&joystick);
+    CHECK(removed_device() == first);
+    CHECK(driver->GetCount() == 0);
+    set_connected(1);
+    detect_pads();
+    CHECK(driver->GetCount() == 0);
+    pad_next_poll = 0;
+    detect_pads();
+    CHECK(mock.user_lists == lists + 1);
+    CHECK(driver->GetCount() == 1);
+    CHECK(driver->GetDeviceInstanceID(0) != first);
+
+    close_pad(&joystick);
+    CHECK(mock.open_pads == 0);
+    return 0;
+}
+
+static void set_motion(float gyro, float accel, Uint64 timestamp)
+{
+    SDL_AtomicLock(&mock.lock);
+    mock.pad.vel.x = mock.pad.vel.y = mock.pad.vel.z = gyro;
+    mock.pad.acell.x = mock.pad.acell.y = mock.pad.acell.z = accel;
+    mock.pad.timestamp = timestamp;
+    SDL_AtomicUnlock(&mock.lock);
+}
+
+static void set_touch(int fingers, uint16_t x, uint16_t y)
+{
+    SDL_AtomicLock(&mock.lock);
+    mock.pad.touch.fingers = fingers;
+    mock.pad.touch.touch[0].x = x;
+    mock.pad.touch.touch[0].y = y;
+    SDL_AtomicUnlock(&mock.lock);
+}
+
+/* Count the sensor events since the last call, keeping the last one */
+static int count_sensor_events(SDL_SensorType type, SDL_ControllerSensorEvent *last)
+{
+    SDL_Event event;
+    int count = 0;
+
+    while (SDL_PeepEvents(&event, 1, SDL_GETEVENT, SDL_CONTROLLERSENSORUPDATE, SDL_CONTROLLERSENSORUPDATE) == 1) {
+        if (event.csensor.sensor == type) {
+            *last = event.csensor;
+            count++;
+        }
+    }
+    return count;
+}
+
+/* Motion only comes out while enabled, and only when it changes */
+static int test_sensors(SDL_bool threaded)
+{
+    SDL_Joystick joystick;
+    SDL_ControllerSensorEvent event;
+    int i;
+
+    set_motion(0.0f, 0.0f, 0);
+    CHECK(open_pad(&joystick, threaded) == 0);
+    CHECK(joystick.nsensors == 2);
+    CHECK(joystick.sensors[0].type == SDL_SENSOR_GYRO);
+    CHECK(joystick.sensors[1].type == SDL_SENSOR_ACCEL);
+
+    set_motion(0.5f, 1.0f, 1000);
+    sample_pad(threaded);
+    update_pad(&joystick);
+    SDL_FlushEvents(SDL_FIRSTEVENT, SDL_LASTEVENT);
+
+    /* What SDL_GameControllerSetSensorEnabled() does */
+    CHECK(SDL_PS5_JoystickDriver.SetSensorsEnabled(&joystick, SDL_TRUE) == 0);
+    CHECK(mock.motion == 1);
+    joystick.sensors[0].enabled = joystick.sensors[1].enabled = SDL_TRUE;
+
+    set_motion(0.25f, 1.0f, 2000);
+    sample_pad(threaded);
+    update_pad(&joystick);
+    CHECK(count_sensor_events(SDL_SENSOR_GYRO, &event) == 1);
+    CHECK(event.data[0] == 0.25f && event.data[2] == 0.25f);
+    CHECK(event.timestamp_us == 2000);
+    CHECK(count_sensor_events(SDL_SENSOR_ACCEL, &event) == 0);
+
+    /* A pad lying still */
+    for (i = 0; i < 3; i++) {
+        sample_pad(threaded);
+        update_pad(&joystick);
+    }
+    CHECK(count_sensor_events(SDL_SENSOR_GYRO, &event) == 0);
+
+    set_motion(0.25f, -1.0f, 3000);
+    sample_pad(threaded);
+    update_pad(&joystick);
+    CHECK(count_sensor_events(SDL_SENSOR_ACCEL, &event) == 1);
+    CHECK(event.data[1] == -SDL_STANDARD_GRAVITY);
+
+    /* Every reading the input thread saw, not just the last */
+    if (threaded) {
+        for (i = 1; i <= 5; i++) {
+            set_motion(0.1f * i, -1.0f, 3000 + i);
+            sample_pad(threaded);
+        }
+        update_pad(&joystick);
+        CHECK(count_sensor_events(SDL_SENSOR_GYRO, &event) == 5);
+        CHECK(event.timestamp_us == 3005);
+    }
+
+    CHECK(SDL_PS5_JoystickDriver.SetSensorsEnabled(&joystick, SDL_FALSE) == 0);
+    CHECK(mock.motion == 0);
+    set_motion(1.0f, 1.0f, 4000);
+    sample_pad(threaded);
+    update_pad(&joystick);
+    CHECK(count_sensor_events(SDL_SENSOR_GYRO, &event) == 0);
+
+    close_pad(&joystick);
+    set_motion(0.0f, 0.0f, 0);
+    return 0;
+}
+
+/* Count the touchpad events since the last call, keeping the last one */
+static int count_touch_events(Uint32 type, SDL_ControllerTouchpadEvent *last)
+{
+    SDL_Event event;
+    int count = 0;
+
+    while (SDL_PeepEvents(&event, 1, SDL_GETEVENT, SDL_CONTROLLERTOUCHPADDOWN, SDL_CONTROLLERTOUCHPADUP) == 1) {
+        if (event.type == type) {
+            *last = event.ctouchpad;
+            count++;
+        }
+    }
+    return count;
+}
+
+/* Fingers come down, move and go up on the first touchpad */
+static int test_touchpad(void)
+{
+    SDL_Joystick joystick;
+    SDL_ControllerTouchpadEvent event;
+
+    set_touch(0, 0, 0);
+    CHECK(open_pad(&joystick, SDL_FALSE) == 0);
+    CHECK(joystick.ntouchpads == 1 && joystick.touchpads[0].nfingers == 2);
+
+    set_touch(1, PS5_PAD_TOUCHPAD_WIDTH / 2, PS5_PAD_TOUCHPAD_HEIGHT / 2);
+    update_pad(&joystick);
+    CHECK(count_touch_events(SDL_CONTROLLERTOUCHPADDOWN, &event) == 1);
+    CHECK(event.finger == 0 && event.x == 0.5f && event.y == 0.5f && event.pressure == 1.0f);
+
+    update_pad(&joystick);
+    CHECK(count_touch_events(SDL_CONTROLLERTOUCHPADMOTION, &event) == 0);
+
+    set_touch(1, PS5_PAD_TOUCHPAD_WIDTH / 4, PS5_PAD_TOUCHPAD_HEIGHT / 2);
+    update_pad(&joystick);
+    CHECK(count_touch_events(SDL_CONTROLLERTOUCHPADMOTION, &event) == 1);
+    CHECK(event.x == 0.25f);
+
+    set_touch(0, 0, 0);
+    update_pad(&joystick);
+    CHECK(count_touch_events(SDL_CONTROLLERTOUCHPADUP, &event) == 1);
+    CHECK(event.x == 0.25f && event.pressure == 0.0f);
+
+    close_pad(&joystick);
+    return 0;
+}
+
+/* However many times output is set in a frame, the pad service gets one
+   call per kind of output on the next update */
+static int test_output(void)
+{
+    SDL_JoystickDriver *driver = &SDL_PS5_JoystickDriver;
+    SDL_Joystick joystick;
+    PS5_PadTriggerEffectParam effect;
+    int frame, i;
+
+    CHECK(open_pad(&joystick, SDL_FALSE) == 0);
+    CHECK(driver->GetCapabilities(&joystick) ==
+          (SDL_JOYCAP_LED | SDL_JOYCAP_RUMBLE | SDL_JOYCAP_RUMBLE_TRIGGERS));
+    mock.vibrations = mock.lightbars = mock.trigger_effects = 0;
+
+    CHECK(driver->Rumble(&joystick, 0x1000, 0x2000) == 0);
+    CHECK(driver->Rumble(&joystick, 0xFFFF, 0x8000) == 0);
+    CHECK(driver->SetLED(&joystick, 255, 0, 0) == 0);
+    CHECK(driver->SetLED(&joystick, 0, 0, 255) == 0);
+    CHECK(mock.vibrations == 0 && mock.lightbars == 0);
+    update_pad(&joystick);
+    CHECK(mock.vibrations == 1 && mock.lightbars == 1 && mock.trigger_effects == 0);
+    CHECK(mock.vibration.largeMotor == 0xFF && mock.vibration.smallMotor == 0x80);
+    CHECK(mock.lightbar.r == 0 && mock.lightbar.b == 255);
+    update_pad(&joystick);
+    CHECK(mock.vibrations == 1 && mock.lightbars == 1);
+
+    /* An effect for one trigger merges with the rumble set for both */
+    CHECK(driver->RumbleTriggers(&joystick, 1, 0x8000) == 0);
+    SDL_zero(effect);
+    effect.triggerMask = PS5_PAD_TRIGGER_EFFECT_TRIGGER_MASK_L2;
+    effect.command[0].mode = PS5_PAD_TRIGGER_EFFECT_MODE_FEEDBACK;
+    effect.command[0].commandData.data[0] = 3;
+    effect.command[1].mode = PS5_PAD_TRIGGER_EFFECT_MODE_WEAPON;
+    CHECK(driver->SendEffect(&joystick, &effect, sizeof(effect)) == 0);
+    CHECK(driver->SendEffect(&joystick, &effect, sizeof(effect) - 1) < 0);
+    update_pad(&joystick);
+    CHECK(mock.trigger_effects == 1);
+    CHECK(mock.trigger_effect.triggerMask == (PS5_PAD_TRIGGER_EFFECT_TRIGGER_MASK_L2 | PS5_PAD_TRIGGER_EFFECT_TRIGGER_MASK_R2));
+    CHECK(mock.trigger_effect.command[0].mode == PS5_PAD_TRIGGER_EFFECT_MODE_FEEDBACK);
+    CHECK(mock.trigger_effect.command[0].commandData.data[0] == 3);
+    CHECK(mock.trigger_effect.command[1].mode == PS5_PAD_TRIGGER_EFFECT_MODE_VIBRATION);
+    CHECK(mock.trigger_effect.command[1].commandData.vibration.amplitude == 4);
+
+    /* The weakest rumble still moves the trigger, none turns it off */
+    CHECK(driver->RumbleTriggers(&joystick, 1, 0) == 0);
+    update_pad(&joystick);
+    CHECK(mock.trigger_effects == 2);
+    CHECK(mock.trigger_effect.command[0].commandData.vibration.amplitude == 1);
+    CHECK(mock.trigger_effect.command[1].mode == PS5_PAD_TRIGGER_EFFECT_MODE_OFF);
+
+    /* A game updating rumble from every object that shakes the pad */
+    mock.vibrations = 0;
+    for (frame = 0; frame < 10; frame++) {
+        for (i = 0; i < 100; i++) {
+            CHECK(driver->Rumble(&joystick, (Uint16)(i * 600), (Uint16)(frame * 6000)) == 0);
+        }
+        update_pad(&joystick);
+    }
+    CHECK(mock.vibrations == 10);
+    SDL_Log("1000 rumble updates over 10 frames: %d calls to scePadSetVibration", mock.vibrations);
+
+    close_pad(&joystick);
+    return 0;
+}
+
+/* SDL_JoystickClose() on a rumbling pad stops the motors and the trigger
+   effects, then closes it without another update */
+static int test_close_rumbling(void)
+{
+    SDL_JoystickDriver *driver = &SDL_PS5_JoystickDriver;
+    SDL_Joystick joystick;
+
+    CHECK(open_pad(&joystick, SDL_FALSE) == 0);
+    CHECK(driver->Rumble(&joystick, 0xFFFF, 0xFFFF) == 0);
+    CHECK(driver->RumbleTriggers(&joystick, 0x8000, 0x8000) == 0);
+    update_pad(&joystick);
+    CHECK(mock.vibration.largeMotor == 0xFF && mock.vibration.smallMotor == 0xFF);
+    CHECK(mock.trigger_effect.command[0].mode == PS5_PAD_TRIGGER_EFFECT_MODE_VIBRATION);
+    mock.vibrations = mock.trigger_effects = 0;
+
+    CHECK(driver->Rumble(&joystick, 0, 0) == 0);
+    CHECK(driver->RumbleTriggers(&joystick, 0, 0) == 0);
+    close_pad(&joystick);
+    CHECK(mock.vibrations == 1 && mock.trigger_effects == 1);
+    CHECK(mock.vibration.largeMotor == 0 && mock.vibration.smallMotor == 0);
+    CHECK(mock.trigger_effect.triggerMask == (PS5_PAD_TRIGGER_EFFECT_TRIGGER_MASK_L2 | PS5_PAD_TRIGGER_EFFECT_TRIGGER_MASK_R2));
+    CHECK(mock.trigger_effect.command[0].mode == PS5_PAD_TRIGGER_EFFECT_MODE_OFF);
+    CHECK(mock.trigger_effect.command[1].mode == PS5_PAD_TRIGGER_EFFECT_MODE_OFF);
+
+    /* Nothing is left over for the next open */
+    CHECK(open_pad(&joystick, SDL_FALSE) == 0);
+    update_pad(&joystick);
+    CHECK(mock.vibrations == 1 && mock.trigger_effects == 1);
+    close_pad(&joystick);
+    return 0;
+}
+
+/* Short taps in a 30 fps game, and how long a press takes to reach the
+   ring of the input thread */
+static int benchmark(void)
+{
+    SDL_Joystick joystick;
+    const int taps = 20;
+    Uint64 press, total = 0, worst = 0, latency, start, decode;
+    int polled, threaded, i;
+    Uint32 head;
+    PS5_PadData pad;
+
+    CHECK(open_pad(&joystick, SDL_FALSE) == 0);
+    CHECK(tap_per_frame(&joystick, taps, &polled) == 0);
+
+    /* A second of 4 pads sampled at 1 kHz, with every button changing */
+    pad = mock.pad;
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < 4000; i++) {
+        pad.buttons = (i & 1) ? 0 : 0x10FFFE;
+        SDL_LockJoysticks();
+        PS5_PadApply(&joystick, &pad_ctx[0], &pad);
+        SDL_UnlockJoysticks();
+    }
+    decode = SDL_GetPerformanceCounter() - start;
+    SDL_FlushEvents(SDL_FIRSTEVENT, SDL_LASTEVENT);
+    close_pad(&joystick);
+
+    CHECK(open_pad(&joystick, SDL_TRUE) == 0);
+    CHECK(tap_per_frame(&joystick, taps, &threaded) == 0);
+    CHECK(threaded == taps);
+
+    for (i = 0; i < taps; i++) {
+        head = (Uint32)SDL_AtomicGet(&pad_ctx[0].ring_head);
+        press = SDL_GetPerformanceCounter();
+        set_buttons((i & 1) ? 0 : PS5_PAD_BUTTON_CROSS);
+        while ((Uint32)SDL_AtomicGet(&pad_ctx[0].ring_head) == head) {
+            SDL_Delay(0);
+        }
+        latency = pad_ctx[0].ring[head % PS5_PAD_RING_SIZE].ticks - press;
+        total += latency;
+        worst = SDL_max(worst, latency);
+        update_pad(&joystick);
+    }
+    close_pad(&joystick);
+
+    SDL_Log("8ms taps at 30 fps: %d of %d seen polling, %d of %d with the input thread",
+            polled, taps, threaded, taps);
+    SDL_Log("4000 samples with every button changing: %.3f ms",
+            (double)decode * 1000.0 / SDL_GetPerformanceFrequency());
+    SDL_Log("Press to sample: %.3f ms average, %.3f ms worst",
+            (double)total * 1000.0 / SDL_GetPerformanceFrequency() / taps,
+            (double)worst * 1000.0 / SDL_GetPerformanceFrequency());
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    int result = 0;
+
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    if (SDL_Init(SDL_INIT_EVENTS) < 0) {
+        SDL_Log("SDL_Init: %s", SDL_GetError());
+        return 1;
+    }
+
+    mock.users[0] = 1;
+    mock.users[1] = mock.users[2] = mock.users[3] = -1;
+    mock.pad.connected = 1;
+
+    if (test_polling() < 0) {
+        result = 1;
+    }
+    if (test_buttons() < 0) {
+        result = 1;
+    }
+    if (test_thread() < 0) {
+        result = 1;
+    }
+    if (test_hotplug(SDL_FALSE) < 0) {
+        result = 1;
+    }
+    if (test_hotplug(SDL_TRUE) < 0) {
+        result = 1;
+    }
+    if (test_sensors(SDL_FALSE) < 0) {
+        result = 1;
+    }
+    if (test_sensors(SDL_TRUE) < 0) {
+        result = 1;
+    }
+    if (test_touchpad() < 0) {
+        result = 1;
+    }
+    if (test_output() < 0) {
+        result = 1;
+    }
+    if (test_close_rumbling() < 0) {
+        result = 1;
+    }
+    if (benchmark() < 0) {
+        result = 1;
+    }
+
+    SDL_Quit();
+    SDL_Log("%s", result ? "FAILED" : "OK");
+
+    return result;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
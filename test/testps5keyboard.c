@@ -0,0 +1,272 @@
+/*
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Host-side test of the PS5 keyboard, against a mock of the sceKeyboard
+   functions it uses. The test queues the states the mock keyboard goes
+   through, sceKeyboardReadState only sees the last of them and
+   sceKeyboardRead all of them. */
+
+#include "../src/SDL_internal.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "SDL.h"
+
+#define SDL_PS5_HOST_TEST 1
+#include "../src/video/ps5/SDL_ps5keyboard.c"
+
+#define MOD_LCTRL 0x01
+
+static struct
+{
+    keyboard_state_t states[64];
+    int nstates;
+    keyboard_state_t last;
+    int reads;
+} mock;
+
+int sceKeyboardInit(void)
+{
+    return 0;
+}
+
+int sceKeyboardOpen(int user_id, int type, int index, void *param)
+{
+    return 1;
+}
+
+int sceKeyboardReadState(int handle, keyboard_state_t *state)
+{
+    if (mock.nstates > 0) {
+        mock.last = mock.states[mock.nstates - 1];
+        mock.nstates = 0;
+    }
+    *state = mock.last;
+    return 0;
+}
+
+int sceKeyboardRead(int handle, keyboard_state_t *states, int count)
+{
+    const int n = SDL_min(count, mock.nstates);
+
+    SDL_memcpy(states, mock.states, n * sizeof(*states));
+    SDL_memmove(mock.states, mock.states + n, (mock.nstates - n) * sizeof(*states));
+    mock.nstates -= n;
+    if (n > 0) {
+        mock.last = states[n - 1];
+    }
+    mock.reads++;
+    return n;
+}
+
+int sceKeyboardClose(int handle)
+{
+    return 0;
+}
+
+int sceUserServiceInitialize(void *params)
+{
+    return 0;
+}
+
+int sceUserServiceGetForegroundUser(int *user_id)
+{
+    *user_id = 1;
+    return 0;
+}
+
+int sceImeDialogInit(const SceImeDialogParam *param, void *extended)
+{
+    return 0;
+}
+
+int sceImeDialogGetResult(SceImeDialogResult *result)
+{
+    return 0;
+}
+
+int sceImeDialogTerm(void)
+{
+    return 0;
+}
+
+SceImeDialogStatus sceImeDialogGetStatus(void)
+{
+    return SCE_IME_DIALOG_STATUS_NONE;
+}
+
+#define CHECK(cond)                                              \
+    if (!(cond)) {                                               \
+        SDL_Log("%s:%d: check failed: %s", __FILE__, __LINE__, #cond); \
+        return -1;                                               \
+    }
+
+/* Queue a state with 'keys' held, in the slots given, zero ending them */
+static void push_state(uint32_t modifiers, uint16_t key0, uint16_t key1)
+{
+    keyboard_state_t *state = &mock.states[mock.nstates++];
+
+    SDL_zerop(state);
+    state->available = 1;
+    state->modifiers = modifiers;
+    state->scankey[0] = key0;
+    state->scankey[1] = key1;
+}
+
+/* The keys sent since the last call, as scancodes, negative when released */
+static int get_keys(int *keys, int max)
+{
+    SDL_Event event;
+    int n = 0;
+
+    while (SDL_PeepEvents(&event, 1, SDL_GETEVENT, SDL_KEYDOWN, SDL_KEYUP) == 1) {
+        if (n < max) {
+            const int scancode = event.key.keysym.scancode;
+            keys[n] = (event.type == SDL_KEYDOWN) ? scancode : -scancode;
+        }
+        n++;
+    }
+    return n;
+}
+
+static int open_keyboard(SDL_bool buffered)
+{
+    SDL_SetHint(SDL_HINT_PS5_KEYBOARD_BUFFERED, buffered ? "1" : "0");
+    SDL_zero(mock);
+    CHECK(PS5_Keyboard_Init() == 0);
+    CHECK(PS5_Keyboard_Open() == 0);
+    SDL_ResetKeyboard();
+    SDL_FlushEvents(SDL_FIRSTEVENT, SDL_LASTEVENT);
+    return 0;
+}
+
+/* A key is followed wherever it is in the state, not by its slot */
+static int test_slots(void)
+{
+    int keys[8];
+
+    CHECK(open_keyboard(SDL_FALSE) == 0);
+
+    push_state(0, SDL_SCANCODE_A, 0);
+    PS5_Keyboard_PumpEvents();
+    push_state(0, SDL_SCANCODE_A, SDL_SCANCODE_B);
+    PS5_Keyboard_PumpEvents();
+    CHECK(get_keys(keys, 8) == 2);
+    CHECK(keys[0] == SDL_SCANCODE_A && keys[1] == SDL_SCANCODE_B);
+
+    /* B moves to the first slot as A goes up */
+    push_state(0, SDL_SCANCODE_B, 0);
+    PS5_Keyboard_PumpEvents();
+    CHECK(get_keys(keys, 8) == 1);
+    CHECK(keys[0] == -SDL_SCANCODE_A);
+
+    push_state(0, 0, 0);
+    PS5_Keyboard_PumpEvents();
+    CHECK(get_keys(keys, 8) == 1);
+    CHECK(keys[0] == -SDL_SCANCODE_B);
+
+    PS5_Keyboard_Close();
+    return 0;
+}
+
+/* A shortcut typed between two pumps comes out in an order that keeps it
+   one, and keys of the same state come out sorted */
+static int test_order(void)
+{
+    int keys[8];
+
+    CHECK(open_keyboard(SDL_FALSE) == 0);
+
+    push_state(MOD_LCTRL, SDL_SCANCODE_C, 0);
+    PS5_Keyboard_PumpEvents();
+    CHECK(get_keys(keys, 8) == 2);
+    CHECK(keys[0] == SDL_SCANCODE_LCTRL && keys[1] == SDL_SCANCODE_C);
+
+    push_state(0, 0, 0);
+    PS5_Keyboard_PumpEvents();
+    CHECK(get_keys(keys, 8) == 2);
+    CHECK(keys[0] == -SDL_SCANCODE_C && keys[1] == -SDL_SCANCODE_LCTRL);
+
+    push_state(0, SDL_SCANCODE_Z, SDL_SCANCODE_B);
+    PS5_Keyboard_PumpEvents();
+    CHECK(get_keys(keys, 8) == 2);
+    CHECK(keys[0] == SDL_SCANCODE_B && keys[1] == SDL_SCANCODE_Z);
+
+    PS5_Keyboard_Close();
+    return 0;
+}
+
+/* Taps between two pumps are lost when polling, and not when buffered,
+   however many states are queued */
+static int test_buffered(void)
+{
+    const int taps = 20;
+    int keys[64], i, n;
+
+    CHECK(open_keyboard(SDL_FALSE) == 0);
+    push_state(0, SDL_SCANCODE_A, 0);
+    push_state(0, 0, 0);
+    PS5_Keyboard_PumpEvents();
+    CHECK(get_keys(keys, 64) == 0);
+    PS5_Keyboard_Close();
+
+    CHECK(open_keyboard(SDL_TRUE) == 0);
+    for (i = 0; i < taps; i++) {
+        push_state(0, SDL_SCANCODE_A, 0);
+        push_state(0, 0, 0);
+    }
+    PS5_Keyboard_PumpEvents();
+    n = get_keys(keys, 64);
+    CHECK(n == taps * 2);
+    for (i = 0; i < n; i++) {
+        CHECK(keys[i] == ((i & 1) ? -SDL_SCANCODE_A : SDL_SCANCODE_A));
+    }
+    CHECK(mock.nstates == 0);
+    CHECK(mock.reads == 3);
+
+    /* Nothing queued, nothing sent */
+    PS5_Keyboard_PumpEvents();
+    CHECK(get_keys(keys, 64) == 0);
+
+    PS5_Keyboard_Close();
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    int result = 0;
+
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    if (SDL_Init(SDL_INIT_EVENTS) < 0) {
+        SDL_Log("SDL_Init: %s", SDL_GetError());
+        return 1;
+    }
+
+    if (test_slots() < 0) {
+        result = 1;
+    }
+    if (test_order() < 0) {
+        result = 1;
+    }
+    if (test_buffered() < 0) {
+        result = 1;
+    }
+
+    SDL_Quit();
+    SDL_Log("%s", result ? "FAILED" : "OK");
+
+    return result;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,558 @@
+/*
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Host-side check of the PS5 renderer's command translation: each scene is
+   drawn by the software renderer and by PS5_RunDrawCommands into tiled and
+   linear scan-out buffers, and the results are compared */
+
+#include "../src/SDL_internal.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "SDL.h"
+
+#define SDL_PS5_HOST_TEST 1
+#include "../src/video/ps5/SDL_ps5tiling.c"
+#include "../src/video/ps5/SDL_ps5tilemap.inc"
+#include "../src/render/ps5/SDL_ps5draw.c"
+
+#define WIDTH  1920
+#define HEIGHT 1080
+
+#define MAX_COMMANDS 64
+
+typedef enum
+{
+    OP_CLEAR,
+    OP_VIEWPORT,
+    OP_CLIP,   /* disabled when 'rect' is empty */
+    OP_POINTS, /* 'points' */
+    OP_LINES,  /* 'points', only axis aligned or diagonal */
+    OP_FILL,   /* 'rect' */
+    OP_COPY    /* 'src' of texture 'texture' to 'rect' */
+} OpType;
+
+typedef struct
+{
+    OpType type;
+    SDL_BlendMode blend;
+    Uint8 r, g, b, a; /* draw color, or texture color and alpha mod */
+    SDL_Rect rect;
+    SDL_Rect src;
+    int texture;
+    const SDL_FPoint *points;
+    int count;
+} Op;
+
+static const SDL_FPoint dots[] = {
+    { 0.0f, 0.0f }, { 5.5f, 7.9f }, { 1919.0f, 1079.0f }, { 700.0f, 10.0f },
+    { -3.0f, 4.0f }, { 1920.0f, 5.0f }, { 120.0f, 130.0f }, { 121.0f, 130.0f },
+};
+
+static const SDL_FPoint polyline[] = {
+    { 10.0f, 10.0f }, { 300.0f, 10.0f }, { 300.0f, 200.0f }, { 110.0f, 10.0f },
+    { 10.0f, 110.0f }, { 10.0f, 10.0f },
+};
+
+static const SDL_FPoint open_line[] = {
+    { 1900.0f, 1070.0f }, { 1800.0f, 970.0f }, { 1800.0f, 1200.0f },
+};
+
+static const Op scene_fill[] = {
+    { OP_VIEWPORT, SDL_BLENDMODE_NONE, 0, 0, 0, 0, { 0, 0, WIDTH, HEIGHT } },
+    { OP_CLEAR, SDL_BLENDMODE_NONE, 10, 20, 30, 255 },
+    { OP_FILL, SDL_BLENDMODE_NONE, 200, 100, 50, 255, { 3, 5, 517, 131 } },
+    { OP_FILL, SDL_BLENDMODE_NONE, 0, 255, 0, 128, { 1800, 1000, 300, 300 } },
+    { OP_FILL, SDL_BLENDMODE_NONE, 1, 2, 3, 4, { -20, -20, 21, 21 } },
+    { OP_FILL, SDL_BLENDMODE_BLEND, 255, 255, 255, 128, { 100, 100, 600, 400 } },
+    { OP_FILL, SDL_BLENDMODE_ADD, 100, 50, 25, 200, { 500, 300, 333, 77 } },
+    { OP_FILL, SDL_BLENDMODE_MOD, 128, 64, 255, 255, { 0, 0, 256, 1080 } },
+    { OP_FILL, SDL_BLENDMODE_MUL, 200, 150, 100, 50, { 250, 250, 1000, 9 } },
+};
+
+static const Op scene_draw[] = {
+    { OP_VIEWPORT, SDL_BLENDMODE_NONE, 0, 0, 0, 0, { 0, 0, WIDTH, HEIGHT } },
+    { OP_CLEAR, SDL_BLENDMODE_NONE, 40, 40, 40, 255 },
+    { OP_POINTS, SDL_BLENDMODE_NONE, 255, 0, 0, 255, { 0 }, { 0 }, 0, dots, SDL_arraysize(dots) },
+    { OP_LINES, SDL_BLENDMODE_NONE, 0, 255, 255, 255, { 0 }, { 0 }, 0, polyline, SDL_arraysize(polyline) },
+    { OP_LINES, SDL_BLENDMODE_BLEND, 255, 255, 0, 100, { 0 }, { 0 }, 0, open_line, SDL_arraysize(open_line) },
+    { OP_POINTS, SDL_BLENDMODE_ADD, 100, 100, 100, 255, { 0 }, { 0 }, 0, polyline, SDL_arraysize(polyline) },
+};
+
+static const Op scene_clip[] = {
+    { OP_VIEWPORT, SDL_BLENDMODE_NONE, 0, 0, 0, 0, { 0, 0, WIDTH, HEIGHT } },
+    { OP_CLEAR, SDL_BLENDMODE_NONE, 0, 0, 0, 255 },
+    { OP_VIEWPORT, SDL_BLENDMODE_NONE, 0, 0, 0, 0, { 100, 50, 800, 600 } },
+    { OP_FILL, SDL_BLENDMODE_NONE, 255, 0, 255, 255, { -50, -50, 2000, 2000 } },
+    { OP_CLIP, SDL_BLENDMODE_NONE, 0, 0, 0, 0, { 10, 10, 300, 200 } },
+    { OP_FILL, SDL_BLENDMODE_BLEND, 0, 255, 0, 128, { 0, 0, 400, 400 } },
+    { OP_LINES, SDL_BLENDMODE_NONE, 255, 255, 255, 255, { 0 }, { 0 }, 0, polyline, SDL_arraysize(polyline) },
+    { OP_COPY, SDL_BLENDMODE_NONE, 255, 255, 255, 255, { 200, 150, 64, 48 }, { 0, 0, 64, 48 }, 0 },
+    { OP_CLIP, SDL_BLENDMODE_NONE, 0, 0, 0, 0, { 0 } },
+    { OP_POINTS, SDL_BLENDMODE_NONE, 255, 0, 0, 255, { 0 }, { 0 }, 0, dots, SDL_arraysize(dots) },
+    { OP_FILL, SDL_BLENDMODE_NONE, 9, 9, 9, 255, { 790, 590, 20, 20 } },
+};
+
+static const Op scene_copy[] = {
+    { OP_VIEWPORT, SDL_BLENDMODE_NONE, 0, 0, 0, 0, { 0, 0, WIDTH, HEIGHT } },
+    { OP_CLEAR, SDL_BLENDMODE_NONE, 60, 90, 120, 255 },
+    { OP_COPY, SDL_BLENDMODE_NONE, 255, 255, 255, 255, { 13, 7, 64, 48 }, { 0, 0, 64, 48 }, 0 },
+    { OP_COPY, SDL_BLENDMODE_NONE, 255, 255, 255, 255, { 101, 7, 64, 48 }, { 0, 0, 64, 48 }, 1 },
+    { OP_COPY, SDL_BLENDMODE_NONE, 255, 255, 255, 255, { -30, 1050, 64, 48 }, { 0, 0, 64, 48 }, 0 },
+    { OP_COPY, SDL_BLENDMODE_NONE, 255, 255, 255, 255, { 200, 200, 128, 96 }, { 0, 0, 64, 48 }, 0 },
+    { OP_COPY, SDL_BLENDMODE_NONE, 255, 255, 255, 255, { 400, 200, 96, 144 }, { 16, 0, 32, 48 }, 1 },
+    { OP_COPY, SDL_BLENDMODE_NONE, 128, 200, 255, 100, { 600, 200, 64, 48 }, { 0, 0, 64, 48 }, 0 },
+    { OP_COPY, SDL_BLENDMODE_BLEND, 255, 255, 255, 255, { 10, 300, 64, 48 }, { 0, 0, 64, 48 }, 0 },
+    { OP_COPY, SDL_BLENDMODE_BLEND, 200, 100, 255, 128, { 100, 300, 64, 48 }, { 0, 0, 64, 48 }, 1 },
+    { OP_COPY, SDL_BLENDMODE_ADD, 255, 255, 255, 255, { 200, 300, 64, 48 }, { 0, 0, 64, 48 }, 0 },
+    { OP_COPY, SDL_BLENDMODE_MOD, 255, 128, 255, 255, { 300, 300, 64, 48 }, { 0, 0, 64, 48 }, 0 },
+    { OP_COPY, SDL_BLENDMODE_MUL, 255, 255, 255, 255, { 400, 300, 64, 48 }, { 0, 0, 64, 48 }, 1 },
+    { OP_COPY, SDL_BLENDMODE_BLEND, 255, 255, 255, 255, { 500, 300, 128, 96 }, { 0, 0, 64, 48 }, 0 },
+};
+
+static const struct
+{
+    const char *name;
+    const Op *ops;
+    int count;
+    int tolerance; /* per channel, the software blitters round differently */
+} scenes[] = {
+    { "fill", scene_fill, SDL_arraysize(scene_fill), 1 },
+    { "draw", scene_draw, SDL_arraysize(scene_draw), 1 },
+    { "clip", scene_clip, SDL_arraysize(scene_clip), 1 },
+    { "copy", scene_copy, SDL_arraysize(scene_copy), 2 },
+};
+
+static const Uint32 texture_formats[] = {
+    SDL_PIXELFORMAT_ABGR8888,
+    SDL_PIXELFORMAT_ARGB8888,
+};
+
+static SDL_Surface *textures[SDL_arraysize(texture_formats)];
+
+static int iterations = 10;
+
+static size_t tiled_size(int w, int h)
+{
+    int rows = (h + PS5_TILE_HEIGHT - 1) / PS5_TILE_HEIGHT;
+    int cols = (w + PS5_TILE_WIDTH - 1) / PS5_TILE_WIDTH;
+
+    /* The last tile of a row may extend past the row pitch */
+    return ((size_t)rows * w * PS5_TILE_HEIGHT + (size_t)cols * PS5_TILE_SIZE) *
+           sizeof(Uint32);
+}
+
+static int create_textures(void)
+{
+    Uint32 seed = 7;
+    int i, x, y;
+
+    for (i = 0; i < SDL_arraysize(texture_formats); i++) {
+        SDL_Surface *surface = SDL_CreateRGBSurfaceWithFormat(0, 64, 48, 0, texture_formats[i]);
+
+        if (!surface) {
+            SDL_Log("SDL_CreateRGBSurfaceWithFormat: %s", SDL_GetError());
+            return -1;
+        }
+        for (y = 0; y < surface->h; y++) {
+            Uint32 *row = (Uint32 *)((Uint8 *)surface->pixels + y * surface->pitch);
+
+            for (x = 0; x < surface->w; x++) {
+                seed = seed * 1103515245 + 12345;
+                row[x] = seed;
+            }
+            /* Fully transparent and opaque texels, plus everything between */
+            row[0] &= 0x00FFFFFF;
+            row[1] |= 0xFF000000;
+        }
+        textures[i] = surface;
+    }
+    return 0;
+}
+
+static int draw_reference(SDL_Renderer *renderer, const Op *ops, int count)
+{
+    SDL_Texture *sw_textures[SDL_arraysize(texture_formats)];
+    int result = 0;
+    int i;
+
+    for (i = 0; i < SDL_arraysize(texture_formats); i++) {
+        sw_textures[i] = SDL_CreateTextureFromSurface(renderer, textures[i]);
+        if (!sw_textures[i]) {
+            SDL_Log("SDL_CreateTextureFromSurface: %s", SDL_GetError());
+            return -1;
+        }
+    }
+
+    SDL_RenderSetViewport(renderer, NULL);
+    SDL_RenderSetClipRect(renderer, NULL);
+    for (i = 0; i < count && result == 0; i++) {
+        const Op *op = &ops[i];
+        SDL_FRect rect;
+
+        rect.x = (float)op->rect.x;
+        rect.y = (float)op->rect.y;
+        rect.w = (float)op->rect.w;
+        rect.h = (float)op->rect.h;
+
+        SDL_SetRenderDrawColor(renderer, op->r, op->g, op->b, op->a);
+        SDL_SetRenderDrawBlendMode(renderer, op->blend);
+        switch (op->type) {
+        case OP_CLEAR:
+            result = SDL_RenderClear(renderer);
+            break;
+        case OP_VIEWPORT:
+            result = SDL_RenderSetViewport(renderer, &op->rect);
+            break;
+        case OP_CLIP:
+            result = SDL_RenderSetClipRect(renderer, SDL_RectEmpty(&op->rect) ? NULL : &op->rect);
+            break;
+        case OP_POINTS:
+            result = SDL_RenderDrawPointsF(renderer, op->points, op->count);
+            break;
+        case OP_LINES:
+            result = SDL_RenderDrawLinesF(renderer, op->points, op->count);
+            break;
+        case OP_FILL:
+            result = SDL_RenderFillRectF(renderer, &rect);
+            break;
+        case OP_COPY: {
+            SDL_Texture *texture = sw_textures[op->texture];
+
+            SDL_SetTextureColorMod(texture, op->r, op->g, op->b);
+            SDL_SetTextureAlphaMod(texture, op->a);
+            SDL_SetTextureBlendMode(texture, op->blend);
+            SDL_SetTextureScaleMode(texture, SDL_ScaleModeNearest);
+            result = SDL_RenderCopyF(renderer, texture, &op->src, &rect);
+            break;
+        }
+        }
+    }
+    if (result == 0) {
+        result = SDL_RenderFlush(renderer);
+    }
+    if (result < 0) {
+        SDL_Log("Software renderer: %s", SDL_GetError());
+    }
+
+    for (i = 0; i < SDL_arraysize(texture_formats); i++) {
+        SDL_DestroyTexture(sw_textures[i]);
+    }
+    return result;
+}
+
+/* Queue the scene the way SDL_render.c does for this backend */
+static SDL_RenderCommand *build_commands(SDL_Renderer *renderer,
+                                         SDL_RenderCommand *cmds,
+                                         SDL_Texture *ps5_textures,
+                                         const Op *ops, int count)
+{
+    int i;
+
+    SDL_assert(count + 1 <= MAX_COMMANDS);
+
+    SDL_zerop(cmds);
+    cmds->command = SDL_RENDERCMD_SETVIEWPORT;
+    cmds->data.viewport.rect.w = WIDTH;
+    cmds->data.viewport.rect.h = HEIGHT;
+
+    for (i = 0; i < count; i++) {
+        const Op *op = &ops[i];
+        SDL_RenderCommand *cmd = &cmds[i + 1];
+        SDL_FRect rect;
+        int result = 0;
+
+        cmds[i].next = cmd;
+        SDL_zerop(cmd);
+        rect.x = (float)op->rect.x;
+        rect.y = (float)op->rect.y;
+        rect.w = (float)op->rect.w;
+        rect.h = (float)op->rect.h;
+        cmd->data.draw.r = op->r;
+        cmd->data.draw.g = op->g;
+        cmd->data.draw.b = op->b;
+        cmd->data.draw.a = op->a;
+        cmd->data.draw.blend = op->blend;
+
+        switch (op->type) {
+        case OP_CLEAR:
+            cmd->command = SDL_RENDERCMD_CLEAR;
+            cmd->data.color.r = op->r;
+            cmd->data.color.g = op->g;
+            cmd->data.color.b = op->b;
+            cmd->data.color.a = op->a;
+            break;
+        case OP_VIEWPORT:
+            cmd->command = SDL_RENDERCMD_SETVIEWPORT;
+            cmd->data.viewport.rect = op->rect;
+            break;
+        case OP_CLIP:
+            cmd->command = SDL_RENDERCMD_SETCLIPRECT;
+            cmd->data.cliprect.enabled = !SDL_RectEmpty(&op->rect);
+            cmd->data.cliprect.rect = op->rect;
+            break;
+        case OP_POINTS:
+            cmd->command = SDL_RENDERCMD_DRAW_POINTS;
+            result = PS5_QueueDrawPoints(renderer, cmd, op->points, op->count);
+            break;
+        case OP_LINES:
+            cmd->command = SDL_RENDERCMD_DRAW_LINES;
+            result = PS5_QueueDrawPoints(renderer, cmd, op->points, op->count);
+            break;
+        case OP_FILL:
+            cmd->command = SDL_RENDERCMD_FILL_RECTS;
+            result = PS5_QueueFillRects(renderer, cmd, &rect, 1);
+            break;
+        case OP_COPY:
+            cmd->command = SDL_RENDERCMD_COPY;
+            cmd->data.draw.texture = &ps5_textures[op->texture];
+            result = PS5_QueueCopy(renderer, cmd, cmd->data.draw.texture, &op->src, &rect);
+            break;
+        }
+        if (result < 0) {
+            SDL_Log("Queueing command %d: %s", i, SDL_GetError());
+            return NULL;
+        }
+    }
+
+    return cmds;
+}
+
+static int compare(const char *name, const char *layout, const SDL_Surface *expected,
+                   const PS5_RenderTarget *target, int tolerance)
+{
+    Uint32 row[WIDTH];
+    int worst = 0, wx = 0, wy = 0;
+    int x, y, c;
+
+    for (y = 0; y < HEIGHT; y++) {
+        const Uint32 *ref = (const Uint32 *)((const Uint8 *)expected->pixels + y * expected->pitch);
+
+        PS5_ReadTargetSpan(target, 0, y, row, WIDTH);
+        for (x = 0; x < WIDTH; x++) {
+            for (c = 0; c < 32; c += 8) {
+                const int diff = SDL_abs((int)((ref[x] >> c) & 0xFF) - (int)((row[x] >> c) & 0xFF));
+
+                if (diff > worst) {
+                    worst = diff;
+                    wx = x;
+                    wy = y;
+                }
+            }
+        }
+    }
+
+    if (worst > tolerance) {
+        PS5_ReadTargetSpan(target, wx, wy, row, 1);
+        SDL_Log("%s %s: differs by %d at %d,%d: %08x, expected %08x", name, layout,
+                worst, wx, wy, row[0],
+                ((const Uint32 *)((const Uint8 *)expected->pixels + wy * expected->pitch))[wx]);
+        return -1;
+    }
+    return 0;
+}
+
+static int run_scene(int index)
+{
+    const char *name = scenes[index].name;
+    const Op *ops = scenes[index].ops;
+    const int count = scenes[index].count;
+    const size_t size = tiled_size(WIDTH, HEIGHT);
+    SDL_Surface *expected = NULL;
+    SDL_Renderer *sw = NULL;
+    SDL_Renderer *stub = NULL;
+    SDL_RenderCommand cmds[MAX_COMMANDS];
+    SDL_Texture ps5_textures[SDL_arraysize(texture_formats)];
+    PS5_RenderTarget tiled, linear;
+    Uint64 start, ticks;
+    int result = -1;
+    int i;
+
+    SDL_zero(tiled);
+    SDL_zero(linear);
+
+    expected = SDL_CreateRGBSurfaceWithFormat(0, WIDTH, HEIGHT, 0, SDL_PIXELFORMAT_ABGR8888);
+    sw = expected ? SDL_CreateSoftwareRenderer(expected) : NULL;
+    stub = (SDL_Renderer *)SDL_calloc(1, sizeof(*stub));
+    tiled.pixels = (Uint32 *)SDL_calloc(1, size);
+    linear.pixels = (Uint32 *)SDL_calloc(WIDTH * HEIGHT, sizeof(Uint32));
+    if (!expected || !sw || !stub || !tiled.pixels || !linear.pixels) {
+        SDL_Log("Out of memory");
+        goto done;
+    }
+    tiled.width = linear.width = WIDTH;
+    tiled.height = linear.height = HEIGHT;
+    linear.linear = SDL_TRUE;
+
+    if (draw_reference(sw, ops, count) < 0) {
+        goto done;
+    }
+
+    for (i = 0; i < SDL_arraysize(texture_formats); i++) {
+        SDL_zero(ps5_textures[i]);
+        ps5_textures[i].format = texture_formats[i];
+        ps5_textures[i].w = textures[i]->w;
+        ps5_textures[i].h = textures[i]->h;
+        ps5_textures[i].driverdata = textures[i];
+    }
+    if (!build_commands(stub, cmds, ps5_textures, ops, count)) {
+        goto done;
+    }
+
+    /* Commands change nothing in the vertex data, so it can be replayed */
+    PS5_RunDrawCommands(&tiled, cmds, stub->vertex_data);
+    PS5_RunDrawCommands(&linear, cmds, stub->vertex_data);
+    if (compare(name, "tiled", expected, &tiled, scenes[index].tolerance) < 0 ||
+        compare(name, "linear", expected, &linear, scenes[index].tolerance) < 0) {
+        goto done;
+    }
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < iterations; i++) {
+        PS5_RunDrawCommands(&tiled, cmds, stub->vertex_data);
+    }
+    ticks = SDL_GetPerformanceCounter() - start;
+    SDL_Log("%s: %.3f ms/frame", name,
+            (double)ticks * 1000.0 / SDL_GetPerformanceFrequency() / iterations);
+    result = 0;
+
+done:
+    if (stub) {
+        SDL_free(stub->vertex_data);
+        SDL_free(stub);
+    }
+    SDL_DestroyRenderer(sw);
+    SDL_FreeSurface(expected);
+    SDL_free(tiled.pixels);
+    SDL_free(linear.pixels);
+    return result;
+}
+
+/* The span helpers the renderer draws with against the tilemap */
+static int run_spans(int w, int h)
+{
+    const size_t size = tiled_size(w, h);
+    Uint32 *tiled = (Uint32 *)SDL_calloc(1, size);
+    Uint32 *row = (Uint32 *)SDL_malloc(w * sizeof(Uint32));
+    Uint32 seed = 3;
+    SDL_Rect rect;
+    int result = 0;
+    int x, y;
+
+    if (!tiled || !row) {
+        SDL_free(tiled);
+        SDL_free(row);
+        SDL_Log("Out of memory");
+        return -1;
+    }
+
+    for (y = 0; y < h; y++) {
+        for (x = 0; x < w; x++) {
+            row[x] = (Uint32)(y * w + x);
+        }
+        /* Unaligned pieces */
+        PS5_WriteTileSpan(tiled, w, 0, y, row, 3);
+        PS5_WriteTileSpan(tiled, w, 3, y, row + 3, w - 3);
+    }
+    for (y = 0; y < h && result == 0; y++) {
+        for (x = 0; x < w; x++) {
+            const Uint32 p = tiled[(size_t)(y / PS5_TILE_HEIGHT) * w * PS5_TILE_HEIGHT +
+                                   (x / PS5_TILE_WIDTH) * PS5_TILE_SIZE +
+                                   PS5_tilemap[y % PS5_TILE_HEIGHT][x % PS5_TILE_WIDTH]];
+
+            if (p != (Uint32)(y * w + x)) {
+                SDL_Log("%dx%d: span written to %d,%d lands elsewhere", w, h, x, y);
+                result = -1;
+                break;
+            }
+        }
+    }
+
+    for (x = 0; x < 100 && result == 0; x++) {
+        seed = seed * 1103515245 + 12345;
+        rect.x = (int)((seed >> 8) % w);
+        rect.y = (int)((seed >> 16) % h);
+        rect.w = SDL_min((int)(seed % 200) + 1, w - rect.x);
+        rect.h = SDL_min((int)((seed >> 24) % 100) + 1, h - rect.y);
+        PS5_FillTileRect(tiled, w, &rect, seed);
+        for (y = rect.y; y < rect.y + rect.h; y++) {
+            int i;
+
+            PS5_ReadTileSpan(tiled, w, rect.x, y, row, rect.w);
+            for (i = 0; i < rect.w; i++) {
+                if (row[i] != seed) {
+                    SDL_Log("%dx%d: fill of %d,%d %dx%d misses %d,%d", w, h,
+                            rect.x, rect.y, rect.w, rect.h, rect.x + i, y);
+                    result = -1;
+                    break;
+                }
+            }
+            if (result < 0) {
+                break;
+            }
+            /* Only the rect was written */
+            if (rect.x > 0) {
+                PS5_ReadTileSpan(tiled, w, rect.x - 1, y, row, 1);
+                if (row[0] == seed) {
+                    SDL_Log("%dx%d: fill of %d,%d %dx%d spills", w, h,
+                            rect.x, rect.y, rect.w, rect.h);
+                    result = -1;
+                    break;
+                }
+            }
+        }
+    }
+
+    SDL_free(tiled);
+    SDL_free(row);
+    return result;
+}
+
+int main(int argc, char *argv[])
+{
+    int result = 0;
+    int i;
+
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    for (i = 1; i < argc; i++) {
+        if (SDL_strcmp(argv[i], "--iterations") == 0 && argv[i + 1]) {
+            iterations = SDL_atoi(argv[++i]);
+            iterations = SDL_max(iterations, 1);
+        } else {
+            SDL_Log("Usage: %s [--iterations N]", argv[0]);
+            return 1;
+        }
+    }
+
+    if (run_spans(37, 13) < 0 || run_spans(1920, 1080) < 0 ||
+        run_spans(3840, 2160) < 0) {
+        result = 1;
+    }
+
+    if (create_textures() < 0) {
+        return 1;
+    }
+    for (i = 0; i < SDL_arraysize(scenes); i++) {
+        if (run_scene(i) < 0) {
+            result = 1;
+        }
+    }
+
+    for (i = 0; i < SDL_arraysize(texture_formats); i++) {
+        SDL_FreeSurface(textures[i]);
+    }
+    SDL_Quit();
+
+    return result;
+}
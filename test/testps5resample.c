@@ -0,0 +1,281 @@
+/*
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Host-side check of the 44.1 to 48 kHz resampler the PS5 audio driver
+   uses, and benchmark against the generic resampler of SDL_AudioStream */
+
+#include "../src/SDL_internal.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "SDL.h"
+
+#include "../src/audio/SDL_audioresampler48k.c"
+
+#define CHANNELS 2
+#define SECONDS  10
+
+#define CHECK(cond)                                              \
+    if (!(cond)) {                                               \
+        SDL_Log("%s:%d: check failed: %s", __FILE__, __LINE__, #cond); \
+        return -1;                                               \
+    }
+
+static float *make_sine(double freq, int frames)
+{
+    float *samples = (float *)SDL_malloc((size_t)frames * CHANNELS * sizeof(float));
+    int i;
+
+    if (samples) {
+        for (i = 0; i < frames; i++) {
+            /* the channels a quarter period apart, to tell them apart */
+            samples[i * 2] = (float)(0.5 * SDL_sin(2.0 * M_PI * freq * i / 44100.0));
+            samples[i * 2 + 1] = (float)(0.5 * SDL_cos(2.0 * M_PI * freq * i / 44100.0));
+        }
+    }
+    return samples;
+}
+
+/* Largest difference between the output and the sine it should be, away
+   from the start, where the silence before the input is part of it */
+static float sine_error(const float *out, int frames, double freq)
+{
+    float error = 0.0f;
+    int i;
+
+    for (i = RESAMPLER48K_TAPS; i < frames; i++) {
+        const double t = 2.0 * M_PI * freq * i / 48000.0;
+        error = SDL_max(error, SDL_fabsf(out[i * 2] - (float)(0.5 * SDL_sin(t))));
+        error = SDL_max(error, SDL_fabsf(out[i * 2 + 1] - (float)(0.5 * SDL_cos(t))));
+    }
+    return error;
+}
+
+/* Tones across the audible band come out at the same level, without
+   images of them around */
+static int test_sines(void)
+{
+    static const struct
+    {
+        double freq;
+        float max_error;
+    } tones[] = {
+        { 100.0, 0.001f },
+        { 1000.0, 0.001f },
+        { 10000.0, 0.005f },
+        { 18000.0, 0.02f },
+    };
+    const int frames = 44100;
+    const int max_out = SDL_RESAMPLE48K_MAX_FRAMES(frames);
+    float *out = (float *)SDL_malloc((size_t)max_out * CHANNELS * sizeof(float));
+    int i, got;
+
+    CHECK(out != NULL);
+
+    for (i = 0; i < SDL_arraysize(tones); i++) {
+        SDL_Resampler48k *resampler = SDL_CreateResampler48k(CHANNELS, 0);
+        float *in = make_sine(tones[i].freq, frames);
+        float error;
+
+        CHECK(resampler != NULL && in != NULL);
+        got = SDL_Resample48k(resampler, in, frames, out, max_out);
+        /* All but the frames waiting for the taps after them */
+        CHECK(got > 48000 - RESAMPLER48K_TAPS && got <= 48000);
+        error = sine_error(out, got, tones[i].freq);
+        SDL_Log("%5.0f Hz: max error %f", tones[i].freq, error);
+        CHECK(error < tones[i].max_error);
+
+        SDL_free(in);
+        SDL_DestroyResampler48k(resampler);
+    }
+
+    SDL_free(out);
+    return 0;
+}
+
+/* The output doesn't depend on how the input is split, nor on how little
+   room there is for it, and stays within SDL_RESAMPLE48K_MAX_FRAMES */
+static int test_chunks(void)
+{
+    const int frames = 20000;
+    const int max_out = SDL_RESAMPLE48K_MAX_FRAMES(frames);
+    float *in = make_sine(440.0, frames);
+    float *whole = (float *)SDL_malloc((size_t)max_out * CHANNELS * sizeof(float));
+    float *split = (float *)SDL_malloc((size_t)max_out * CHANNELS * sizeof(float));
+    SDL_Resampler48k *resampler = SDL_CreateResampler48k(CHANNELS, 0);
+    int expected, total = 0, pos = 0, round;
+    SDL_bool held_back = SDL_FALSE;
+
+    CHECK(in != NULL && whole != NULL && split != NULL && resampler != NULL);
+
+    expected = SDL_Resample48k(resampler, in, frames, whole, max_out);
+    SDL_ResetResampler48k(resampler);
+
+    srand(1);
+    for (round = 0; pos < frames || total < expected; round++) {
+        const int chunk = SDL_min(rand() % 300, frames - pos);
+        /* every few rounds, less room than there is output for */
+        int room = (round % 4 == 3) ? rand() % 50 : max_out - total;
+        const int bound = SDL_RESAMPLE48K_MAX_FRAMES(chunk);
+        int got;
+
+        room = SDL_min(room, max_out - total);
+        got = SDL_Resample48k(resampler, in + pos * CHANNELS, chunk, split + total * CHANNELS, room);
+        CHECK(got >= 0);
+        if (!held_back) {
+            CHECK(got <= bound);
+        }
+        held_back = (got == room);
+        pos += chunk;
+        total += got;
+        CHECK(round < 100000);
+    }
+    CHECK(total == expected);
+    CHECK(SDL_memcmp(whole, split, (size_t)total * CHANNELS * sizeof(float)) == 0);
+
+    SDL_DestroyResampler48k(resampler);
+    SDL_free(split);
+    SDL_free(whole);
+    SDL_free(in);
+    return 0;
+}
+
+/* Buffers of up to the size it was created for, with room for the
+   output, never make it allocate, as on the audio thread */
+static int test_preallocated(void)
+{
+    const int chunk = 1024;
+    const int max_out = SDL_RESAMPLE48K_MAX_FRAMES(chunk);
+    float *in = make_sine(440.0, chunk * 50);
+    float *out = (float *)SDL_malloc((size_t)max_out * CHANNELS * sizeof(float));
+    SDL_Resampler48k *resampler = SDL_CreateResampler48k(CHANNELS, chunk);
+    const float *buffer;
+    int pos = 0, i;
+
+    CHECK(in != NULL && out != NULL && resampler != NULL);
+    buffer = resampler->buffer;
+    CHECK(buffer != NULL);
+
+    /* Full buffers and shorter ones */
+    for (i = 0; i < 50; i++) {
+        const int frames = chunk - i * 20;
+
+        CHECK(SDL_Resample48k(resampler, in + pos * CHANNELS, frames, out, max_out) >= 0);
+        CHECK(resampler->buffer == buffer);
+        pos += frames;
+    }
+
+    SDL_DestroyResampler48k(resampler);
+    SDL_free(out);
+    SDL_free(in);
+    return 0;
+}
+
+/* The SIMD kernel computes the same thing as the scalar one */
+static int test_kernels(void)
+{
+    const int frames = 4096;
+    float *in = make_sine(1000.0, frames);
+    float *scalar = (float *)SDL_malloc(frames * sizeof(float));
+    float *simd = (float *)SDL_malloc(frames * sizeof(float));
+    SDL_Resampler48k *resampler = SDL_CreateResampler48k(1, 0);
+    const int count = 3000;
+    int i;
+
+    CHECK(in != NULL && scalar != NULL && simd != NULL && resampler != NULL);
+    if (resampler->resample == Resample48k_Scalar) {
+        SDL_Log("No SIMD kernel on this CPU");
+    }
+
+    Resample48k_Scalar(in, 5, scalar, count, 1);
+    resampler->resample(in, 5, simd, count, 1);
+    for (i = 0; i < count; i++) {
+        CHECK(SDL_fabsf(scalar[i] - simd[i]) < 1e-6f);
+    }
+
+    SDL_DestroyResampler48k(resampler);
+    SDL_free(simd);
+    SDL_free(scalar);
+    SDL_free(in);
+    return 0;
+}
+
+/* CPU time per second of stereo audio, fed as 1024 frame mixing buffers */
+static int benchmark(void)
+{
+    const int frames = 44100 * SECONDS;
+    const int chunk = 1024;
+    const int max_out = SDL_RESAMPLE48K_MAX_FRAMES(chunk);
+    float *in = make_sine(1000.0, frames);
+    float *out = (float *)SDL_malloc((size_t)max_out * CHANNELS * sizeof(float));
+    SDL_Resampler48k *resampler = SDL_CreateResampler48k(CHANNELS, chunk);
+    SDL_AudioStream *stream = SDL_NewAudioStream(AUDIO_F32SYS, CHANNELS, 44100, AUDIO_F32SYS, CHANNELS, 48000);
+    Uint64 start, ticks;
+    double fixed, generic;
+    int pos;
+
+    CHECK(in != NULL && out != NULL && resampler != NULL && stream != NULL);
+
+    start = SDL_GetPerformanceCounter();
+    for (pos = 0; pos + chunk <= frames; pos += chunk) {
+        CHECK(SDL_Resample48k(resampler, in + pos * CHANNELS, chunk, out, max_out) >= 0);
+    }
+    ticks = SDL_GetPerformanceCounter() - start;
+    fixed = (double)ticks * 1000.0 / SDL_GetPerformanceFrequency() / SECONDS;
+
+    start = SDL_GetPerformanceCounter();
+    for (pos = 0; pos + chunk <= frames; pos += chunk) {
+        CHECK(SDL_AudioStreamPut(stream, in + pos * CHANNELS, chunk * CHANNELS * sizeof(float)) == 0);
+        CHECK(SDL_AudioStreamGet(stream, out, max_out * CHANNELS * sizeof(float)) >= 0);
+    }
+    ticks = SDL_GetPerformanceCounter() - start;
+    generic = (double)ticks * 1000.0 / SDL_GetPerformanceFrequency() / SECONDS;
+
+    SDL_Log("44.1 -> 48 kHz stereo: %.3f ms/s fixed ratio, %.3f ms/s SDL_AudioStream (%.1fx)",
+            fixed, generic, generic / fixed);
+
+    SDL_FreeAudioStream(stream);
+    SDL_DestroyResampler48k(resampler);
+    SDL_free(out);
+    SDL_free(in);
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    int result = 0;
+
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    if (test_sines() < 0) {
+        result = 1;
+    }
+    if (test_chunks() < 0) {
+        result = 1;
+    }
+    if (test_preallocated() < 0) {
+        result = 1;
+    }
+    if (test_kernels() < 0) {
+        result = 1;
+    }
+    if (benchmark() < 0) {
+        result = 1;
+    }
+
+    SDL_Log("%s", result ? "FAILED" : "OK");
+
+    return result;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
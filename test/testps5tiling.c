@@ -0,0 +1,740 @@
+/*
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Host-side check of the PS5 framebuffer tiling and scaling code. Pass
+   --bench to time it against the old paths at display sizes as well. */
+
+#include "../src/SDL_internal.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "SDL.h"
+
+#define SDL_PS5_HOST_TEST 1
+#include "../src/video/ps5/SDL_ps5tiling.c"
+#include "../src/video/ps5/SDL_ps5tilemap.inc"
+
+static const struct
+{
+    const char *name;
+    PS5_DrawBandFunc func;
+} kernels[] = {
+    { "scalar", PS5_DrawBand_Scalar },
+#ifdef HAVE_SSE2_INTRINSICS
+    { "sse2", PS5_DrawBand_SSE2 },
+#endif
+#ifdef HAVE_AVX2_INTRINSICS
+    { "avx2", PS5_DrawBand_AVX2 },
+#endif
+};
+
+static int iterations = 10;
+static SDL_bool bench = SDL_FALSE;
+
+static SDL_bool kernel_supported(PS5_DrawBandFunc func)
+{
+#ifdef HAVE_SSE2_INTRINSICS
+    if (func == PS5_DrawBand_SSE2) {
+        return SDL_HasSSE2();
+    }
+#endif
+#ifdef HAVE_AVX2_INTRINSICS
+    if (func == PS5_DrawBand_AVX2) {
+        return SDL_HasAVX2();
+    }
+#endif
+    return SDL_TRUE;
+}
+
+/* The table-driven path the kernels replaced */
+static void draw_reference(const PS5_TileJob *job)
+{
+    int x, y;
+
+    for (y = 0; y < job->height; y++) {
+        const Uint32 *src = (const Uint32 *)((const Uint8 *)job->src + y * job->src_pitch);
+        Uint32 *dst = job->dst + (size_t)(y / PS5_TILE_HEIGHT) * job->width * PS5_TILE_HEIGHT;
+
+        for (x = 0; x < job->width; x++) {
+            dst[(x / PS5_TILE_WIDTH) * PS5_TILE_SIZE +
+                PS5_tilemap[y % PS5_TILE_HEIGHT][x % PS5_TILE_WIDTH]] = src[x];
+        }
+    }
+}
+
+static size_t tiled_size(int w, int h)
+{
+    int rows = (h + PS5_TILE_HEIGHT - 1) / PS5_TILE_HEIGHT;
+    int cols = (w + PS5_TILE_WIDTH - 1) / PS5_TILE_WIDTH;
+
+    /* The last tile of a row may extend past the row pitch */
+    return ((size_t)rows * w * PS5_TILE_HEIGHT + (size_t)cols * PS5_TILE_SIZE) *
+           sizeof(Uint32);
+}
+
+static int run_size(PS5_TilePool *pool, int w, int h)
+{
+    size_t dst_size = tiled_size(w, h);
+    Uint32 *src = (Uint32 *)SDL_malloc((size_t)w * h * sizeof(Uint32));
+    Uint32 *expected = (Uint32 *)SDL_calloc(1, dst_size);
+    Uint32 *actual = (Uint32 *)SDL_calloc(1, dst_size);
+    PS5_TileJob job;
+    Uint64 start, ticks;
+    double ms;
+    Uint32 seed = 1;
+    int result = 0;
+    int i, k;
+
+    if (!src || !expected || !actual) {
+        SDL_free(src);
+        SDL_free(expected);
+        SDL_free(actual);
+        SDL_Log("Out of memory");
+        return -1;
+    }
+
+    for (i = 0; i < w * h; i++) {
+        seed = seed * 1103515245 + 12345;
+        src[i] = seed;
+    }
+
+    job.src = src;
+    job.src_pitch = w * sizeof(Uint32);
+    job.format = SDL_PIXELFORMAT_ABGR8888;
+    job.palette = NULL;
+    job.width = w;
+    job.height = h;
+    job.cells = NULL;
+    job.scale = NULL;
+
+    job.dst = expected;
+    draw_reference(&job);
+
+    for (k = 0; k < SDL_arraysize(kernels); k++) {
+        if (!kernel_supported(kernels[k].func)) {
+            continue;
+        }
+
+        SDL_memset(actual, 0, dst_size);
+        job.dst = actual;
+        PS5_DrawTilesWith(pool, &job, kernels[k].func);
+        if (SDL_memcmp(expected, actual, dst_size) != 0) {
+            SDL_Log("%dx%d %s: output differs from the tilemap", w, h, kernels[k].name);
+            result = -1;
+            continue;
+        }
+
+        start = SDL_GetPerformanceCounter();
+        for (i = 0; i < iterations; i++) {
+            PS5_DrawTilesWith(pool, &job, kernels[k].func);
+        }
+        ticks = SDL_GetPerformanceCounter() - start;
+        ms = (double)ticks * 1000.0 / SDL_GetPerformanceFrequency() / iterations;
+        SDL_Log("%dx%d %s: %.3f ms/frame, %.1f MB/s", w, h, kernels[k].name, ms,
+                ((double)w * h * sizeof(Uint32) / (1024.0 * 1024.0)) / (ms / 1000.0));
+    }
+
+    SDL_free(src);
+    SDL_free(expected);
+    SDL_free(actual);
+    return result;
+}
+
+/* Flip between two buffers while updating random parts of the frame, and
+   check that each presented buffer matches the whole frame */
+static int run_damage(PS5_TilePool *pool, int w, int h)
+{
+    size_t dst_size = tiled_size(w, h);
+    Uint32 *src = (Uint32 *)SDL_calloc((size_t)w * h, sizeof(Uint32));
+    Uint32 *expected = (Uint32 *)SDL_calloc(1, dst_size);
+    Uint32 *buffers[2];
+    PS5_TileDamage damage;
+    PS5_TileJob job;
+    SDL_Rect rect;
+    Uint64 start, ticks;
+    Uint32 seed = 1;
+    int result = 0;
+    int frame, x, y;
+
+    buffers[0] = (Uint32 *)SDL_calloc(1, dst_size);
+    buffers[1] = (Uint32 *)SDL_calloc(1, dst_size);
+    SDL_zero(damage);
+    if (!src || !expected || !buffers[0] || !buffers[1] ||
+        PS5_InitTileDamage(&damage, w, h, 2) < 0) {
+        SDL_Log("Out of memory");
+        result = -1;
+        goto done;
+    }
+
+    job.src = src;
+    job.src_pitch = w * sizeof(Uint32);
+    job.format = SDL_PIXELFORMAT_ABGR8888;
+    job.palette = NULL;
+    job.width = w;
+    job.height = h;
+    job.scale = NULL;
+
+    for (frame = 0; frame < 16; frame++) {
+        int idx = frame % 2;
+
+        seed = seed * 1103515245 + 12345;
+        rect.x = (seed >> 8) % w;
+        rect.y = (seed >> 16) % h;
+        rect.w = SDL_min((int)(seed % 200) + 1, w - rect.x);
+        rect.h = SDL_min((int)((seed >> 4) % 200) + 1, h - rect.y);
+        for (y = rect.y; y < rect.y + rect.h; y++) {
+            for (x = rect.x; x < rect.x + rect.w; x++) {
+                src[y * w + x] = seed + x * y;
+            }
+        }
+
+        PS5_AddTileDamage(&damage, &rect, 1);
+        job.dst = buffers[idx];
+        job.cells = PS5_GetTileDamage(&damage, idx);
+        PS5_DrawTiles(pool, &job);
+        PS5_ClearTileDamage(&damage, idx);
+
+        job.dst = expected;
+        job.cells = NULL;
+        draw_reference(&job);
+        if (SDL_memcmp(expected, buffers[idx], dst_size) != 0) {
+            SDL_Log("%dx%d: frame %d differs after a partial update", w, h, frame);
+            result = -1;
+            goto done;
+        }
+    }
+
+    /* Steady state cost of a small update, such as a blinking cursor */
+    rect.x = w / 2;
+    rect.y = h / 2;
+    rect.w = SDL_min(32, w - rect.x);
+    rect.h = SDL_min(32, h - rect.y);
+    start = SDL_GetPerformanceCounter();
+    for (frame = 0; frame < iterations; frame++) {
+        int idx = frame % 2;
+
+        PS5_AddTileDamage(&damage, &rect, 1);
+        job.dst = buffers[idx];
+        job.cells = PS5_GetTileDamage(&damage, idx);
+        PS5_DrawTiles(pool, &job);
+        PS5_ClearTileDamage(&damage, idx);
+    }
+    ticks = SDL_GetPerformanceCounter() - start;
+    SDL_Log("%dx%d: %.3f ms/frame for a 32x32 update", w, h,
+            (double)ticks * 1000.0 / SDL_GetPerformanceFrequency() / iterations);
+
+done:
+    PS5_FreeTileDamage(&damage);
+    SDL_free(src);
+    SDL_free(expected);
+    SDL_free(buffers[0]);
+    SDL_free(buffers[1]);
+    return result;
+}
+
+static const char *scale_names[] = { "nearest", "integer", "linear" };
+
+static Uint32 lerp_reference(Uint32 a, Uint32 b, Uint32 f)
+{
+    Uint32 result = 0;
+    int shift;
+
+    for (shift = 0; shift < 32; shift += 8) {
+        Uint32 ca = (a >> shift) & 0xFF;
+        Uint32 cb = (b >> shift) & 0xFF;
+
+        result |= ((ca * (256 - f) + cb * f) >> 8) << shift;
+    }
+    return result;
+}
+
+/* Scale into a linear image, one pixel at a time */
+static void scale_reference(const Uint32 *src, int sw, int sh, Uint32 *dst,
+                            int dw, int dh, const SDL_Rect *rect, SDL_bool linear)
+{
+    int x, y;
+
+    for (y = 0; y < dh; y++) {
+        for (x = 0; x < dw; x++) {
+            int dx = x - rect->x;
+            int dy = y - rect->y;
+            Sint64 px, py;
+            int x0, y0, x1, y1;
+            Uint32 top, bottom;
+
+            if (dx < 0 || dy < 0 || dx >= rect->w || dy >= rect->h) {
+                dst[y * dw + x] = 0;
+                continue;
+            }
+            if (!linear) {
+                dst[y * dw + x] = src[(Sint64)dy * sh / rect->h * sw + (Sint64)dx * sw / rect->w];
+                continue;
+            }
+
+            px = SDL_max((Sint64)(2 * dx + 1) * sw * 65536 / (2 * rect->w) - 32768, 0);
+            py = SDL_max((Sint64)(2 * dy + 1) * sh * 65536 / (2 * rect->h) - 32768, 0);
+            x0 = (int)(px >> 16);
+            y0 = (int)(py >> 16);
+            x1 = SDL_min(x0 + 1, sw - 1);
+            y1 = SDL_min(y0 + 1, sh - 1);
+            top = lerp_reference(src[y0 * sw + x0], src[y0 * sw + x1], (px >> 8) & 0xFF);
+            bottom = lerp_reference(src[y1 * sw + x0], src[y1 * sw + x1], (px >> 8) & 0xFF);
+            dst[y * dw + x] = lerp_reference(top, bottom, (py >> 8) & 0xFF);
+        }
+    }
+}
+
+/* Scale a smaller frame to the scan-out size within the tiling pass, check
+   it against scaling and tiling separately, then against partial updates,
+   and compare the speed with a full-size stretch followed by the tiling */
+static int run_scale(PS5_TilePool *pool, int sw, int sh, int dw, int dh,
+                     PS5_TileScaleMode mode, const SDL_Rect *expected_rect)
+{
+    const SDL_bool linear = (mode == PS5_TILE_SCALE_LINEAR);
+    size_t dst_size = tiled_size(dw, dh);
+    Uint32 *src = (Uint32 *)SDL_malloc((size_t)sw * sh * sizeof(Uint32));
+    Uint32 *scaled = (Uint32 *)SDL_calloc((size_t)dw * dh, sizeof(Uint32));
+    Uint32 *expected = (Uint32 *)SDL_calloc(1, dst_size);
+    Uint32 *actual = (Uint32 *)SDL_calloc(1, dst_size);
+    SDL_Surface *src_surface = NULL, *scaled_surface = NULL;
+    PS5_TileScale scale;
+    PS5_TileDamage damage;
+    PS5_TileJob job, ref_job;
+    SDL_Rect rect, dst_rect;
+    Uint64 start, ticks;
+    double fused_ms, two_pass_ms;
+    Uint32 seed = 7;
+    int result = 0;
+    int i, frame, x, y;
+
+    SDL_zero(scale);
+    SDL_zero(damage);
+    if (!src || !scaled || !expected || !actual ||
+        PS5_InitTileScale(&scale, mode, sw, sh, dw, dh) < 0 ||
+        PS5_InitTileDamage(&damage, dw, dh, 1) < 0) {
+        SDL_Log("Out of memory");
+        result = -1;
+        goto done;
+    }
+
+    if (!SDL_RectEquals(&scale.rect, expected_rect)) {
+        SDL_Log("%dx%d -> %dx%d %s: placed at %d,%d %dx%d", sw, sh, dw, dh,
+                scale_names[mode], scale.rect.x, scale.rect.y, scale.rect.w, scale.rect.h);
+        result = -1;
+        goto done;
+    }
+
+    for (i = 0; i < sw * sh; i++) {
+        seed = seed * 1103515245 + 12345;
+        src[i] = seed;
+    }
+
+    job.src = src;
+    job.src_pitch = sw * sizeof(Uint32);
+    job.format = SDL_PIXELFORMAT_ABGR8888;
+    job.palette = NULL;
+    job.dst = actual;
+    job.width = dw;
+    job.height = dh;
+    job.cells = NULL;
+    job.scale = &scale;
+
+    ref_job.src = scaled;
+    ref_job.src_pitch = dw * sizeof(Uint32);
+    ref_job.format = SDL_PIXELFORMAT_ABGR8888;
+    ref_job.palette = NULL;
+    ref_job.dst = expected;
+    ref_job.width = dw;
+    ref_job.height = dh;
+    ref_job.cells = NULL;
+    ref_job.scale = NULL;
+
+    /* Borders must be written as well */
+    SDL_memset(actual, 0xAA, dst_size);
+    SDL_memset(expected, 0xAA, dst_size);
+    PS5_DrawTiles(pool, &job);
+    scale_reference(src, sw, sh, scaled, dw, dh, &scale.rect, linear);
+    draw_reference(&ref_job);
+    if (SDL_memcmp(expected, actual, dst_size) != 0) {
+        SDL_Log("%dx%d -> %dx%d %s: output differs from the reference",
+                sw, sh, dw, dh, scale_names[mode]);
+        result = -1;
+        goto done;
+    }
+
+    /* Partial updates only redraw what the changed source pixels touch */
+    PS5_ClearTileDamage(&damage, 0);
+    for (frame = 0; frame < 4; frame++) {
+        seed = seed * 1103515245 + 12345;
+        rect.x = (seed >> 8) % sw;
+        rect.y = (seed >> 16) % sh;
+        rect.w = SDL_min((int)(seed % 100) + 1, sw - rect.x);
+        rect.h = SDL_min((int)((seed >> 4) % 100) + 1, sh - rect.y);
+        for (y = rect.y; y < rect.y + rect.h; y++) {
+            for (x = rect.x; x < rect.x + rect.w; x++) {
+                src[y * sw + x] = seed + x * y;
+            }
+        }
+
+        PS5_ScaleTileRect(&scale, &rect, &dst_rect);
+        PS5_AddTileDamage(&damage, &dst_rect, 1);
+        job.cells = PS5_GetTileDamage(&damage, 0);
+        PS5_DrawTiles(pool, &job);
+        PS5_ClearTileDamage(&damage, 0);
+
+        scale_reference(src, sw, sh, scaled, dw, dh, &scale.rect, linear);
+        draw_reference(&ref_job);
+        if (SDL_memcmp(expected, actual, dst_size) != 0) {
+            SDL_Log("%dx%d -> %dx%d %s: frame %d differs after a partial update",
+                    sw, sh, dw, dh, scale_names[mode], frame);
+            result = -1;
+            goto done;
+        }
+    }
+    job.cells = NULL;
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < iterations; i++) {
+        PS5_DrawTiles(pool, &job);
+    }
+    ticks = SDL_GetPerformanceCounter() - start;
+    fused_ms = (double)ticks * 1000.0 / SDL_GetPerformanceFrequency() / iterations;
+
+    /* What apps had to do before: stretch to a full-size surface first */
+    src_surface = SDL_CreateRGBSurfaceWithFormatFrom(src, sw, sh, 32, sw * 4,
+                                                     SDL_PIXELFORMAT_ABGR8888);
+    scaled_surface = SDL_CreateRGBSurfaceWithFormatFrom(scaled, dw, dh, 32, dw * 4,
+                                                        SDL_PIXELFORMAT_ABGR8888);
+    if (!src_surface || !scaled_surface) {
+        SDL_Log("SDL_CreateRGBSurfaceWithFormatFrom: %s", SDL_GetError());
+        result = -1;
+        goto done;
+    }
+    ref_job.dst = actual;
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < iterations; i++) {
+        if (linear) {
+            SDL_SoftStretchLinear(src_surface, NULL, scaled_surface, &scale.rect);
+        } else {
+            SDL_SoftStretch(src_surface, NULL, scaled_surface, &scale.rect);
+        }
+        PS5_DrawTiles(pool, &ref_job);
+    }
+    ticks = SDL_GetPerformanceCounter() - start;
+    two_pass_ms = (double)ticks * 1000.0 / SDL_GetPerformanceFrequency() / iterations;
+
+    SDL_Log("%dx%d -> %dx%d %s: %.3f ms/frame fused, %.3f ms/frame stretch + tile",
+            sw, sh, dw, dh, scale_names[mode], fused_ms, two_pass_ms);
+
+done:
+    SDL_FreeSurface(src_surface);
+    SDL_FreeSurface(scaled_surface);
+    PS5_FreeTileScale(&scale);
+    PS5_FreeTileDamage(&damage);
+    SDL_free(src);
+    SDL_free(scaled);
+    SDL_free(expected);
+    SDL_free(actual);
+    return result;
+}
+
+/* Convert to ABGR8888 one pixel at a time. The blitters behind
+   SDL_ConvertSurface round some RGB565 greens down, SDL_GetRGBA doesn't. */
+static void convert_reference(const SDL_Surface *src, Uint32 *dst)
+{
+    int x, y;
+
+    for (y = 0; y < src->h; y++) {
+        const Uint8 *row = (const Uint8 *)src->pixels + y * src->pitch;
+
+        for (x = 0; x < src->w; x++) {
+            Uint32 pixel;
+            Uint8 r, g, b, a;
+
+            switch (src->format->BytesPerPixel) {
+            case 1:
+                pixel = row[x];
+                break;
+            case 2:
+                pixel = ((const Uint16 *)row)[x];
+                break;
+            default:
+                pixel = ((const Uint32 *)row)[x];
+                break;
+            }
+            SDL_GetRGBA(pixel, src->format, &r, &g, &b, &a);
+            dst[y * src->w + x] = ((Uint32)a << 24) | ((Uint32)b << 16) |
+                                  ((Uint32)g << 8) | r;
+        }
+    }
+}
+
+/* Draw a frame in another format, converting it within the tiling pass
+   and scaling it too when the sizes differ. Check it against converting
+   and tiling separately, and compare the speed with SDL_BlitSurface
+   converting to a surface of the display format first. The timings only
+   mean something in an optimized build: unoptimized, the blitters win. */
+static int run_format(PS5_TilePool *pool, Uint32 format, int sw, int sh,
+                      int dw, int dh, PS5_TileScaleMode mode)
+{
+    const SDL_bool scaled = (sw != dw || sh != dh);
+    size_t dst_size = tiled_size(dw, dh);
+    Uint32 *pixels = (Uint32 *)SDL_calloc((size_t)sw * sh, sizeof(Uint32));
+    Uint32 *scaled_pixels = (Uint32 *)SDL_calloc((size_t)dw * dh, sizeof(Uint32));
+    Uint32 *expected = (Uint32 *)SDL_calloc(1, dst_size);
+    Uint32 *actual = (Uint32 *)SDL_calloc(1, dst_size);
+    SDL_Surface *src = SDL_CreateRGBSurfaceWithFormat(0, sw, sh, 0, format);
+    SDL_Surface *converted = NULL;
+    Uint32 palette[256];
+    PS5_TileScale scale;
+    PS5_TileJob job, ref_job;
+    Uint64 start, ticks;
+    double fused_ms, two_pass_ms;
+    Uint32 seed = 3;
+    int result = 0;
+    int i, y;
+
+    SDL_zero(scale);
+    if (!pixels || !scaled_pixels || !expected || !actual || !src ||
+        (scaled && PS5_InitTileScale(&scale, mode, sw, sh, dw, dh) < 0)) {
+        SDL_Log("Out of memory");
+        result = -1;
+        goto done;
+    }
+
+    for (y = 0; y < sh; y++) {
+        Uint8 *row = (Uint8 *)src->pixels + y * src->pitch;
+
+        for (i = 0; i < sw * src->format->BytesPerPixel; i++) {
+            seed = seed * 1103515245 + 12345;
+            row[i] = (Uint8)(seed >> 16);
+        }
+    }
+    if (src->format->palette) {
+        SDL_Color colors[256];
+
+        for (i = 0; i < 256; i++) {
+            seed = seed * 1103515245 + 12345;
+            colors[i].r = (Uint8)(seed >> 8);
+            colors[i].g = (Uint8)(seed >> 16);
+            colors[i].b = (Uint8)(seed >> 24);
+            colors[i].a = (Uint8)seed;
+            palette[i] = ((Uint32)colors[i].a << 24) | ((Uint32)colors[i].b << 16) |
+                         ((Uint32)colors[i].g << 8) | colors[i].r;
+        }
+        SDL_SetPaletteColors(src->format->palette, colors, 0, 256);
+    }
+
+    job.src = src->pixels;
+    job.src_pitch = src->pitch;
+    job.format = format;
+    job.palette = palette;
+    job.dst = actual;
+    job.width = dw;
+    job.height = dh;
+    job.cells = NULL;
+    job.scale = scaled ? &scale : NULL;
+
+    convert_reference(src, pixels);
+    ref_job = job;
+    ref_job.src = pixels;
+    ref_job.src_pitch = sw * sizeof(Uint32);
+    ref_job.format = SDL_PIXELFORMAT_ABGR8888;
+    ref_job.palette = NULL;
+    ref_job.dst = expected;
+    if (scaled) {
+        scale_reference(pixels, sw, sh, scaled_pixels,
+                        dw, dh, &scale.rect, mode == PS5_TILE_SCALE_LINEAR);
+        ref_job.src = scaled_pixels;
+        ref_job.src_pitch = dw * sizeof(Uint32);
+        ref_job.scale = NULL;
+    }
+
+    SDL_memset(actual, 0xAA, dst_size);
+    SDL_memset(expected, 0xAA, dst_size);
+    if (PS5_DrawTiles(pool, &job) < 0) {
+        SDL_Log("PS5_DrawTiles: %s", SDL_GetError());
+        result = -1;
+        goto done;
+    }
+    draw_reference(&ref_job);
+    if (SDL_memcmp(expected, actual, dst_size) != 0) {
+        SDL_Log("%dx%d -> %dx%d %s: output differs from the reference",
+                sw, sh, dw, dh, SDL_GetPixelFormatName(format));
+        result = -1;
+        goto done;
+    }
+
+    /* The portable kernel, when a SIMD one handles the format */
+    if (!scaled) {
+        SDL_memset(actual, 0xAA, dst_size);
+        PS5_DrawTilesWith(pool, &job, PS5_DrawBand_Convert);
+        if (SDL_memcmp(expected, actual, dst_size) != 0) {
+            SDL_Log("%dx%d %s: scalar output differs from the reference",
+                    sw, sh, SDL_GetPixelFormatName(format));
+            result = -1;
+            goto done;
+        }
+    }
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < iterations; i++) {
+        PS5_DrawTiles(pool, &job);
+    }
+    ticks = SDL_GetPerformanceCounter() - start;
+    fused_ms = (double)ticks * 1000.0 / SDL_GetPerformanceFrequency() / iterations;
+
+    /* What apps had to do before: convert to a surface of the display format */
+    converted = SDL_CreateRGBSurfaceWithFormat(0, sw, sh, 0, SDL_PIXELFORMAT_ABGR8888);
+    if (!converted) {
+        SDL_Log("SDL_CreateRGBSurfaceWithFormat: %s", SDL_GetError());
+        result = -1;
+        goto done;
+    }
+    ref_job = job;
+    ref_job.src = converted->pixels;
+    ref_job.src_pitch = converted->pitch;
+    ref_job.format = SDL_PIXELFORMAT_ABGR8888;
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < iterations; i++) {
+        SDL_BlitSurface(src, NULL, converted, NULL);
+        PS5_DrawTiles(pool, &ref_job);
+    }
+    ticks = SDL_GetPerformanceCounter() - start;
+    two_pass_ms = (double)ticks * 1000.0 / SDL_GetPerformanceFrequency() / iterations;
+
+    SDL_Log("%dx%d -> %dx%d %s: %.3f ms/frame fused, %.3f ms/frame convert + tile",
+            sw, sh, dw, dh, SDL_GetPixelFormatName(format), fused_ms, two_pass_ms);
+
+done:
+    SDL_FreeSurface(src);
+    SDL_FreeSurface(converted);
+    PS5_FreeTileScale(&scale);
+    SDL_free(pixels);
+    SDL_free(scaled_pixels);
+    SDL_free(expected);
+    SDL_free(actual);
+    return result;
+}
+
+int main(int argc, char *argv[])
+{
+    static const struct
+    {
+        int w, h;
+        SDL_bool bench;
+    } sizes[] = {
+        { 37, 13, SDL_FALSE },
+        { 200, 108, SDL_FALSE },
+        { 1920, 1084, SDL_TRUE },
+        { 1280, 720, SDL_TRUE },
+        { 1920, 1080, SDL_TRUE },
+        { 3840, 2160, SDL_TRUE },
+    };
+    static const struct
+    {
+        int sw, sh, dw, dh;
+        PS5_TileScaleMode mode;
+        SDL_Rect rect;
+        SDL_bool bench;
+    } scales[] = {
+        { 64, 48, 192, 108, PS5_TILE_SCALE_NEAREST, { 24, 0, 144, 108 }, SDL_FALSE },
+        { 64, 48, 192, 108, PS5_TILE_SCALE_INTEGER, { 32, 6, 128, 96 }, SDL_FALSE },
+        { 64, 48, 192, 108, PS5_TILE_SCALE_LINEAR, { 24, 0, 144, 108 }, SDL_FALSE },
+        { 320, 200, 37, 13, PS5_TILE_SCALE_INTEGER, { 8, 0, 20, 13 }, SDL_FALSE },
+        { 30, 10, 200, 108, PS5_TILE_SCALE_LINEAR, { 0, 21, 200, 66 }, SDL_FALSE },
+        { 640, 480, 1920, 1080, PS5_TILE_SCALE_NEAREST, { 240, 0, 1440, 1080 }, SDL_TRUE },
+        { 640, 480, 1920, 1080, PS5_TILE_SCALE_INTEGER, { 320, 60, 1280, 960 }, SDL_TRUE },
+        { 640, 480, 1920, 1080, PS5_TILE_SCALE_LINEAR, { 240, 0, 1440, 1080 }, SDL_TRUE },
+        { 1280, 720, 3840, 2160, PS5_TILE_SCALE_INTEGER, { 0, 0, 3840, 2160 }, SDL_TRUE },
+        { 1280, 720, 3840, 2160, PS5_TILE_SCALE_LINEAR, { 0, 0, 3840, 2160 }, SDL_TRUE },
+        { 300, 100, 1920, 1084, PS5_TILE_SCALE_LINEAR, { 0, 222, 1920, 640 }, SDL_TRUE },
+    };
+    static const struct
+    {
+        Uint32 format;
+        int sw, sh, dw, dh;
+        PS5_TileScaleMode mode;
+        SDL_bool bench;
+    } formats[] = {
+        { SDL_PIXELFORMAT_ARGB8888, 37, 13, 37, 13, PS5_TILE_SCALE_NEAREST, SDL_FALSE },
+        { SDL_PIXELFORMAT_XRGB8888, 37, 13, 37, 13, PS5_TILE_SCALE_NEAREST, SDL_FALSE },
+        { SDL_PIXELFORMAT_RGB565, 37, 13, 37, 13, PS5_TILE_SCALE_NEAREST, SDL_FALSE },
+        { SDL_PIXELFORMAT_INDEX8, 37, 13, 37, 13, PS5_TILE_SCALE_NEAREST, SDL_FALSE },
+        { SDL_PIXELFORMAT_INDEX8, 32, 20, 192, 108, PS5_TILE_SCALE_INTEGER, SDL_FALSE },
+        { SDL_PIXELFORMAT_RGB565, 64, 48, 192, 108, PS5_TILE_SCALE_LINEAR, SDL_FALSE },
+        { SDL_PIXELFORMAT_ARGB8888, 1920, 1080, 1920, 1080, PS5_TILE_SCALE_NEAREST, SDL_TRUE },
+        { SDL_PIXELFORMAT_XRGB8888, 1920, 1080, 1920, 1080, PS5_TILE_SCALE_NEAREST, SDL_TRUE },
+        { SDL_PIXELFORMAT_RGB565, 1920, 1080, 1920, 1080, PS5_TILE_SCALE_NEAREST, SDL_TRUE },
+        { SDL_PIXELFORMAT_INDEX8, 1920, 1080, 1920, 1080, PS5_TILE_SCALE_NEAREST, SDL_TRUE },
+        { SDL_PIXELFORMAT_INDEX8, 320, 200, 1920, 1080, PS5_TILE_SCALE_INTEGER, SDL_TRUE },
+        { SDL_PIXELFORMAT_RGB565, 640, 480, 1920, 1080, PS5_TILE_SCALE_LINEAR, SDL_TRUE },
+    };
+    PS5_TilePool *pool;
+    int result = 0;
+    int i;
+
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    for (i = 1; i < argc; i++) {
+        if (SDL_strcmp(argv[i], "--iterations") == 0 && argv[i + 1]) {
+            iterations = SDL_atoi(argv[++i]);
+            iterations = SDL_max(iterations, 1);
+        } else if (SDL_strcmp(argv[i], "--bench") == 0) {
+            bench = SDL_TRUE;
+        } else {
+            SDL_Log("Usage: %s [--bench] [--iterations N]", argv[0]);
+            return 1;
+        }
+    }
+
+    pool = PS5_CreateTilePool(PS5_TILE_THREAD_COUNT);
+    if (!pool) {
+        SDL_Log("PS5_CreateTilePool: %s", SDL_GetError());
+        return 1;
+    }
+
+    /* Display sized frames only with --bench, to keep the default run short */
+    for (i = 0; i < SDL_arraysize(sizes); i++) {
+        if (sizes[i].bench && !bench) {
+            continue;
+        }
+        if (run_size(pool, sizes[i].w, sizes[i].h) < 0 ||
+            run_damage(pool, sizes[i].w, sizes[i].h) < 0) {
+            result = 1;
+        }
+    }
+    for (i = 0; i < SDL_arraysize(scales); i++) {
+        if (scales[i].bench && !bench) {
+            continue;
+        }
+        if (run_scale(pool, scales[i].sw, scales[i].sh, scales[i].dw, scales[i].dh,
+                      scales[i].mode, &scales[i].rect) < 0) {
+            result = 1;
+        }
+    }
+    for (i = 0; i < SDL_arraysize(formats); i++) {
+        if (formats[i].bench && !bench) {
+            continue;
+        }
+        if (run_format(pool, formats[i].format, formats[i].sw, formats[i].sh,
+                       formats[i].dw, formats[i].dh, formats[i].mode) < 0) {
+            result = 1;
+        }
+    }
+
+    PS5_DestroyTilePool(pool);
+    SDL_Quit();
+
+    return result;
+}
@@ -0,0 +1,601 @@
+/*
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Host-side test of the PS5 scan-out buffer management, against a mock of
+   the sceVideoOut and sceKernel functions it uses. The mock display shows
+   one queued flip per vblank, and a vblank only happens when the code
+   under test waits for one. */
+
+#include "../src/SDL_internal.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "SDL.h"
+
+#define SDL_PS5_HOST_TEST 1
+#include "../src/video/ps5/SDL_ps5videoout.c"
+
+#define PS5_TILE_BYTES (512 * 128 * 4)
+
+#define MOCK_VBLANK 16667 /* in microseconds, the mock TSC counts them too */
+
+struct PS5_KernelEqueue
+{
+    int unused;
+};
+
+typedef struct MockFlip
+{
+    int index;
+    int64_t arg;
+    uint64_t submit_tsc;
+} MockFlip;
+
+/* Mode switches hold the old memory until the new buffers are registered */
+#define MOCK_MAX_BLOCKS 2
+
+typedef struct MockBlock
+{
+    void *memory;
+    size_t size;
+    SDL_bool mapped;
+} MockBlock;
+
+static struct
+{
+    SDL_bool reject_linear;
+    uint32_t reject_width;
+    int open_ports;
+    int registrations;
+    int registered_buffers;
+    uint32_t registered_tiling;
+    uint32_t attr_width;      /* of the last buffer attribute set */
+    int flips;
+    int last_flip_index;
+    uint32_t last_flip_mode;
+    int flip_rate;
+    void *registered_memory; /* of the first buffer registered */
+    MockBlock blocks[MOCK_MAX_BLOCKS];
+    void *memory;            /* the last block allocated, NULL once freed */
+    size_t memory_size;
+    int allocations;
+    int registered_at_release; /* buffers registered when memory was last released */
+    uint64_t time;
+    int waits;
+    int late_vblanks;       /* extra vblanks before the next flip is shown */
+    MockFlip queue[8];
+    int queued;
+    PS5_VideoFlipStatus status;
+} mock;
+
+static MockBlock *mock_find_block(void *memory)
+{
+    for (int i = 0; i < MOCK_MAX_BLOCKS; i++) {
+        if (memory && mock.blocks[i].memory == memory) {
+            return &mock.blocks[i];
+        }
+    }
+    return NULL;
+}
+
+int sceKernelAllocateMainDirectMemory(size_t size, size_t align, int type, intptr_t *paddr)
+{
+    MockBlock *block = mock_find_block(NULL);
+
+    for (int i = 0; i < MOCK_MAX_BLOCKS && !block; i++) {
+        if (!mock.blocks[i].memory) {
+            block = &mock.blocks[i];
+        }
+    }
+    if (!block || size % 0x4000 != 0) {
+        return -1; /* the test expects at most two allocations at a time */
+    }
+    block->memory = SDL_malloc(size);
+    block->size = size;
+    block->mapped = SDL_FALSE;
+    mock.memory = block->memory;
+    mock.memory_size = size;
+    mock.allocations++;
+    *paddr = (intptr_t)block->memory;
+    return block->memory ? 0 : -1;
+}
+
+int sceKernelMapDirectMemory(void **vaddr, size_t size, int prot, int flags, intptr_t paddr, size_t align)
+{
+    MockBlock *block = mock_find_block((void *)paddr);
+
+    if (!block || size != block->size) {
+        return -1;
+    }
+    block->mapped = SDL_TRUE;
+    *vaddr = (void *)paddr;
+    return 0;
+}
+
+int sceKernelMunmap(void *addr, size_t size)
+{
+    MockBlock *block = mock_find_block(addr);
+
+    if (!block || size != block->size) {
+        return -1;
+    }
+    block->mapped = SDL_FALSE;
+    return 0;
+}
+
+int sceKernelReleaseDirectMemory(intptr_t paddr, size_t size)
+{
+    MockBlock *block = mock_find_block((void *)paddr);
+
+    if (!block || size != block->size || block->mapped ||
+        (mock.registered_buffers > 0 && mock.registered_memory == block->memory)) {
+        SDL_Log("direct memory released while still in use");
+        exit(1);
+    }
+    if (mock.memory == block->memory) {
+        mock.memory = NULL;
+        mock.memory_size = 0;
+    }
+    mock.registered_at_release = mock.registered_buffers;
+    SDL_free(block->memory);
+    SDL_zerop(block);
+    return 0;
+}
+
+int sceKernelCreateEqueue(PS5_KernelEqueue **eq, const char *name)
+{
+    *eq = (PS5_KernelEqueue *)SDL_calloc(1, sizeof(PS5_KernelEqueue));
+    return *eq ? 0 : -1;
+}
+
+int sceKernelWaitEqueue(PS5_KernelEqueue *eq, PS5_KernelEvent *ev, int num, int *out, unsigned int *timeout)
+{
+    if (mock.queued == 0) {
+        return -1; /* would block forever */
+    }
+
+    /* Next vblank, show the oldest queued flip */
+    mock.waits++;
+    mock.time += MOCK_VBLANK * (1 + mock.late_vblanks);
+    mock.late_vblanks = 0;
+    mock.status.count++;
+    mock.status.process_time = mock.time;
+    mock.status.tsc = mock.time;
+    mock.status.flip_arg = mock.queue[0].arg;
+    mock.status.submit_tsc = mock.queue[0].submit_tsc;
+    mock.status.current_buffer = mock.queue[0].index;
+    SDL_memmove(mock.queue, mock.queue + 1, --mock.queued * sizeof(MockFlip));
+
+    SDL_zerop(ev);
+    *out = 1;
+    return 0;
+}
+
+uint64_t sceKernelGetTscFrequency(void)
+{
+    return 1000000;
+}
+
+int sceKernelDeleteEqueue(PS5_KernelEqueue *eq)
+{
+    SDL_free(eq);
+    return 0;
+}
+
+int sceVideoOutOpen(int user, int type, int index, const void *param)
+{
+    mock.open_ports++;
+    return 1;
+}
+
+void sceVideoOutClose(int handle)
+{
+    mock.open_ports--;
+    mock.registered_buffers = 0;
+    mock.queued = 0;
+    SDL_zero(mock.status);
+}
+
+int sceVideoOutAddFlipEvent(PS5_KernelEqueue *eq, int handle, void *udata)
+{
+    return 0;
+}
+
+int sceVideoOutSetFlipRate(int handle, int rate)
+{
+    if (rate < 0 || rate > 2) {
+        return -1;
+    }
+    mock.flip_rate = rate;
+    return 0;
+}
+
+int sceVideoOutSubmitFlip(int handle, int index, uint32_t mode, int64_t arg)
+{
+    if (index < 0 || index >= mock.registered_buffers ||
+        mock.queued == SDL_arraysize(mock.queue)) {
+        return -1;
+    }
+    mock.flips++;
+    mock.last_flip_index = index;
+    mock.last_flip_mode = mode;
+    mock.queue[mock.queued].index = index;
+    mock.queue[mock.queued].arg = arg;
+    mock.queue[mock.queued].submit_tsc = mock.time;
+    mock.queued++;
+    return 0;
+}
+
+int sceVideoOutGetFlipStatus(int handle, PS5_VideoFlipStatus *status)
+{
+    *status = mock.status;
+    return 0;
+}
+
+int sceVideoOutDeleteFlipEvent(PS5_KernelEqueue *eq, int handle)
+{
+    return 0;
+}
+
+void sceVideoOutSetBufferAttribute2(PS5_VideoAttr *attr, uint64_t format, uint32_t tiling,
+                                    uint32_t width, uint32_t height, uint64_t option,
+                                    uint32_t dcc, uint64_t clear)
+{
+    SDL_memcpy(attr->junk0, &tiling, sizeof(tiling));
+    mock.attr_width = width;
+}
+
+int sceVideoOutRegisterBuffers2(int handle, int set, int start, PS5_VideoBuf *bufs, int num,
+                                PS5_VideoAttr *attr, int category, void *option)
+{
+    uint32_t tiling;
+
+    SDL_memcpy(&tiling, attr->junk0, sizeof(tiling));
+    mock.registrations++;
+    if (mock.registered_buffers > 0) {
+        return -1; /* already registered on this port */
+    }
+    if (tiling == PS5_VIDEO_OUT_TILING_MODE_LINEAR && mock.reject_linear) {
+        return -1;
+    }
+    if (mock.reject_width && mock.attr_width == mock.reject_width) {
+        return -1;
+    }
+    mock.registered_buffers = num;
+    mock.registered_memory = bufs[0].data;
+    mock.registered_tiling = tiling;
+    return 0;
+}
+
+#define CHECK(cond)                                              \
+    if (!(cond)) {                                               \
+        SDL_Log("%s:%d: check failed: %s", __FILE__, __LINE__, #cond); \
+        return -1;                                               \
+    }
+
+/* Draw and queue one frame, returns the buffer used */
+static int present(PS5_VideoOut *vo)
+{
+    int index = PS5_VideoOutAcquire(vo);
+
+    if (index < 0 || PS5_VideoOutSubmit(vo, index) < 0) {
+        return -1;
+    }
+    return index;
+}
+
+static int test_tiled(void)
+{
+    PS5_VideoOut vo;
+    void *old_memory;
+
+    SDL_zero(mock);
+    CHECK(PS5_VideoOutOpen(&vo) == 0);
+    CHECK(mock.open_ports == 1);
+    CHECK(mock.memory == NULL);
+
+    /* Two buffers of 4x9 tiles */
+    CHECK(PS5_VideoOutSetMode(&vo, 1920, 1080, 2, SDL_FALSE) == 0);
+    CHECK(!vo.linear);
+    CHECK(vo.num_buffers == 2);
+    CHECK(mock.registered_tiling == PS5_VIDEO_OUT_TILING_MODE_TILE);
+    CHECK(vo.vaddr == mock.memory);
+    CHECK(vo.memsize == mock.memory_size);
+    CHECK(vo.memsize == 2 * 36 * PS5_TILE_BYTES);
+    CHECK((Uint8 *)vo.vbuf[1].data - (Uint8 *)vo.vbuf[0].data == 36 * PS5_TILE_BYTES);
+    CHECK(vo.vbuf[2].data == NULL);
+
+    /* Submitting doesn't wait for the flip */
+    CHECK(present(&vo) == 0);
+    CHECK(present(&vo) == 1);
+    CHECK(mock.waits == 0);
+    CHECK(mock.queued == 2);
+
+    /* Buffer 0 is free once buffer 1 is on screen */
+    CHECK(PS5_VideoOutAcquire(&vo) == 0);
+    CHECK(mock.waits == 2);
+    CHECK(mock.status.current_buffer == 1);
+    CHECK(PS5_VideoOutSubmit(&vo, 0) == 0);
+    CHECK(mock.last_flip_index == 0);
+
+    /* The same mode keeps its memory */
+    CHECK(PS5_VideoOutSetMode(&vo, 1920, 1080, 2, SDL_FALSE) == 0);
+    CHECK(mock.allocations == 1);
+
+    /* Switching modes registers resized buffers again on a new port, and
+       only then releases the old ones */
+    old_memory = vo.vaddr;
+    CHECK(PS5_VideoOutSetMode(&vo, 3840, 2160, 2, SDL_FALSE) == 0);
+    CHECK(mock.open_ports == 1);
+    CHECK(mock.registered_buffers == 2);
+    CHECK(mock.allocations == 2);
+    CHECK(vo.width == 3840 && vo.height == 2160);
+    CHECK(vo.vaddr == mock.memory);
+    CHECK(vo.memsize == 2 * 8 * 17 * PS5_TILE_BYTES);
+    CHECK(mock.registered_at_release == 2);
+    CHECK(mock_find_block(old_memory) == NULL);
+    CHECK(present(&vo) == 0);
+
+    PS5_VideoOutClose(&vo);
+    CHECK(mock.open_ports == 0);
+    CHECK(mock.memory == NULL);
+
+    return 0;
+}
+
+static int test_triple(void)
+{
+    PS5_VideoOut vo;
+    PS5_VideoFlipStats stats;
+
+    SDL_zero(mock);
+    CHECK(PS5_VideoOutOpen(&vo) == 0);
+    CHECK(PS5_VideoOutSetMode(&vo, 1920, 1080, 3, SDL_FALSE) == 0);
+    CHECK(vo.num_buffers == 3);
+    CHECK(mock.registered_buffers == 3);
+    for (int i = 0; i < 3; i++) {
+        CHECK(vo.vbuf[i].data != NULL);
+        CHECK(((uintptr_t)vo.vbuf[i].data - (uintptr_t)vo.vaddr) % 0x20000 == 0);
+        CHECK(i == 0 || (Uint8 *)vo.vbuf[i].data - (Uint8 *)vo.vbuf[i - 1].data >=
+                            1920 * 1080 * 4);
+    }
+
+    /* Two frames can be drawn ahead of the screen */
+    CHECK(present(&vo) == 0);
+    CHECK(present(&vo) == 1);
+    CHECK(present(&vo) == 2);
+    CHECK(mock.waits == 0);
+    CHECK(present(&vo) == 0);
+    CHECK(mock.waits == 2);
+
+    /* Steady state, one frame per vblank */
+    for (int i = 0; i < 30; i++) {
+        CHECK(present(&vo) == (i + 1) % 3);
+    }
+    CHECK(mock.waits == 32);
+
+    PS5_VideoOutGetStats(&vo, &stats);
+    CHECK(stats.submitted == 34);
+    CHECK(stats.flipped == 32);
+    CHECK(stats.missed_vblanks == 0);
+    CHECK(stats.latency_last == 2 * MOCK_VBLANK);
+
+    PS5_VideoOutClose(&vo);
+
+    return 0;
+}
+
+static int test_stats(void)
+{
+    PS5_VideoOut vo;
+    PS5_VideoFlipStats stats;
+
+    SDL_zero(mock);
+    CHECK(PS5_VideoOutOpen(&vo) == 0);
+    CHECK(PS5_VideoOutSetMode(&vo, 1920, 1080, 2, SDL_FALSE) == 0);
+
+    CHECK(present(&vo) == 0);
+    CHECK(present(&vo) == 1);
+    CHECK(present(&vo) == 0);
+    PS5_VideoOutGetStats(&vo, &stats);
+    CHECK(stats.flipped == 2);
+    CHECK(stats.missed_vblanks == 0);
+    CHECK(stats.latency_last == 2 * MOCK_VBLANK);
+    CHECK(stats.latency_max == 2 * MOCK_VBLANK);
+
+    /* The display shows frame 2 for three vblanks in a row */
+    mock.late_vblanks = 2;
+    CHECK(present(&vo) == 1);
+    PS5_VideoOutGetStats(&vo, &stats);
+    CHECK(stats.flipped == 3);
+    CHECK(stats.missed_vblanks == 2);
+    CHECK(stats.latency_max == 3 * MOCK_VBLANK);
+
+    PS5_VideoOutResetStats(&vo);
+    PS5_VideoOutGetStats(&vo, &stats);
+    CHECK(stats.submitted == 0 && stats.flipped == 0);
+    CHECK(stats.missed_vblanks == 0 && stats.latency_samples == 0);
+
+    PS5_VideoOutClose(&vo);
+
+    return 0;
+}
+
+static int test_swap_interval(void)
+{
+    PS5_VideoOut vo;
+
+    SDL_zero(mock);
+    CHECK(PS5_VideoOutOpen(&vo) == 0);
+    CHECK(PS5_VideoOutSetMode(&vo, 1920, 1080, 2, SDL_FALSE) == 0);
+    CHECK(mock.flip_rate == 0);
+    CHECK(present(&vo) == 0);
+    CHECK(mock.last_flip_mode == PS5_VIDEO_OUT_FLIP_MODE_VSYNC);
+
+    CHECK(PS5_VideoOutSetSwapInterval(&vo, 0) == 0);
+    CHECK(present(&vo) == 1);
+    CHECK(mock.last_flip_mode == PS5_VIDEO_OUT_FLIP_MODE_HSYNC);
+
+    /* Flip rates are 60, 30 and 20 Hz */
+    CHECK(PS5_VideoOutSetSwapInterval(&vo, 3) == 0);
+    CHECK(mock.flip_rate == 2);
+    CHECK(vo.flip_interval == 1000000 / 20);
+    CHECK(PS5_VideoOutSetSwapInterval(&vo, 2) == 0);
+    CHECK(mock.flip_rate == 1);
+    CHECK(present(&vo) == 0);
+    CHECK(mock.last_flip_mode == PS5_VIDEO_OUT_FLIP_MODE_VSYNC);
+    CHECK(PS5_VideoOutSetSwapInterval(&vo, 4) < 0);
+    CHECK(PS5_VideoOutSetSwapInterval(&vo, -2) < 0);
+    CHECK(vo.swap_interval == 2);
+
+    /* Adaptive sync only tears when a vblank was missed */
+    CHECK(PS5_VideoOutSetSwapInterval(&vo, -1) == 0);
+    CHECK(mock.flip_rate == 0);
+    CHECK(present(&vo) == 1);
+    CHECK(present(&vo) == 0);
+    CHECK(mock.last_flip_mode == PS5_VIDEO_OUT_FLIP_MODE_VSYNC);
+    mock.late_vblanks = 1;
+    CHECK(present(&vo) == 1);
+    CHECK(mock.last_flip_mode == PS5_VIDEO_OUT_FLIP_MODE_HSYNC);
+    CHECK(present(&vo) == 0);
+    CHECK(mock.last_flip_mode == PS5_VIDEO_OUT_FLIP_MODE_VSYNC);
+
+    /* The interval survives a mode switch */
+    CHECK(PS5_VideoOutSetSwapInterval(&vo, 2) == 0);
+    CHECK(PS5_VideoOutSetMode(&vo, 3840, 2160, 2, SDL_FALSE) == 0);
+    CHECK(mock.flip_rate == 1);
+
+    PS5_VideoOutClose(&vo);
+
+    return 0;
+}
+
+static int test_linear(void)
+{
+    PS5_VideoOut vo;
+
+    SDL_zero(mock);
+    CHECK(PS5_VideoOutOpen(&vo) == 0);
+    CHECK(PS5_VideoOutSetMode(&vo, 1920, 1080, 2, SDL_TRUE) == 0);
+    CHECK(vo.linear);
+    CHECK(vo.num_buffers == 1);
+    CHECK(mock.registered_buffers == 1);
+    CHECK(mock.registered_tiling == PS5_VIDEO_OUT_TILING_MODE_LINEAR);
+    CHECK(vo.memsize == 4 * 0x200000);
+    CHECK(vo.memsize >= 1920 * 1080 * 4);
+
+    /* The only buffer is reused as soon as it is on screen */
+    CHECK(present(&vo) == 0);
+    CHECK(mock.waits == 0);
+    CHECK(present(&vo) == 0);
+    CHECK(mock.waits == 1);
+    CHECK(PS5_VideoOutSubmit(&vo, 1) < 0);
+
+    PS5_VideoOutClose(&vo);
+    CHECK(mock.open_ports == 0);
+
+    return 0;
+}
+
+static int test_linear_fallback(void)
+{
+    PS5_VideoOut vo;
+
+    SDL_zero(mock);
+    mock.reject_linear = SDL_TRUE;
+    CHECK(PS5_VideoOutOpen(&vo) == 0);
+    CHECK(PS5_VideoOutSetMode(&vo, 1920, 1080, 3, SDL_TRUE) == 0);
+    CHECK(!vo.linear);
+    CHECK(vo.num_buffers == 3);
+    CHECK(mock.registrations == 2);
+    CHECK(mock.registered_tiling == PS5_VIDEO_OUT_TILING_MODE_TILE);
+    CHECK(mock.open_ports == 1);
+    CHECK(vo.memsize == mock.memory_size);
+    CHECK(vo.memsize == 28 * 0x100000); /* 27 MB rounded to 2 MB pages */
+
+    PS5_VideoOutClose(&vo);
+    CHECK(mock.open_ports == 0);
+
+    return 0;
+}
+
+/* A mode switch that fails keeps the previous mode on screen */
+static int test_failed_switch(void)
+{
+    PS5_VideoOut vo;
+    void *old_memory;
+
+    SDL_zero(mock);
+    CHECK(PS5_VideoOutOpen(&vo) == 0);
+    CHECK(PS5_VideoOutSetMode(&vo, 1920, 1080, 2, SDL_TRUE) == 0);
+    CHECK(vo.linear);
+    old_memory = vo.vbuf[0].data;
+    CHECK(present(&vo) == 0);
+
+    /* Neither layout is accepted at 4K */
+    mock.reject_width = 3840;
+    CHECK(PS5_VideoOutSetMode(&vo, 3840, 2160, 2, SDL_TRUE) < 0);
+    CHECK(SDL_strstr(SDL_GetError(), "sceVideoOutRegisterBuffers2") != NULL);
+    CHECK(vo.width == 1920 && vo.height == 1080);
+    CHECK(vo.linear);
+    CHECK(vo.num_buffers == 1);
+    CHECK(vo.vbuf[0].data == old_memory);
+    CHECK(mock_find_block(old_memory) != NULL);
+    CHECK(mock_find_block(old_memory)->mapped);
+    CHECK(mock.memory == NULL); /* the 4K memory was given back */
+
+    /* The old buffer is registered again and still shows frames */
+    CHECK(mock.open_ports == 1);
+    CHECK(mock.registered_buffers == 1);
+    CHECK(mock.registered_memory == old_memory);
+    CHECK(mock.registered_tiling == PS5_VIDEO_OUT_TILING_MODE_LINEAR);
+    CHECK(present(&vo) == 0);
+
+    PS5_VideoOutClose(&vo);
+    CHECK(mock_find_block(old_memory) == NULL);
+
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    int result = 0;
+
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    if (test_tiled() < 0) {
+        result = 1;
+    }
+    if (test_triple() < 0) {
+        result = 1;
+    }
+    if (test_stats() < 0) {
+        result = 1;
+    }
+    if (test_swap_interval() < 0) {
+        result = 1;
+    }
+    if (test_linear() < 0) {
+        result = 1;
+    }
+    if (test_linear_fallback() < 0) {
+        result = 1;
+    }
+    if (test_failed_switch() < 0) {
+        result = 1;
+    }
+
+    SDL_Log("%s", result ? "FAILED" : "OK");
+
+    return result;
+}
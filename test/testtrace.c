@@ -0,0 +1,197 @@
+/*
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Check and benchmark of the timing trace of SDL internals, built into
+   the test whatever the SDL_TRACING option of the library */
+
+#include "../src/SDL_internal.h"
+
+#include <stdio.h>
+
+#include "SDL.h"
+
+#ifndef SDL_TRACING
+#define SDL_TRACING 1
+#endif
+#include "../src/SDL_trace.c"
+
+#define TRACE_FILE     "testtrace.json"
+#define NUM_THREADS    4
+#define THREAD_SPANS   1000
+
+#define CHECK(cond)                                              \
+    if (!(cond)) {                                               \
+        SDL_Log("%s:%d: check failed: %s", __FILE__, __LINE__, #cond); \
+        return -1;                                               \
+    }
+
+typedef struct
+{
+    int begins, ends;
+    int events;
+} TraceCount;
+
+/* Count the events of a dump, of one thread or all of them (thread 0) */
+static int count_events(SDL_threadID thread, TraceCount *count)
+{
+    char tid[64];
+    char *json, *line;
+
+    SDL_zerop(count);
+    json = (char *)SDL_LoadFile(TRACE_FILE, NULL);
+    CHECK(json != NULL);
+    CHECK(SDL_strncmp(json, "{\"traceEvents\":[", 16) == 0);
+    CHECK(SDL_strstr(json, "\n]}\n") != NULL);
+
+    SDL_snprintf(tid, sizeof(tid), "\"tid\":%lu}", thread);
+    for (line = SDL_strchr(json, '\n'); line; line = SDL_strchr(line + 1, '\n')) {
+        char *end = SDL_strchr(line + 1, '\n');
+
+        if (!end || SDL_strncmp(line + 1, "{\"name\":", 8) != 0) {
+            continue;
+        }
+        *end = '\0';
+        if (thread == 0 || SDL_strstr(line + 1, tid)) {
+            count->events++;
+            if (SDL_strstr(line + 1, "\"ph\":\"B\"")) {
+                count->begins++;
+            } else if (SDL_strstr(line + 1, "\"ph\":\"E\"")) {
+                count->ends++;
+            }
+        }
+        *end = '\n';
+    }
+    SDL_free(json);
+    return 0;
+}
+
+static int SDLCALL trace_thread(void *data)
+{
+    SDL_threadID *thread = (SDL_threadID *)data;
+
+    *thread = SDL_ThreadID();
+    for (int i = 0; i < THREAD_SPANS; i++) {
+        SDL_TRACE_BEGIN("outer");
+        SDL_TRACE_BEGIN("inner");
+        SDL_TRACE_END("inner");
+        SDL_TRACE_END("outer");
+    }
+    return 0;
+}
+
+/* Every thread gets its own ring, and all of them are dumped */
+static int test_threads(void)
+{
+    SDL_Thread *threads[NUM_THREADS];
+    SDL_threadID ids[NUM_THREADS];
+    TraceCount count;
+    int i;
+
+    for (i = 0; i < NUM_THREADS; i++) {
+        threads[i] = SDL_CreateThread(trace_thread, "trace", &ids[i]);
+        CHECK(threads[i] != NULL);
+    }
+    for (i = 0; i < NUM_THREADS; i++) {
+        SDL_WaitThread(threads[i], NULL);
+    }
+
+    CHECK(SDL_TraceDump(TRACE_FILE) == 0);
+    for (i = 0; i < NUM_THREADS; i++) {
+        CHECK(count_events(ids[i], &count) == 0);
+        CHECK(count.begins == THREAD_SPANS * 2);
+        CHECK(count.ends == THREAD_SPANS * 2);
+    }
+    return 0;
+}
+
+/* A full ring keeps the last events, and drops the ends of spans whose
+   beginning was overwritten */
+static int test_wrap(void)
+{
+    const int extra = 101;
+    TraceCount count;
+    int i;
+
+    SDL_TRACE_BEGIN("lost");
+    for (i = 0; i < SDL_TRACE_EVENTS / 2 + extra; i++) {
+        SDL_TRACE_BEGIN("kept");
+        SDL_TRACE_END("kept");
+    }
+    SDL_TRACE_END("lost");
+
+    CHECK(SDL_TraceDump(TRACE_FILE) == 0);
+    CHECK(count_events(SDL_ThreadID(), &count) == 0);
+    CHECK(count.events == SDL_TRACE_EVENTS - 2);
+    CHECK(count.begins == count.ends);
+    return 0;
+}
+
+/* The hint dumps the trace when it changes, and on quit */
+static int test_hint(void)
+{
+    TraceCount count;
+
+    remove(TRACE_FILE);
+    SDL_TraceInit();
+    SDL_SetHint(SDL_HINT_TRACE_FILE, TRACE_FILE);
+    CHECK(count_events(0, &count) == 0);
+    CHECK(count.events > 0);
+
+    remove(TRACE_FILE);
+    SDL_TraceQuit();
+    CHECK(count_events(0, &count) == 0);
+    CHECK(count.events > 0);
+
+    SDL_ResetHint(SDL_HINT_TRACE_FILE);
+    return 0;
+}
+
+static void benchmark(void)
+{
+    const int spans = 1000000;
+    Uint64 start, ticks;
+
+    start = SDL_GetPerformanceCounter();
+    for (int i = 0; i < spans; i++) {
+        SDL_TRACE_BEGIN("bench");
+        SDL_TRACE_END("bench");
+    }
+    ticks = SDL_GetPerformanceCounter() - start;
+    SDL_Log("%.1f ns per event",
+            (double)ticks * 1000000000.0 / SDL_GetPerformanceFrequency() / (spans * 2));
+}
+
+int main(int argc, char *argv[])
+{
+    int result = 0;
+
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    if (test_threads() < 0) {
+        result = 1;
+    }
+    if (test_wrap() < 0) {
+        result = 1;
+    }
+    if (test_hint() < 0) {
+        result = 1;
+    }
+    benchmark();
+
+    remove(TRACE_FILE);
+    SDL_Quit();
+    SDL_Log("%s", result ? "FAILED" : "OK");
+
+    return result;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */